@@ -5,6 +5,7 @@ import (
 	"os"
 	"path/filepath"
 	"strings"
+	"time"
 
 	"github.com/spf13/cobra"
 
@@ -16,6 +17,7 @@ import (
 	"github.com/zjy-dev/de-fuzz/internal/fuzz"
 	"github.com/zjy-dev/de-fuzz/internal/llm"
 	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
 	"github.com/zjy-dev/de-fuzz/internal/oracle"
 	"github.com/zjy-dev/de-fuzz/internal/prompt"
 	"github.com/zjy-dev/de-fuzz/internal/prompt/mechanism"
@@ -31,6 +33,7 @@ func NewFuzzCommand() *cobra.Command {
 		limit   int
 		timeout int
 		useQEMU bool
+		workers int
 	)
 
 	cmd := &cobra.Command{
@@ -100,11 +103,14 @@ Examples:
 			if !cmd.Flags().Changed("use-qemu") {
 				useQEMU = cfg.Compiler.Fuzz.UseQEMU
 			}
+			if !cmd.Flags().Changed("workers") {
+				workers = cfg.Compiler.Fuzz.Workers
+			}
 
 			// Build the actual output directory: {output}/{isa}/{strategy}
 			outputDir := filepath.Join(output, cfg.ISA, cfg.Strategy)
 
-			return runFuzz(cfg, outputDir, logDir, limit, timeout, useQEMU)
+			return runFuzz(cfg, outputDir, logDir, limit, timeout, useQEMU, workers)
 		},
 	}
 
@@ -114,11 +120,12 @@ Examples:
 	cmd.Flags().IntVar(&limit, "limit", -1, "Max number of target BBs for constraint solving (-1 = unlimited, 0 = initial seeds only)")
 	cmd.Flags().IntVar(&timeout, "timeout", 30, "Execution timeout in seconds")
 	cmd.Flags().BoolVar(&useQEMU, "use-qemu", false, "Use QEMU for cross-architecture execution")
+	cmd.Flags().IntVar(&workers, "workers", 1, "Number of concurrent target-solving workers (>1 enables parallel mode)")
 
 	return cmd
 }
 
-func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout int, useQEMU bool) error {
+func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout int, useQEMU bool, workers int) error {
 	// Initialize logger with configured level
 	logLevel := cfg.LogLevel
 	if logLevel == "" {
@@ -134,24 +141,88 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 	} else {
 		logger.Init(logLevel)
 	}
+	logger.Debug("Log level: %s", logLevel)
+
+	// Optional hot-path metrics: Prometheus endpoint plus a periodic
+	// one-line summary in the log, for watching week-long campaigns.
+	if stop := startMetrics(cfg); stop != nil {
+		defer stop()
+	}
+
+	engine, err := buildFuzzEngine(cfg, outputDir, fuzzOptions{
+		limit:   limit,
+		timeout: timeout,
+		useQEMU: useQEMU,
+		workers: workers,
+	})
+	if err != nil {
+		return err
+	}
+
+	fmt.Println("[Fuzz] Starting fuzzing engine...")
+	logger.Info("Using fuzzing engine")
+	return engine.Run()
+}
+
+// startMetrics enables the optional metrics endpoint and periodic summary
+// when configured, returning the summary stopper (nil when disabled).
+func startMetrics(cfg *config.Config) (stop func()) {
+	addr := cfg.Compiler.Fuzz.MetricsAddr
+	if addr == "" {
+		return nil
+	}
+	go func() {
+		if err := metrics.Serve(addr); err != nil {
+			logger.Error("Metrics endpoint failed: %v", err)
+		}
+	}()
+	fmt.Printf("[Fuzz] Metrics endpoint enabled at http://%s/metrics\n", addr)
+	return metrics.StartSummaryLogger(5*time.Minute, logger.Info)
+}
+
+// fuzzOptions carries the command-level knobs shared by the fuzz and
+// orchestrate commands.
+type fuzzOptions struct {
+	limit   int
+	timeout int
+	useQEMU bool
+	workers int
+
+	// sharedLLM, when non-nil, is used instead of a per-campaign client:
+	// orchestrator mode hands every campaign the same rate-limited client
+	// so they draw from one request budget.
+	sharedLLM llm.LLM
+}
 
+// buildFuzzEngine wires one campaign's full pipeline (corpus, compiler,
+// coverage, oracle, prompts, analyzer) for the given config and returns
+// the ready-to-run engine.
+func buildFuzzEngine(cfg *config.Config, outputDir string, opts fuzzOptions) (*fuzz.Engine, error) {
 	logger.Info("Target: %s / %s", cfg.ISA, cfg.Strategy)
 	logger.Info("Output directory: %s", outputDir)
-	logger.Debug("Log level: %s", logLevel)
 
 	// Create state directory (used for resume capability)
 	stateDir := filepath.Join(outputDir, "state")
 	if err := os.MkdirAll(stateDir, 0755); err != nil {
-		return fmt.Errorf("failed to create state directory: %w", err)
+		return nil, fmt.Errorf("failed to create state directory: %w", err)
 	}
 
 	// 2. Create corpus manager
-	corpusManager := corpus.NewFileManager(outputDir)
+	var corpusManager corpus.Manager
+	switch cfg.Fuzz.CorpusFormat {
+	case "packed":
+		corpusManager = corpus.NewPackedManager(outputDir)
+		logger.Info("[Fuzz] Using packed corpus format (%s + %s)", corpus.PackDataFile, corpus.PackIndexFile)
+	case "", "dir":
+		corpusManager = corpus.NewFileManager(outputDir)
+	default:
+		return nil, fmt.Errorf("unknown corpus_format %q (want \"dir\" or \"packed\")", cfg.Fuzz.CorpusFormat)
+	}
 
 	// Build deterministic flag scheduler before wiring compiler and engine.
 	flagScheduler, err := fuzz.NewFlagScheduler(cfg.ISA, cfg.Compiler.Fuzz.FlagStrategy)
 	if err != nil {
-		return fmt.Errorf("failed to create flag scheduler: %w", err)
+		return nil, fmt.Errorf("failed to create flag scheduler: %w", err)
 	}
 	allowLLMCFlags := true
 	if flagScheduler != nil {
@@ -181,8 +252,40 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 		PrefixPath:       compilerDir,
 		CFlags:           cflags,
 		DisableLLMCFlags: !allowLLMCFlags,
+		EnableCache:      cfg.Compiler.CompileCache,
+		PersistentMode:   cfg.Compiler.PersistentToolchain,
 	})
 
+	// Parallel mode: each worker compiles in its own directory so concurrent
+	// compilations do not clobber each other's source/binary artifacts. With
+	// coverage isolation, each worker's compiler also runs under its own
+	// GCOV_PREFIX so the instrumented compiler's counters land in a
+	// per-worker directory instead of the shared build tree.
+	coverageIsolation := cfg.Compiler.CoverageIsolation && opts.workers > 1
+	workerGcovPrefix := func(workerID int) string {
+		return filepath.Join(outputDir, "build", fmt.Sprintf("worker-%d", workerID), "gcov-prefix")
+	}
+	var workerCompilers []compiler.Compiler
+	if opts.workers > 1 {
+		workerCompilers = make([]compiler.Compiler, opts.workers)
+		for i := 0; i < opts.workers; i++ {
+			var extraEnv []string
+			if coverageIsolation {
+				extraEnv = coverage.GcovPrefixEnv(workerGcovPrefix(i))
+			}
+			workerCompilers[i] = compiler.NewGCCCompiler(compiler.GCCCompilerConfig{
+				GCCPath:          cfg.Compiler.Path,
+				WorkDir:          filepath.Join(outputDir, "build", fmt.Sprintf("worker-%d", i)),
+				PrefixPath:       compilerDir,
+				CFlags:           cflags,
+				DisableLLMCFlags: !allowLLMCFlags,
+				EnableCache:      cfg.Compiler.CompileCache,
+				PersistentMode:   cfg.Compiler.PersistentToolchain,
+				ExtraEnv:         extraEnv,
+			})
+		}
+	}
+
 	// 4. Create coverage tracker (coverage is generated during compilation by instrumented GCC)
 	cmdExecutor := exec.NewCommandExecutor()
 
@@ -203,7 +306,7 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 	// Determine gcovr command: use config if set, otherwise use default
 	gcovrCommand := cfg.Compiler.GcovrCommand
 	if gcovrCommand == "" {
-		return fmt.Errorf("gcovr command not specified in config")
+		return nil, fmt.Errorf("gcovr command not specified in config")
 	}
 
 	// Determine total report path: use config if set, otherwise use state directory
@@ -229,11 +332,44 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 		totalReportPath,
 		filterConfigPath,
 	)
+	if cfg.Compiler.GcovPath != "" {
+		coverageTracker.EnableNativeGcov(cfg.Compiler.GcovPath)
+		fmt.Printf("[Fuzz] Native gcov ingestion enabled: %s\n", cfg.Compiler.GcovPath)
+	}
 
-	// 6. Create LLM client
-	llmClient, err := llm.New(cfg.RemixerConfigPath, cfg.DefaultTemperature)
-	if err != nil {
-		return fmt.Errorf("failed to create LLM client: %w", err)
+	// Coverage isolation: one tracker per worker, matching the GCOV_PREFIX
+	// its compiler runs under, so compile+measure cycles overlap instead of
+	// serializing on the shared build tree.
+	var workerCoverages []coverage.Coverage
+	if coverageIsolation {
+		workerCoverages = make([]coverage.Coverage, opts.workers)
+		for i := 0; i < opts.workers; i++ {
+			workerTracker := coverage.NewGCCCoverage(
+				cmdExecutor,
+				nil, // workers measure pre-compiled seeds; no compile function needed
+				cfg.Compiler.GcovrExecPath,
+				gcovrCommand,
+				totalReportPath,
+				filterConfigPath,
+			)
+			if cfg.Compiler.GcovPath != "" {
+				workerTracker.EnableNativeGcov(cfg.Compiler.GcovPath)
+			}
+			if err := workerTracker.EnableGcovPrefixIsolation(workerGcovPrefix(i)); err != nil {
+				return nil, fmt.Errorf("failed to enable coverage isolation for worker %d: %w", i, err)
+			}
+			workerCoverages[i] = workerTracker
+		}
+		fmt.Printf("[Fuzz] Per-worker GCOV_PREFIX coverage isolation enabled (%d workers)\n", opts.workers)
+	}
+
+	// 6. Create LLM client (shared across campaigns in orchestrator mode)
+	llmClient := opts.sharedLLM
+	if llmClient == nil {
+		llmClient, err = llm.New(cfg.RemixerConfigPath, cfg.DefaultTemperature)
+		if err != nil {
+			return nil, fmt.Errorf("failed to create LLM client: %w", err)
+		}
 	}
 
 	// 8. Create prompt service
@@ -243,16 +379,16 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 	// Load understanding to check it exists
 	_, err = seed.LoadUnderstanding(basePath)
 	if err != nil {
-		return fmt.Errorf("understanding not found at %s, please run 'defuzz generate' first: %w", basePath, err)
+		return nil, fmt.Errorf("understanding not found at %s, please run 'defuzz generate' first: %w", basePath, err)
 	}
 
 	// Validate strategy/oracle consistency via mechanism contract.
 	mechanismContract, ok := mechanism.Get(cfg.Strategy)
 	if !ok {
-		return fmt.Errorf("no mechanism contract registered for strategy %q; register it in internal/prompt/mechanism/", cfg.Strategy)
+		return nil, fmt.Errorf("no mechanism contract registered for strategy %q; register it in internal/prompt/mechanism/", cfg.Strategy)
 	}
 	if mechanismContract.OracleType() != cfg.Compiler.Oracle.Type {
-		return fmt.Errorf(
+		return nil, fmt.Errorf(
 			"strategy/oracle mismatch: strategy %q declares oracle type %q but cfg.Compiler.Oracle.Type is %q",
 			cfg.Strategy, mechanismContract.OracleType(), cfg.Compiler.Oracle.Type,
 		)
@@ -261,6 +397,7 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 	// Create prompt builder: template path is derived from the contract.
 	functionTemplate := mechanismContract.FunctionTemplatePath(cfg.ISA)
 	promptBuilder := prompt.NewBuilder(cfg.Compiler.Fuzz.MaxTestCases, functionTemplate, mechanismContract)
+	promptBuilder.TokenBudget = cfg.Compiler.Fuzz.PromptTokenBudget
 
 	// Create prompt service with configuration
 	basePromptDir := cfg.Compiler.Fuzz.BasePromptDir
@@ -270,7 +407,7 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 
 	promptService, err := prompt.NewPromptService(basePromptDir, understandingPath, promptBuilder)
 	if err != nil {
-		return fmt.Errorf("failed to create prompt service: %w", err)
+		return nil, fmt.Errorf("failed to create prompt service: %w", err)
 	}
 
 	// For oracle creation, we still need understanding content directly
@@ -285,16 +422,16 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 		understanding,
 	)
 	if err != nil {
-		return fmt.Errorf("failed to create oracle: %w", err)
+		return nil, fmt.Errorf("failed to create oracle: %w", err)
 	}
 
 	// 9. Initialize corpus and load initial seeds if needed
 	if err := corpusManager.Initialize(); err != nil {
-		return fmt.Errorf("failed to initialize corpus: %w", err)
+		return nil, fmt.Errorf("failed to initialize corpus: %w", err)
 	}
 
 	if err := corpusManager.Recover(); err != nil {
-		return fmt.Errorf("failed to recover corpus: %w", err)
+		return nil, fmt.Errorf("failed to recover corpus: %w", err)
 	}
 
 	// If corpus is empty, load initial seeds
@@ -302,16 +439,16 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 		logger.Info("Corpus is empty, loading initial seeds from %s...", basePath)
 		initialSeeds, err := seed.LoadSeedsWithMetadata(basePath, seed.NewDefaultNamingStrategy())
 		if err != nil {
-			return fmt.Errorf("failed to load initial seeds: %w", err)
+			return nil, fmt.Errorf("failed to load initial seeds: %w", err)
 		}
 		if len(initialSeeds) == 0 {
-			return fmt.Errorf("no initial seeds found in %s, please run 'defuzz generate' first", basePath)
+			return nil, fmt.Errorf("no initial seeds found in %s, please run 'defuzz generate' first", basePath)
 		}
 		for _, s := range initialSeeds {
 			// Reset ID to 0 so corpus manager assigns a new unique ID
 			s.Meta.ID = 0
 			if err := corpusManager.Add(s); err != nil {
-				return fmt.Errorf("failed to add initial seed to corpus: %w", err)
+				return nil, fmt.Errorf("failed to add initial seed to corpus: %w", err)
 			}
 		}
 		logger.Info("Loaded %d initial seeds", len(initialSeeds))
@@ -379,41 +516,64 @@ func runFuzz(cfg *config.Config, outputDir string, logDir string, limit, timeout
 		}
 	}
 
-	// 12. Create and run fuzzing engine
-	// Use Engine for constraint solving based fuzzing
-	fmt.Println("[Fuzz] Starting fuzzing engine...")
-	logger.Info("Using fuzzing engine")
-
+	// 12. Create the fuzzing engine
 	// Create oracle executor: QEMU for cross-architecture, local for native
 	var oracleExecutor oracle.Executor
-	if useQEMU {
-		oracleExecutor = executor.NewQEMUOracleExecutorAdapter(
-			cfg.Compiler.Fuzz.QEMUPath,
-			cfg.Compiler.Fuzz.QEMUSysroot,
-			timeout,
-		)
-		logger.Info("Oracle using QEMU executor: %s", cfg.Compiler.Fuzz.QEMUPath)
+	if opts.useQEMU {
+		if cfg.Compiler.Fuzz.QEMUForkserver {
+			// Persistent execution server: cross-compile the guest agent once
+			// with the campaign compiler and keep a single qemu alive for all
+			// oracle runs. Falls back to the per-run adapter if the agent
+			// cannot be built (e.g. the toolchain lacks static libc).
+			agentPath, err := executor.BuildForkserverAgent(
+				cfg.Compiler.Path,
+				filepath.Join(outputDir, "build", "forkserver"),
+			)
+			if err != nil {
+				logger.Warn("Failed to build QEMU forkserver agent, falling back to per-run QEMU: %v", err)
+			} else {
+				oracleExecutor = executor.NewQEMUForkserverExecutor(
+					cfg.Compiler.Fuzz.QEMUPath,
+					cfg.Compiler.Fuzz.QEMUSysroot,
+					agentPath,
+					opts.timeout,
+				)
+				logger.Info("Oracle using persistent QEMU forkserver: %s", agentPath)
+			}
+		}
+		if oracleExecutor == nil {
+			oracleExecutor = executor.NewQEMUOracleExecutorAdapter(
+				cfg.Compiler.Fuzz.QEMUPath,
+				cfg.Compiler.Fuzz.QEMUSysroot,
+				opts.timeout,
+			)
+			logger.Info("Oracle using QEMU executor: %s", cfg.Compiler.Fuzz.QEMUPath)
+		}
 	} else {
-		oracleExecutor = executor.NewOracleExecutorAdapter(timeout)
+		oracleExecutor = executor.NewOracleExecutorAdapter(opts.timeout)
 		logger.Info("Oracle using local executor")
 	}
 
 	cfgEngine := fuzz.NewEngine(fuzz.Config{
-		Corpus:         corpusManager,
-		Compiler:       gccCompiler,
-		Coverage:       coverageTracker,
-		Oracle:         oracleInstance,
-		OracleType:     cfg.Compiler.Oracle.Type,
-		OracleExecutor: oracleExecutor,
-		LLM:            llmClient,
-		Flags:          flagScheduler,
-		Analyzer:       analyzer,
-		PromptService:  promptService,
-		MaxIterations:  limit,
-		MaxRetries:     cfg.Compiler.Fuzz.MaxConstraintRetries,
-		MappingPath:    filepath.Join(stateDir, "coverage_mapping.json"),
+		Corpus:              corpusManager,
+		Compiler:            gccCompiler,
+		Coverage:            coverageTracker,
+		Oracle:              oracleInstance,
+		OracleType:          cfg.Compiler.Oracle.Type,
+		OracleExecutor:      oracleExecutor,
+		LLM:                 llmClient,
+		Flags:               flagScheduler,
+		Analyzer:            analyzer,
+		PromptService:       promptService,
+		MaxIterations:       opts.limit,
+		MaxRetries:          cfg.Compiler.Fuzz.MaxConstraintRetries,
+		CandidatesPerPrompt: cfg.Compiler.Fuzz.CandidatesPerPrompt,
+		MappingPath:         filepath.Join(stateDir, "coverage_mapping.json"),
+		Workers:             opts.workers,
+		WorkerCompilers:     workerCompilers,
+		WorkerCoverages:     workerCoverages,
 	})
-	return cfgEngine.Run()
+	return cfgEngine, nil
 }
 
 func inferCFGSourceBase(cfgPath string) string {
@@ -89,6 +89,7 @@ Examples:
 			// 4. Create prompt builder: template path is derived from the contract.
 			functionTemplate := mechanismContract.FunctionTemplatePath(isa)
 			promptBuilder := prompt.NewBuilder(cfg.Compiler.Fuzz.MaxTestCases, functionTemplate, mechanismContract)
+			promptBuilder.TokenBudget = cfg.Compiler.Fuzz.PromptTokenBudget
 
 			// Log mode
 			if promptBuilder.IsFunctionTemplateMode() {
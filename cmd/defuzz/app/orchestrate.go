@@ -0,0 +1,146 @@
+package app
+
+import (
+	"fmt"
+	"path/filepath"
+	"strings"
+
+	"github.com/spf13/cobra"
+
+	"github.com/zjy-dev/de-fuzz/internal/config"
+	"github.com/zjy-dev/de-fuzz/internal/fuzz"
+	"github.com/zjy-dev/de-fuzz/internal/llm"
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+// NewOrchestrateCommand creates the "orchestrate" subcommand.
+func NewOrchestrateCommand() *cobra.Command {
+	var (
+		isas           string
+		output         string
+		logDir         string
+		limit          int
+		timeout        int
+		useQEMU        bool
+		workers        int
+		llmConcurrency int
+	)
+
+	cmd := &cobra.Command{
+		Use:   "orchestrate",
+		Short: "Run fuzzing campaigns for several architectures in one process.",
+		Long: `Run fuzzing campaigns for several architectures in one process.
+
+Each architecture gets its own full pipeline (compiler, coverage, oracle,
+corpus) under {output}/{isa}/{strategy}, exactly as a standalone "defuzz
+fuzz" run would, so every campaign stays independently resumable. On top
+of that the orchestrator:
+  1. Shares a single rate-limited LLM client across all campaigns, so
+     they draw from one request budget instead of oversubscribing the
+     backend.
+  2. Cross-pollinates bug-finding and target-hitting seeds between the
+     campaigns' corpora (plain coverage gains stay local - they are
+     arch-specific almost by definition).
+
+Per-ISA configuration is loaded the same way as for "defuzz fuzz", with
+the ISA overridden for each campaign; the compiler config is resolved
+from the override (e.g. gcc-v12.2.0-x64-canary.yaml).
+
+Examples:
+  # Fuzz x64 and aarch64 together, sharing one LLM budget
+  defuzz orchestrate --isas x64,aarch64
+
+  # Cross-architecture campaigns under QEMU, 8 concurrent LLM requests
+  defuzz orchestrate --isas aarch64,riscv64,loongarch64 --use-qemu --llm-concurrency 8`,
+		RunE: func(cmd *cobra.Command, args []string) error {
+			isaList := splitISAs(isas)
+			if len(isaList) < 2 {
+				return fmt.Errorf("orchestrate needs at least two ISAs (got %q); use 'defuzz fuzz' for a single campaign", isas)
+			}
+			return runOrchestrate(isaList, output, logDir, limit, timeout, useQEMU, workers, llmConcurrency)
+		},
+	}
+
+	cmd.Flags().StringVar(&isas, "isas", "", "Comma-separated ISAs to fuzz concurrently (e.g. x64,aarch64)")
+	cmd.Flags().StringVar(&output, "output", "fuzz_out", "Output directory (each campaign at {output}/{isa}/{strategy})")
+	cmd.Flags().StringVar(&logDir, "log-dir", "", "Log file directory (timestamped log files, empty = console only)")
+	cmd.Flags().IntVar(&limit, "limit", -1, "Max number of target BBs per campaign (-1 = unlimited, 0 = initial seeds only)")
+	cmd.Flags().IntVar(&timeout, "timeout", 30, "Execution timeout in seconds")
+	cmd.Flags().BoolVar(&useQEMU, "use-qemu", false, "Use QEMU for cross-architecture execution")
+	cmd.Flags().IntVar(&workers, "workers", 1, "Number of concurrent target-solving workers per campaign")
+	cmd.Flags().IntVar(&llmConcurrency, "llm-concurrency", 4, "Max in-flight LLM requests shared by all campaigns")
+	cmd.MarkFlagRequired("isas")
+
+	return cmd
+}
+
+func splitISAs(isas string) []string {
+	var out []string
+	for _, isa := range strings.Split(isas, ",") {
+		if isa = strings.TrimSpace(isa); isa != "" {
+			out = append(out, isa)
+		}
+	}
+	return out
+}
+
+func runOrchestrate(isas []string, output, logDir string, limit, timeout int, useQEMU bool, workers, llmConcurrency int) error {
+	// Load the first ISA's config up front for the process-wide pieces:
+	// logger level, metrics endpoint and the LLM client config.
+	firstCfg, err := config.LoadConfigForISA(isas[0])
+	if err != nil {
+		return fmt.Errorf("failed to load config for %s: %w", isas[0], err)
+	}
+
+	logLevel := firstCfg.LogLevel
+	if logLevel == "" {
+		logLevel = "info"
+	}
+	if logDir != "" {
+		if err := logger.InitWithFile(logLevel, logDir); err != nil {
+			return fmt.Errorf("failed to initialize logger with file: %w", err)
+		}
+		defer logger.Close()
+	} else {
+		logger.Init(logLevel)
+	}
+
+	if stop := startMetrics(firstCfg); stop != nil {
+		defer stop()
+	}
+
+	// One LLM client, rate-limited, handed to every campaign.
+	llmClient, err := llm.New(firstCfg.RemixerConfigPath, firstCfg.DefaultTemperature)
+	if err != nil {
+		return fmt.Errorf("failed to create LLM client: %w", err)
+	}
+	sharedLLM := llm.NewRateLimited(llmClient, llmConcurrency)
+	logger.Info("[Orchestrator] Shared LLM budget: %d concurrent requests", llmConcurrency)
+
+	orch := fuzz.NewOrchestrator()
+	for i, isa := range isas {
+		cfg := firstCfg
+		if i > 0 {
+			cfg, err = config.LoadConfigForISA(isa)
+			if err != nil {
+				return fmt.Errorf("failed to load config for %s: %w", isa, err)
+			}
+		}
+
+		outputDir := filepath.Join(output, cfg.ISA, cfg.Strategy)
+		engine, err := buildFuzzEngine(cfg, outputDir, fuzzOptions{
+			limit:     limit,
+			timeout:   timeout,
+			useQEMU:   useQEMU,
+			workers:   workers,
+			sharedLLM: sharedLLM,
+		})
+		if err != nil {
+			return fmt.Errorf("failed to build %s campaign: %w", isa, err)
+		}
+		orch.Register(cfg.ISA, engine)
+	}
+
+	fmt.Printf("[Orchestrate] Starting %d campaigns: %s\n", len(isas), strings.Join(isas, ", "))
+	return orch.Run()
+}
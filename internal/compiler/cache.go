@@ -0,0 +1,141 @@
+package compiler
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+// cacheDirName is the subdirectory of the compiler work dir holding cached
+// compilation results, so the cache survives restarts with the campaign.
+const cacheDirName = "compile_cache"
+
+// compileCache is a content-addressed cache of compilation results.
+// LLMs frequently emit byte-identical programs across retries; keying on the
+// source content plus the effective flag list lets us skip re-running the
+// cross-compiler for exact duplicates.
+type compileCache struct {
+	dir string
+}
+
+// cachedResult is the persisted subset of CompileResult.
+// Command/argv metadata is not cached: it is rebuilt per compile and only
+// meaningful for the invocation that actually ran.
+type cachedResult struct {
+	Success        bool     `json:"success"`
+	Stdout         string   `json:"stdout"`
+	Stderr         string   `json:"stderr"`
+	EffectiveFlags []string `json:"effective_flags"`
+}
+
+// newCompileCache creates a cache rooted under the given work directory.
+func newCompileCache(workDir string) *compileCache {
+	return &compileCache{dir: filepath.Join(workDir, cacheDirName)}
+}
+
+// cacheKey derives the content-addressed key from the seed source and the
+// effective compiler flags.
+func cacheKey(content string, effectiveFlags []string) string {
+	h := sha256.New()
+	io.WriteString(h, content)
+	io.WriteString(h, "\x00")
+	io.WriteString(h, strings.Join(effectiveFlags, "\x1f"))
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+func (c *compileCache) resultPath(key string) string {
+	return filepath.Join(c.dir, key+".json")
+}
+
+func (c *compileCache) binaryPath(key string) string {
+	return filepath.Join(c.dir, key+".bin")
+}
+
+// Lookup returns the cached result for a key, or (nil, false) on a miss.
+// For successful compilations the returned BinaryPath points at the cached
+// binary; a missing binary invalidates the entry.
+func (c *compileCache) Lookup(key string) (*CompileResult, bool) {
+	data, err := os.ReadFile(c.resultPath(key))
+	if err != nil {
+		return nil, false
+	}
+
+	var cached cachedResult
+	if err := json.Unmarshal(data, &cached); err != nil {
+		logger.Warn("Compile cache: dropping corrupt entry %s: %v", key, err)
+		os.Remove(c.resultPath(key))
+		return nil, false
+	}
+
+	result := &CompileResult{
+		Success:        cached.Success,
+		Stdout:         cached.Stdout,
+		Stderr:         cached.Stderr,
+		EffectiveFlags: append([]string(nil), cached.EffectiveFlags...),
+		CacheHit:       true,
+	}
+
+	if cached.Success {
+		binPath := c.binaryPath(key)
+		if _, err := os.Stat(binPath); err != nil {
+			return nil, false
+		}
+		result.BinaryPath = binPath
+	}
+
+	return result, true
+}
+
+// Store persists a compilation result (including failures, whose captured
+// Stderr is what the retry prompt needs) under the given key.
+func (c *compileCache) Store(key string, result *CompileResult) error {
+	if err := os.MkdirAll(c.dir, 0755); err != nil {
+		return fmt.Errorf("failed to create cache directory: %w", err)
+	}
+
+	if result.Success {
+		if err := copyFile(result.BinaryPath, c.binaryPath(key)); err != nil {
+			return fmt.Errorf("failed to cache binary: %w", err)
+		}
+	}
+
+	data, err := json.Marshal(cachedResult{
+		Success:        result.Success,
+		Stdout:         result.Stdout,
+		Stderr:         result.Stderr,
+		EffectiveFlags: result.EffectiveFlags,
+	})
+	if err != nil {
+		return fmt.Errorf("failed to marshal cache entry: %w", err)
+	}
+
+	if err := os.WriteFile(c.resultPath(key), data, 0644); err != nil {
+		return fmt.Errorf("failed to write cache entry: %w", err)
+	}
+
+	return nil
+}
+
+func copyFile(src, dst string) error {
+	in, err := os.Open(src)
+	if err != nil {
+		return err
+	}
+	defer in.Close()
+
+	out, err := os.OpenFile(dst, os.O_WRONLY|os.O_CREATE|os.O_TRUNC, 0755)
+	if err != nil {
+		return err
+	}
+	defer out.Close()
+
+	_, err = io.Copy(out, in)
+	return err
+}
@@ -0,0 +1,124 @@
+package compiler
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+	"github.com/zjy-dev/de-fuzz/internal/exec"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+func TestCacheKey_Deterministic(t *testing.T) {
+	k1 := cacheKey("int main() { return 0; }", []string{"-O0", "-fstack-protector-strong"})
+	k2 := cacheKey("int main() { return 0; }", []string{"-O0", "-fstack-protector-strong"})
+	assert.Equal(t, k1, k2)
+
+	// Different flags must produce a different key
+	k3 := cacheKey("int main() { return 0; }", []string{"-O2"})
+	assert.NotEqual(t, k1, k3)
+
+	// Different content must produce a different key
+	k4 := cacheKey("int main() { return 1; }", []string{"-O0", "-fstack-protector-strong"})
+	assert.NotEqual(t, k1, k4)
+}
+
+func TestCompileCache_StoreAndLookup(t *testing.T) {
+	workDir := t.TempDir()
+	cache := newCompileCache(workDir)
+
+	// Create a fake binary to cache
+	binPath := filepath.Join(workDir, "seed_1")
+	require.NoError(t, os.WriteFile(binPath, []byte("fake-binary"), 0755))
+
+	key := cacheKey("int main() { return 0; }", []string{"-O0"})
+	require.NoError(t, cache.Store(key, &CompileResult{
+		BinaryPath:     binPath,
+		Success:        true,
+		Stderr:         "warning: something",
+		EffectiveFlags: []string{"-O0"},
+	}))
+
+	cached, ok := cache.Lookup(key)
+	require.True(t, ok)
+	assert.True(t, cached.Success)
+	assert.True(t, cached.CacheHit)
+	assert.Equal(t, "warning: something", cached.Stderr)
+
+	// The cached binary must exist at the returned path
+	data, err := os.ReadFile(cached.BinaryPath)
+	require.NoError(t, err)
+	assert.Equal(t, "fake-binary", string(data))
+}
+
+func TestCompileCache_StoresFailures(t *testing.T) {
+	cache := newCompileCache(t.TempDir())
+
+	key := cacheKey("int main() {", []string{"-O0"})
+	require.NoError(t, cache.Store(key, &CompileResult{
+		Success: false,
+		Stderr:  "error: expected declaration",
+	}))
+
+	cached, ok := cache.Lookup(key)
+	require.True(t, ok)
+	assert.False(t, cached.Success)
+	assert.Equal(t, "error: expected declaration", cached.Stderr)
+	assert.Empty(t, cached.BinaryPath)
+}
+
+func TestCompileCache_MissOnUnknownKey(t *testing.T) {
+	cache := newCompileCache(t.TempDir())
+
+	_, ok := cache.Lookup(cacheKey("void f(void) {}", nil))
+	assert.False(t, ok)
+}
+
+func TestGCCCompiler_Compile_UsesCache(t *testing.T) {
+	workDir := t.TempDir()
+
+	compiler := NewGCCCompiler(GCCCompilerConfig{
+		GCCPath:     "gcc",
+		WorkDir:     workDir,
+		EnableCache: true,
+	})
+
+	invocations := 0
+	compiler.executor = &MockExecutor{
+		RunFunc: func(command string, args ...string) (*exec.ExecutionResult, error) {
+			invocations++
+			// Produce the output binary like a real compiler would
+			for i, arg := range args {
+				if arg == "-o" && i+1 < len(args) {
+					require.NoError(t, os.WriteFile(args[i+1], []byte("bin"), 0755))
+				}
+			}
+			return &exec.ExecutionResult{ExitCode: 0}, nil
+		},
+	}
+
+	testSeed := &seed.Seed{
+		Meta:    seed.Metadata{ID: 1},
+		Content: "int main() { return 0; }",
+	}
+
+	result, err := compiler.Compile(testSeed)
+	require.NoError(t, err)
+	assert.True(t, result.Success)
+	assert.False(t, result.CacheHit)
+	assert.Equal(t, 1, invocations)
+
+	// Same content under a different seed ID must hit the cache
+	dupSeed := &seed.Seed{
+		Meta:    seed.Metadata{ID: 2},
+		Content: "int main() { return 0; }",
+	}
+
+	result, err = compiler.Compile(dupSeed)
+	require.NoError(t, err)
+	assert.True(t, result.Success)
+	assert.True(t, result.CacheHit)
+	assert.Equal(t, 1, invocations, "cache hit should not invoke the compiler again")
+}
@@ -31,6 +31,7 @@ type CompileResult struct {
 	DroppedLLMCFlags []string          // LLM flags dropped due to profile conflicts
 	LLMCFlagsApplied bool              // Whether seed-provided flags were applied
 	EffectiveFlags   []string          // Full flag list excluding source file and output path
+	CacheHit         bool              // Whether the result came from the compile cache
 }
 
 // Compiler defines the interface for compiling C code.
@@ -45,11 +46,17 @@ type Compiler interface {
 // GCCCompiler implements the Compiler interface using GCC.
 type GCCCompiler struct {
 	executor   exec.Executor
-	gccPath    string   // Path to gcc executable (e.g., "gcc" or "/usr/bin/aarch64-linux-gnu-gcc")
-	workDir    string   // Working directory for compilation
-	prefixPath string   // -B prefix path for compiler components (cc1, as, ld, etc.)
-	cflags     []string // Additional compiler flags as a slice
-	allowLLM   bool     // Whether LLM-provided seed flags are applied
+	gccPath    string        // Path to gcc executable (e.g., "gcc" or "/usr/bin/aarch64-linux-gnu-gcc")
+	workDir    string        // Working directory for compilation
+	prefixPath string        // -B prefix path for compiler components (cc1, as, ld, etc.)
+	cflags     []string      // Additional compiler flags as a slice
+	allowLLM   bool          // Whether LLM-provided seed flags are applied
+	extraEnv   []string      // Extra NAME=value assignments for compiler invocations
+	cache      *compileCache // Content-addressed compile cache (nil = disabled)
+
+	// persistent replays cached `-###` toolchain plans instead of going
+	// through the gcc driver on every compile (nil = disabled).
+	persistent *persistentToolchain
 }
 
 // GCCCompilerConfig holds the configuration for GCCCompiler.
@@ -59,18 +66,34 @@ type GCCCompilerConfig struct {
 	PrefixPath       string   // -B prefix path for finding compiler components (cc1, as, ld)
 	CFlags           []string // Additional compiler flags as a slice
 	DisableLLMCFlags bool     // Disable LLM-provided seed flags for deterministic strategy profiles
+	EnableCache      bool     // Cache compile results keyed by source hash + effective flags
+	PersistentMode   bool     // Replay cached toolchain plans instead of the driver per compile
+
+	// ExtraEnv holds NAME=value assignments the compiler must run under
+	// (e.g. GCOV_PREFIX for per-worker coverage isolation). The invocation
+	// is wrapped in env(1), matching how the persistent toolchain already
+	// threads environment without widening the Executor interface.
+	ExtraEnv []string
 }
 
 // NewGCCCompiler creates a new GCC compiler.
 func NewGCCCompiler(cfg GCCCompilerConfig) *GCCCompiler {
-	return &GCCCompiler{
+	c := &GCCCompiler{
 		executor:   exec.NewCommandExecutor(),
 		gccPath:    cfg.GCCPath,
 		workDir:    cfg.WorkDir,
 		prefixPath: cfg.PrefixPath,
 		cflags:     cfg.CFlags,
 		allowLLM:   !cfg.DisableLLMCFlags,
+		extraEnv:   append([]string(nil), cfg.ExtraEnv...),
 	}
+	if cfg.EnableCache {
+		c.cache = newCompileCache(cfg.WorkDir)
+	}
+	if cfg.PersistentMode {
+		c.persistent = newPersistentToolchain(c.executor, cfg.GCCPath, cfg.WorkDir, c.extraEnv)
+	}
+	return c
 }
 
 // Compile compiles the seed's C source code.
@@ -101,6 +124,29 @@ func (c *GCCCompiler) compile(s *seed.Seed) (*CompileResult, error) {
 	command, args, prefixFlags, effectiveFlags, appliedLLMCFlags, droppedLLMCFlags := c.buildCompileCommand(s, sourceFile, binaryPath)
 	commandString := shellJoin(command, args)
 
+	// Check the compile cache: byte-identical source with identical flags
+	// produces an identical binary, so skip the compiler entirely.
+	var key string
+	if c.cache != nil {
+		key = cacheKey(s.Content, effectiveFlags)
+		if cached, ok := c.cache.Lookup(key); ok {
+			logger.Info("Compile seed %d cache hit (key=%s)", s.Meta.ID, key[:12])
+			cached.Command = commandString
+			cached.CompilerPath = command
+			cached.Args = append([]string(nil), args...)
+			cached.PrefixFlags = append([]string(nil), prefixFlags...)
+			cached.ConfigCFlags = append([]string(nil), c.cflags...)
+			cached.ProfileName = profileName(s.FlagProfile)
+			cached.ProfileFlags = profileFlags(s.FlagProfile)
+			cached.ProfileAxes = profileAxes(s.FlagProfile)
+			cached.SeedCFlags = append([]string(nil), s.CFlags...)
+			cached.AppliedLLMCFlags = append([]string(nil), appliedLLMCFlags...)
+			cached.DroppedLLMCFlags = append([]string(nil), droppedLLMCFlags...)
+			cached.LLMCFlagsApplied = s.LLMCFlagsApplied
+			return cached, nil
+		}
+	}
+
 	logger.Info("Compile seed %d compiler=%s", s.Meta.ID, command)
 	logger.Info("Compile seed %d command=%s", s.Meta.ID, commandString)
 	logger.Info("Compile seed %d prefix_flags=%v", s.Meta.ID, prefixFlags)
@@ -111,8 +157,19 @@ func (c *GCCCompiler) compile(s *seed.Seed) (*CompileResult, error) {
 	logger.Info("Compile seed %d llm_cflags_applied=%t", s.Meta.ID, s.LLMCFlagsApplied)
 	logger.Info("Compile seed %d effective_flags=%v", s.Meta.ID, effectiveFlags)
 
-	// Run GCC
-	result, err := c.executor.Run(command, args...)
+	// Run GCC — through the persistent toolchain when enabled, with the
+	// plain driver as fallback whenever the replay path is unavailable.
+	var result *exec.ExecutionResult
+	var err error
+	if c.persistent != nil {
+		result, err = c.persistent.run(sourceFile, binaryPath, effectiveFlags)
+		if err != nil {
+			logger.Warn("Persistent toolchain unavailable for seed %d, using driver: %v", s.Meta.ID, err)
+			result, err = c.runDriver(command, args...)
+		}
+	} else {
+		result, err = c.runDriver(command, args...)
+	}
 	if err != nil {
 		return &CompileResult{
 			BinaryPath:       binaryPath,
@@ -137,7 +194,7 @@ func (c *GCCCompiler) compile(s *seed.Seed) (*CompileResult, error) {
 
 	success := result.ExitCode == 0
 
-	return &CompileResult{
+	compileResult := &CompileResult{
 		BinaryPath:       binaryPath,
 		Success:          success,
 		Stdout:           result.Stdout,
@@ -155,7 +212,29 @@ func (c *GCCCompiler) compile(s *seed.Seed) (*CompileResult, error) {
 		DroppedLLMCFlags: append([]string(nil), droppedLLMCFlags...),
 		LLMCFlagsApplied: s.LLMCFlagsApplied,
 		EffectiveFlags:   append([]string(nil), effectiveFlags...),
-	}, nil
+	}
+
+	if c.cache != nil {
+		if err := c.cache.Store(key, compileResult); err != nil {
+			logger.Warn("Compile cache: failed to store entry for seed %d: %v", s.Meta.ID, err)
+		}
+	}
+
+	return compileResult, nil
+}
+
+// runDriver invokes the gcc driver, wrapping it in env(1) when extra
+// environment assignments are configured (the Executor interface carries
+// no environment of its own).
+func (c *GCCCompiler) runDriver(command string, args ...string) (*exec.ExecutionResult, error) {
+	if len(c.extraEnv) == 0 {
+		return c.executor.Run(command, args...)
+	}
+	argv := make([]string, 0, len(c.extraEnv)+len(args)+1)
+	argv = append(argv, c.extraEnv...)
+	argv = append(argv, command)
+	argv = append(argv, args...)
+	return c.executor.Run("/usr/bin/env", argv...)
 }
 
 func (c *GCCCompiler) buildCompileCommand(s *seed.Seed, sourceFile, binaryPath string) (string, []string, []string, []string, []string, []string) {
@@ -84,6 +84,41 @@ func TestGCCCompiler_Compile_Success(t *testing.T) {
 	assert.Contains(t, result.BinaryPath, "seed_1")
 }
 
+func TestGCCCompiler_Compile_ExtraEnvWrapsDriver(t *testing.T) {
+	workDir, err := os.MkdirTemp("", "compiler_test_")
+	require.NoError(t, err)
+	defer os.RemoveAll(workDir)
+
+	cfg := GCCCompilerConfig{
+		GCCPath:  "gcc",
+		WorkDir:  workDir,
+		ExtraEnv: []string{"GCOV_PREFIX=/work/worker-0/gcov-prefix", "GCOV_PREFIX_STRIP=0"},
+	}
+	compiler := NewGCCCompiler(cfg)
+
+	compiler.executor = &MockExecutor{
+		RunFunc: func(command string, args ...string) (*exec.ExecutionResult, error) {
+			// The driver runs through env(1) with the assignments first,
+			// then the compiler and its arguments.
+			assert.Equal(t, "/usr/bin/env", command)
+			require.GreaterOrEqual(t, len(args), 3)
+			assert.Equal(t, "GCOV_PREFIX=/work/worker-0/gcov-prefix", args[0])
+			assert.Equal(t, "GCOV_PREFIX_STRIP=0", args[1])
+			assert.Equal(t, "gcc", args[2])
+			return &exec.ExecutionResult{ExitCode: 0}, nil
+		},
+	}
+
+	testSeed := &seed.Seed{
+		Meta:    seed.Metadata{ID: 1},
+		Content: "int main() { return 0; }",
+	}
+
+	result, err := compiler.Compile(testSeed)
+	require.NoError(t, err)
+	assert.True(t, result.Success)
+}
+
 func TestGCCCompiler_Compile_RecordsCommandMetadata(t *testing.T) {
 	workDir := filepath.Join(t.TempDir(), "build dir")
 	require.NoError(t, os.MkdirAll(workDir, 0755))
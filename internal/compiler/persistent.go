@@ -0,0 +1,303 @@
+package compiler
+
+import (
+	"fmt"
+	"path/filepath"
+	"regexp"
+	"strings"
+	"sync"
+
+	"github.com/zjy-dev/de-fuzz/internal/exec"
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+// persistent.go implements the persistent-toolchain compile mode.
+//
+// Every Compile normally goes through the full gcc driver, which re-reads
+// the spec files and re-derives the cc1 / as / collect2 command lines even
+// though our effective flag set barely changes between seeds. Since the
+// instrumented GCC under test is deliberately a slow build, that fixed
+// startup cost recurs thousands of times per campaign.
+//
+// A true AFL-style forkserver (checkpointing cc1 after static init and
+// forking per translation unit) would need a forkserver shim compiled into
+// GCC itself, which this driver does not control. The nearest fit we can
+// implement from outside is to make the *driver* persistent: run
+// `gcc -### <flags>` once per effective flag set, capture the expanded
+// sub-command lines, and replay them directly with the source / output /
+// temp paths substituted. Subsequent compiles with the same flags skip the
+// driver entirely and invoke cc1, the assembler, and the linker back to
+// back.
+//
+// The mode is strictly best-effort: any infrastructure hiccup (a plan
+// that fails to parse, a non-cc1 step exiting non-zero) marks the plan
+// broken and permanently falls the flag set back to the plain driver, so
+// correctness never depends on the replay path.
+
+// placeholder tokens used inside plan argv templates. NUL bytes cannot
+// appear in real command-line arguments, so substitution is unambiguous.
+const (
+	planSrcToken  = "\x00src\x00"
+	planOutToken  = "\x00out\x00"
+	planBaseToken = "\x00base\x00"
+)
+
+// planTmpPattern matches the driver's temp intermediates (/tmp/ccXXXX.s,
+// .o, .res, ...) in the expanded command lines.
+var planTmpPattern = regexp.MustCompile(`^/tmp/cc[^/]*(\.[A-Za-z0-9]+)$`)
+
+// persistentToolchain caches one toolchainPlan per effective flag set.
+type persistentToolchain struct {
+	executor exec.Executor
+	gccPath  string
+	workDir  string
+	// extraEnv carries caller-supplied assignments (e.g. GCOV_PREFIX for
+	// coverage isolation) into every replayed step.
+	extraEnv []string
+
+	mu    sync.Mutex
+	plans map[string]*toolchainPlan
+}
+
+// toolchainPlan is the templated sub-command sequence for one flag set.
+type toolchainPlan struct {
+	mu     sync.Mutex
+	ready  bool
+	broken bool
+	// steps are argv templates; placeholder tokens are substituted per
+	// compile. steps[i][0] is the absolute tool path from the driver.
+	steps [][]string
+	// tmpExts holds the file extension for each temp placeholder index.
+	tmpExts []string
+	// env carries the COMPILER_PATH / LIBRARY_PATH / COLLECT_GCC
+	// assignments the driver would have exported to its children.
+	env []string
+}
+
+func newPersistentToolchain(executor exec.Executor, gccPath, workDir string, extraEnv []string) *persistentToolchain {
+	return &persistentToolchain{
+		executor: executor,
+		gccPath:  gccPath,
+		workDir:  workDir,
+		extraEnv: append([]string(nil), extraEnv...),
+		plans:    make(map[string]*toolchainPlan),
+	}
+}
+
+// run compiles sourceFile into binaryPath by replaying the cached plan for
+// effectiveFlags, expanding it first if this flag set is new. A non-nil
+// error means the persistent path is unavailable (plan broken or
+// un-expandable) and the caller must fall back to the plain driver; a nil
+// error with a non-zero ExitCode is a genuine compile failure.
+func (p *persistentToolchain) run(sourceFile, binaryPath string, effectiveFlags []string) (*exec.ExecutionResult, error) {
+	plan := p.planFor(effectiveFlags)
+
+	plan.mu.Lock()
+	defer plan.mu.Unlock()
+	if plan.broken {
+		return nil, fmt.Errorf("toolchain plan marked broken for this flag set")
+	}
+	if !plan.ready {
+		if err := p.expandPlan(plan, sourceFile, binaryPath, effectiveFlags); err != nil {
+			plan.broken = true
+			return nil, fmt.Errorf("expanding toolchain plan: %w", err)
+		}
+		plan.ready = true
+		logger.Info("Persistent toolchain: cached %d-step plan for flag set %v", len(plan.steps), effectiveFlags)
+	}
+
+	return p.replay(plan, sourceFile, binaryPath)
+}
+
+// planFor returns the (possibly not yet expanded) plan for a flag set.
+func (p *persistentToolchain) planFor(effectiveFlags []string) *toolchainPlan {
+	sig := strings.Join(effectiveFlags, "\x1f")
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	if plan, ok := p.plans[sig]; ok {
+		return plan
+	}
+	plan := &toolchainPlan{}
+	p.plans[sig] = plan
+	return plan
+}
+
+// expandPlan runs `gcc -###` once and templatizes the printed sub-command
+// lines. Caller holds plan.mu.
+func (p *persistentToolchain) expandPlan(plan *toolchainPlan, sourceFile, binaryPath string, effectiveFlags []string) error {
+	args := make([]string, 0, len(effectiveFlags)+4)
+	args = append(args, "-###")
+	args = append(args, effectiveFlags...)
+	args = append(args, sourceFile, "-o", binaryPath)
+
+	result, err := p.executor.Run(p.gccPath, args...)
+	if err != nil {
+		return fmt.Errorf("running %s -###: %w", p.gccPath, err)
+	}
+	if result.ExitCode != 0 {
+		return fmt.Errorf("%s -### exited %d: %s", p.gccPath, result.ExitCode, result.Stderr)
+	}
+
+	base := strings.TrimSuffix(filepath.Base(sourceFile), filepath.Ext(sourceFile))
+	tmpByPath := make(map[string]string)
+
+	for _, line := range strings.Split(result.Stderr, "\n") {
+		trimmed := strings.TrimSpace(line)
+		switch {
+		case strings.HasPrefix(trimmed, "COMPILER_PATH="),
+			strings.HasPrefix(trimmed, "LIBRARY_PATH="):
+			// The driver exports these to collect2; replay needs them too.
+			plan.env = append(plan.env, trimmed)
+			continue
+		case !strings.HasPrefix(trimmed, "\""):
+			// Version banner, COLLECT_GCC_OPTIONS, blank lines.
+			continue
+		}
+
+		argv, perr := parseQuotedArgv(trimmed)
+		if perr != nil {
+			return fmt.Errorf("parsing driver command %q: %w", trimmed, perr)
+		}
+		if len(argv) == 0 {
+			continue
+		}
+		step := make([]string, len(argv))
+		for i, tok := range argv {
+			step[i] = templatizeToken(tok, sourceFile, binaryPath, base, tmpByPath, plan)
+		}
+		plan.steps = append(plan.steps, step)
+	}
+
+	if len(plan.steps) == 0 {
+		return fmt.Errorf("no sub-commands found in -### output")
+	}
+	// collect2 re-invokes the driver for some link modes; it locates it
+	// via COLLECT_GCC.
+	plan.env = append(plan.env, "COLLECT_GCC="+p.gccPath)
+	plan.env = append(plan.env, p.extraEnv...)
+	return nil
+}
+
+// templatizeToken rewrites one expanded-command token into its template
+// form, registering temp intermediates as it goes.
+func templatizeToken(tok, sourceFile, binaryPath, base string, tmpByPath map[string]string, plan *toolchainPlan) string {
+	switch tok {
+	case sourceFile:
+		return planSrcToken
+	case binaryPath:
+		return planOutToken
+	}
+	if m := planTmpPattern.FindStringSubmatch(tok); m != nil {
+		if ph, ok := tmpByPath[tok]; ok {
+			return ph
+		}
+		ph := fmt.Sprintf("\x00tmp%d\x00", len(plan.tmpExts))
+		plan.tmpExts = append(plan.tmpExts, m[1])
+		tmpByPath[tok] = ph
+		return ph
+	}
+	// -dumpbase / -dumpdir style arguments embed the source basename.
+	if base != "" && strings.Contains(tok, base) {
+		return strings.ReplaceAll(tok, base, planBaseToken)
+	}
+	return tok
+}
+
+// replay substitutes the per-compile paths into the plan and runs the
+// steps in order. Caller holds plan.mu (replay shares the plan's temp
+// file names, so two concurrent compiles of the same flag set must not
+// interleave).
+func (p *persistentToolchain) replay(plan *toolchainPlan, sourceFile, binaryPath string) (*exec.ExecutionResult, error) {
+	base := strings.TrimSuffix(filepath.Base(sourceFile), filepath.Ext(sourceFile))
+	tmpPaths := make([]string, len(plan.tmpExts))
+	for i, ext := range plan.tmpExts {
+		tmpPaths[i] = filepath.Join(p.workDir, fmt.Sprintf("%s_pt%d%s", base, i, ext))
+	}
+
+	expand := func(tok string) string {
+		tok = strings.ReplaceAll(tok, planSrcToken, sourceFile)
+		tok = strings.ReplaceAll(tok, planOutToken, binaryPath)
+		tok = strings.ReplaceAll(tok, planBaseToken, base)
+		for i, tmp := range tmpPaths {
+			tok = strings.ReplaceAll(tok, fmt.Sprintf("\x00tmp%d\x00", i), tmp)
+		}
+		return tok
+	}
+
+	combined := &exec.ExecutionResult{}
+	for _, step := range plan.steps {
+		argv := make([]string, 0, len(plan.env)+len(step))
+		argv = append(argv, plan.env...)
+		for _, tok := range step {
+			argv = append(argv, expand(tok))
+		}
+
+		// Run through env(1) so the driver-exported assignments reach
+		// collect2 without widening the Executor interface.
+		result, err := p.executor.Run("/usr/bin/env", argv...)
+		if err != nil {
+			plan.broken = true
+			return nil, fmt.Errorf("running %s: %w", expand(step[0]), err)
+		}
+		combined.Stdout += result.Stdout
+		combined.Stderr += result.Stderr
+		if result.ExitCode != 0 {
+			if isCompilerProperStep(step[0]) {
+				// cc1 rejected the translation unit: a genuine compile
+				// error, reported exactly like the driver would.
+				combined.ExitCode = result.ExitCode
+				return combined, nil
+			}
+			// Assembler / linker failures on LLM-generated C are an
+			// infrastructure smell, not a seed property: retire the plan.
+			plan.broken = true
+			return nil, fmt.Errorf("step %s exited %d: %s", expand(step[0]), result.ExitCode, result.Stderr)
+		}
+	}
+	return combined, nil
+}
+
+// isCompilerProperStep reports whether a plan step is the compiler proper
+// (cc1 / cc1plus), whose non-zero exit means the source itself is bad.
+func isCompilerProperStep(tool string) bool {
+	name := filepath.Base(tool)
+	return name == "cc1" || name == "cc1plus"
+}
+
+// parseQuotedArgv splits one `-###` output line into argv tokens. The
+// driver double-quotes every token and escapes embedded quotes with a
+// backslash.
+func parseQuotedArgv(line string) ([]string, error) {
+	var argv []string
+	i := 0
+	for i < len(line) {
+		switch line[i] {
+		case ' ', '\t':
+			i++
+		case '"':
+			i++
+			var b strings.Builder
+			for {
+				if i >= len(line) {
+					return nil, fmt.Errorf("unterminated quote")
+				}
+				c := line[i]
+				if c == '\\' && i+1 < len(line) {
+					b.WriteByte(line[i+1])
+					i += 2
+					continue
+				}
+				if c == '"' {
+					i++
+					break
+				}
+				b.WriteByte(c)
+				i++
+			}
+			argv = append(argv, b.String())
+		default:
+			return nil, fmt.Errorf("unexpected character %q at offset %d", line[i], i)
+		}
+	}
+	return argv, nil
+}
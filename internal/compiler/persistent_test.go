@@ -0,0 +1,171 @@
+package compiler
+
+import (
+	"fmt"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+	"github.com/zjy-dev/de-fuzz/internal/exec"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// fakeDriverOutput mimics `gcc -###` stderr for a three-step compile of
+// /work/seed_1.c into /work/seed_1.
+const fakeDriverOutput = `Using built-in specs.
+COLLECT_GCC_OPTIONS='-o' '/work/seed_1'
+ "/usr/libexec/gcc/cc1" "-quiet" "-dumpbase" "seed_1.c" "-dumpbase-ext" ".c" "/work/seed_1.c" "-o" "/tmp/ccAbc123.s"
+COMPILER_PATH=/usr/libexec/gcc/
+LIBRARY_PATH=/usr/lib/
+ "/usr/bin/as" "-o" "/tmp/ccDef456.o" "/tmp/ccAbc123.s"
+ "/usr/libexec/gcc/collect2" "-o" "/work/seed_1" "/tmp/ccDef456.o"
+`
+
+// recordingExecutor answers -### with the canned expansion and records
+// every other invocation.
+type recordingExecutor struct {
+	expandCalls int
+	runs        [][]string
+	stepResult  func(argv []string) *exec.ExecutionResult
+}
+
+func (r *recordingExecutor) Run(command string, args ...string) (*exec.ExecutionResult, error) {
+	if len(args) > 0 && args[0] == "-###" {
+		r.expandCalls++
+		return &exec.ExecutionResult{ExitCode: 0, Stderr: fakeDriverOutput}, nil
+	}
+	argv := append([]string{command}, args...)
+	r.runs = append(r.runs, argv)
+	if r.stepResult != nil {
+		return r.stepResult(argv), nil
+	}
+	return &exec.ExecutionResult{ExitCode: 0}, nil
+}
+
+func TestParseQuotedArgv(t *testing.T) {
+	argv, err := parseQuotedArgv(`"/usr/bin/as" "-o" "a b" "quo\"te"`)
+	require.NoError(t, err)
+	assert.Equal(t, []string{"/usr/bin/as", "-o", "a b", `quo"te`}, argv)
+
+	_, err = parseQuotedArgv(`"unterminated`)
+	assert.Error(t, err)
+}
+
+func TestPersistentToolchain_ExpandOncePerFlagSet(t *testing.T) {
+	rec := &recordingExecutor{}
+	pt := newPersistentToolchain(rec, "gcc", "/work", nil)
+
+	flags := []string{"-O0", "-fstack-protector-strong"}
+	_, err := pt.run("/work/seed_1.c", "/work/seed_1", flags)
+	require.NoError(t, err)
+	_, err = pt.run("/work/seed_2.c", "/work/seed_2", flags)
+	require.NoError(t, err)
+
+	assert.Equal(t, 1, rec.expandCalls, "one -### expansion per flag set")
+	// 3 steps per compile, 2 compiles.
+	require.Len(t, rec.runs, 6)
+
+	// Steps run through env(1) with the driver-exported assignments.
+	first := rec.runs[0]
+	assert.Equal(t, "/usr/bin/env", first[0])
+	assert.Contains(t, first, "COMPILER_PATH=/usr/libexec/gcc/")
+	assert.Contains(t, first, "LIBRARY_PATH=/usr/lib/")
+	assert.Contains(t, first, "COLLECT_GCC=gcc")
+
+	// Second compile must see its own paths, not the template seed's.
+	joined := strings.Join(rec.runs[3], " ")
+	assert.Contains(t, joined, "/work/seed_2.c")
+	assert.Contains(t, joined, "seed_2.c", "dumpbase follows the new source")
+	assert.NotContains(t, joined, "seed_1")
+	assert.NotContains(t, joined, "/tmp/ccAbc123.s", "temp files are re-homed per compile")
+
+	// The link step targets the new binary.
+	link := strings.Join(rec.runs[5], " ")
+	assert.Contains(t, link, "/work/seed_2")
+}
+
+func TestPersistentToolchain_ExtraEnvReachesReplay(t *testing.T) {
+	rec := &recordingExecutor{}
+	pt := newPersistentToolchain(rec, "gcc", "/work", []string{"GCOV_PREFIX=/work/gcov-prefix"})
+
+	_, err := pt.run("/work/seed_1.c", "/work/seed_1", []string{"-O0"})
+	require.NoError(t, err)
+	require.NotEmpty(t, rec.runs)
+	assert.Contains(t, rec.runs[0], "GCOV_PREFIX=/work/gcov-prefix",
+		"caller-supplied assignments must reach every replayed step")
+}
+
+func TestPersistentToolchain_CC1FailureIsCompileError(t *testing.T) {
+	rec := &recordingExecutor{}
+	rec.stepResult = func(argv []string) *exec.ExecutionResult {
+		for _, a := range argv {
+			if strings.HasSuffix(a, "/cc1") {
+				return &exec.ExecutionResult{ExitCode: 1, Stderr: "error: expected ';'"}
+			}
+		}
+		return &exec.ExecutionResult{ExitCode: 0}
+	}
+	pt := newPersistentToolchain(rec, "gcc", "/work", nil)
+
+	result, err := pt.run("/work/seed_1.c", "/work/seed_1", []string{"-O0"})
+	require.NoError(t, err, "cc1 rejecting the source is a compile failure, not an infra error")
+	assert.NotEqual(t, 0, result.ExitCode)
+	assert.Contains(t, result.Stderr, "expected ';'")
+
+	// The plan must survive a compile error.
+	_, err = pt.run("/work/seed_2.c", "/work/seed_2", []string{"-O0"})
+	require.NoError(t, err)
+	assert.Equal(t, 1, rec.expandCalls)
+}
+
+func TestPersistentToolchain_LinkFailureBreaksPlan(t *testing.T) {
+	rec := &recordingExecutor{}
+	rec.stepResult = func(argv []string) *exec.ExecutionResult {
+		for _, a := range argv {
+			if strings.HasSuffix(a, "/collect2") {
+				return &exec.ExecutionResult{ExitCode: 1, Stderr: "ld: cannot find -lc"}
+			}
+		}
+		return &exec.ExecutionResult{ExitCode: 0}
+	}
+	pt := newPersistentToolchain(rec, "gcc", "/work", nil)
+
+	_, err := pt.run("/work/seed_1.c", "/work/seed_1", []string{"-O0"})
+	require.Error(t, err, "non-cc1 step failure must surface as infra error for driver fallback")
+
+	// Broken plans stay broken: later compiles of this flag set go
+	// straight back to the caller for the driver path.
+	_, err = pt.run("/work/seed_2.c", "/work/seed_2", []string{"-O0"})
+	assert.Error(t, err)
+	assert.Equal(t, 1, rec.expandCalls, "no re-expansion of a broken plan")
+}
+
+func TestGCCCompiler_PersistentModeFallsBackToDriver(t *testing.T) {
+	workDir := t.TempDir()
+
+	var driverRuns int
+	cfg := GCCCompilerConfig{GCCPath: "gcc", WorkDir: workDir, PersistentMode: true}
+	c := NewGCCCompiler(cfg)
+	c.executor = &MockExecutor{
+		RunFunc: func(command string, args ...string) (*exec.ExecutionResult, error) {
+			if len(args) > 0 && args[0] == "-###" {
+				// Expansion fails: plan cannot be built.
+				return nil, fmt.Errorf("spawn failed")
+			}
+			driverRuns++
+			assert.Equal(t, "gcc", command)
+			return &exec.ExecutionResult{ExitCode: 0}, nil
+		},
+	}
+	c.persistent = newPersistentToolchain(c.executor, "gcc", workDir, nil)
+
+	testSeed := &seed.Seed{
+		Meta:    seed.Metadata{ID: 1},
+		Content: "int main() { return 0; }",
+	}
+	result, err := c.Compile(testSeed)
+	require.NoError(t, err)
+	assert.True(t, result.Success)
+	assert.Equal(t, 1, driverRuns, "driver path must carry the compile when replay is unavailable")
+}
@@ -61,6 +61,11 @@ type FuzzConfig struct {
 	// QEMUSysroot is the sysroot path for QEMU (-L argument)
 	QEMUSysroot string `mapstructure:"qemu_sysroot"`
 
+	// QEMUForkserver enables the persistent guest-side execution server:
+	// qemu is started once per campaign and oracle runs are dispatched to it
+	// as fork-per-job requests, avoiding per-execution emulator startup cost
+	QEMUForkserver bool `mapstructure:"qemu_forkserver"`
+
 	// CFGFilePath is the path to the GCC CFG dump file (optional, single file - backward compat)
 	// Used for CFG-guided coverage analysis and target function tracking
 	// Example: "/path/to/gcc-build/gcc/cfgexpand.cc.015t.cfg"
@@ -80,12 +85,38 @@ type FuzzConfig struct {
 	// per target basic block when constraint solving fails (default: 3)
 	MaxConstraintRetries int `mapstructure:"max_constraint_retries"`
 
+	// CandidatesPerPrompt is the number of candidate seeds sampled per
+	// constraint-solving prompt in a single LLM request (default: 1).
+	// Requires an OpenAI-compatible backend that supports n>1 sampling.
+	CandidatesPerPrompt int `mapstructure:"candidates_per_prompt"`
+
+	// PromptTokenBudget caps the approximate token count of each code block
+	// embedded in a user prompt; longer blocks are trimmed in the middle.
+	// 0 (the default) sends code blocks whole.
+	PromptTokenBudget int `mapstructure:"prompt_token_budget"`
+
 	// WeightDecayFactor is the multiplier applied to BB weight after failed iteration
 	// Valid range: (0, 1], default: 0.8
 	WeightDecayFactor float64 `mapstructure:"weight_decay_factor"`
 
 	// FlagStrategy controls rule-driven compiler flag scheduling during fuzzing.
 	FlagStrategy FlagStrategyConfig `mapstructure:"flag_strategy"`
+
+	// Workers is the number of concurrent target-solving workers (default: 1).
+	// Values > 1 enable the parallel fuzzing mode where LLM round-trips for
+	// several targets overlap; each worker gets its own compile directory.
+	Workers int `mapstructure:"workers"`
+
+	// MetricsAddr, when set (e.g. "127.0.0.1:9920"), exposes per-stage
+	// latency histograms and event counters at /metrics in Prometheus text
+	// format and logs a periodic one-line summary. Empty disables both.
+	MetricsAddr string `mapstructure:"metrics_addr"`
+
+	// CorpusFormat selects the on-disk corpus layout: "dir" (default) keeps
+	// one directory per seed, "packed" stores all seeds in a single
+	// append-only data file plus an index for sub-second recovery on large
+	// or network-backed corpora.
+	CorpusFormat string `mapstructure:"corpus_format"`
 }
 
 // CompilerInfo holds basic compiler identification from the main config.
@@ -129,6 +160,12 @@ type CompilerConfig struct {
 	// GcovrExecPath is the path to gcovr executable for coverage analysis
 	GcovrExecPath string `mapstructure:"gcovr_exec_path"`
 
+	// GcovPath is the gcov executable matching the instrumented compiler
+	// (e.g., gcov-14). When set, coverage measurement runs gcov
+	// --json-format once and ingests its JSON in-process instead of
+	// shelling out to the gcovr Python tool; gcovr stays as the fallback
+	GcovPath string `mapstructure:"gcov_path"`
+
 	// SourceParentPath is the parent directory of source files for coverage reporting
 	SourceParentPath string `mapstructure:"source_parent_path"`
 
@@ -140,6 +177,23 @@ type CompilerConfig struct {
 	// Example: ["-fstack-protector-strong", "-O0", "-B/path/to/lib"]
 	CFlags []string `mapstructure:"cflags"`
 
+	// CompileCache enables the content-addressed compile result cache,
+	// keyed on source hash + effective flags and persisted under the
+	// build directory. Skips the cross-compiler for duplicate LLM outputs.
+	CompileCache bool `mapstructure:"compile_cache"`
+
+	// PersistentToolchain caches the gcc driver's expanded sub-command
+	// lines (`gcc -###`) per effective flag set and replays cc1/as/link
+	// directly on later compiles, skipping driver startup and spec
+	// processing. Falls back to the plain driver on any replay problem.
+	PersistentToolchain bool `mapstructure:"persistent_toolchain"`
+
+	// CoverageIsolation gives each parallel worker its own GCOV_PREFIX
+	// directory, so the instrumented compiler's .gcda counters no longer
+	// collide in the shared build tree and compile+measure cycles overlap.
+	// Only takes effect when fuzz.workers > 1.
+	CoverageIsolation bool `mapstructure:"coverage_isolation"`
+
 	// TotalReportPath is the path to store accumulated coverage report (optional)
 	// If empty, defaults to {output_dir}/state/total.json for resume capability
 	// This file is critical for checkpointing: it stores accumulated coverage data
@@ -419,6 +473,15 @@ func Load(configFileName string, result interface{}) error {
 
 // LoadConfig loads the entire application configuration from all sources.
 func LoadConfig() (*Config, error) {
+	return LoadConfigForISA("")
+}
+
+// LoadConfigForISA loads the configuration like LoadConfig, but with the
+// ISA overridden (empty keeps the config.yaml value). The override is
+// applied before the compiler config lookup, so it selects that ISA's
+// compiler config file — the orchestrator uses this to build several
+// per-arch campaigns from one config tree.
+func LoadConfigForISA(isa string) (*Config, error) {
 	var cfg Config
 
 	// Load environment variables from .env file if present
@@ -444,6 +507,9 @@ func LoadConfig() (*Config, error) {
 
 	// Parse the main config fields (ISA, Strategy, Compiler info)
 	cfg.ISA = v.GetString("config.isa")
+	if isa != "" {
+		cfg.ISA = isa
+	}
 	cfg.Strategy = v.GetString("config.strategy")
 	cfg.LogLevel = v.GetString("config.log_level")
 	cfg.LogDir = v.GetString("config.log_dir")
@@ -520,6 +586,12 @@ func LoadConfig() (*Config, error) {
 	if cfg.Compiler.Fuzz.MaxConstraintRetries == 0 {
 		cfg.Compiler.Fuzz.MaxConstraintRetries = 32
 	}
+	if cfg.Compiler.Fuzz.Workers <= 0 {
+		cfg.Compiler.Fuzz.Workers = 1
+	}
+	if cfg.Compiler.Fuzz.CandidatesPerPrompt <= 0 {
+		cfg.Compiler.Fuzz.CandidatesPerPrompt = 1
+	}
 	if cfg.Compiler.Fuzz.WeightDecayFactor <= 0 || cfg.Compiler.Fuzz.WeightDecayFactor > 1 {
 		cfg.Compiler.Fuzz.WeightDecayFactor = 0.8
 	}
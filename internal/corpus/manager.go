@@ -95,7 +95,7 @@ func NewFileManager(baseDir string) *FileManager {
 		corpusDir:    filepath.Join(baseDir, CorpusDir),
 		metadataDir:  filepath.Join(baseDir, MetadataDir),
 		stateDir:     stateDir,
-		stateManager: state.NewFileManager(stateDir),
+		stateManager: state.NewJournaledFileManager(stateDir),
 		namer:        seed.NewDefaultNamingStrategy(),
 		queue:        make([]*seed.Seed, 0),
 		processed:    make(map[uint64]*seed.Seed),
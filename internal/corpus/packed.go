@@ -0,0 +1,521 @@
+package corpus
+
+import (
+	"bufio"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"sync"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+	"github.com/zjy-dev/de-fuzz/internal/state"
+)
+
+const (
+	// PackDataFile is the append-only file holding packed seed payloads.
+	PackDataFile = "corpus.pack"
+	// PackIndexFile is the append-only index file (one JSON line per
+	// entry; the last line for a given ID wins).
+	PackIndexFile = "corpus.idx"
+)
+
+// packedPayload is the on-disk record appended to the data file for each
+// seed. Metadata lives in the index, so payloads never need rewriting.
+type packedPayload struct {
+	Content     string            `json:"content"`
+	TestCases   []seed.TestCase   `json:"test_cases,omitempty"`
+	CFlags      []string          `json:"cflags,omitempty"`
+	FlagProfile *seed.FlagProfile `json:"flag_profile,omitempty"`
+}
+
+// packedEntry is one index line: where the payload lives in the data file
+// plus the full seed metadata. Metadata updates (ReportResult) append a
+// new line reusing the same offset/length.
+type packedEntry struct {
+	Offset int64         `json:"offset"`
+	Length int64         `json:"length"`
+	Meta   seed.Metadata `json:"meta"`
+}
+
+// PackedManager is a corpus Manager backed by a single append-only data
+// file plus a compact index, instead of one directory per seed.
+//
+// The directory-per-seed layout used by FileManager opens three or four
+// files per seed on recovery; with tens of thousands of seeds on an
+// NFS-backed volume that turns Recover() into minutes of metadata RPCs.
+// PackedManager recovers by reading the index file sequentially (one open,
+// one pass) and loads seed contents lazily via pread when a seed is
+// actually dequeued, so startup cost is proportional to index size, not
+// corpus size.
+//
+// Per-seed artifacts that piggyback on the directory layout (compilation
+// records next to source.c, the CovIncrease directory rename) do not
+// apply here; use ExportDirectoryLayout to materialize the legacy layout
+// for human inspection.
+type PackedManager struct {
+	mu           sync.Mutex
+	baseDir      string
+	packPath     string
+	idxPath      string
+	stateDir     string
+	stateManager *state.FileManager
+	namer        seed.NamingStrategy
+
+	dataFile *os.File // opened O_APPEND for writes, ReadAt for reads
+	idxFile  *os.File // opened O_APPEND
+	dataSize int64    // next append offset
+
+	entries   map[uint64]packedEntry // every seed ever packed
+	queue     []*seed.Seed           // pending seeds (content loaded lazily)
+	processed map[uint64]*seed.Seed  // seeds handed out via Next
+}
+
+// NewPackedManager creates a corpus manager using the packed format.
+func NewPackedManager(baseDir string) *PackedManager {
+	stateDir := filepath.Join(baseDir, StateDir)
+	return &PackedManager{
+		baseDir:      baseDir,
+		packPath:     filepath.Join(baseDir, PackDataFile),
+		idxPath:      filepath.Join(baseDir, PackIndexFile),
+		stateDir:     stateDir,
+		stateManager: state.NewJournaledFileManager(stateDir),
+		namer:        seed.NewDefaultNamingStrategy(),
+		entries:      make(map[uint64]packedEntry),
+		processed:    make(map[uint64]*seed.Seed),
+	}
+}
+
+// Initialize prepares the directory structure and opens the pack files.
+func (m *PackedManager) Initialize() error {
+	if err := os.MkdirAll(m.stateDir, 0755); err != nil {
+		return fmt.Errorf("failed to create directory %s: %w", m.stateDir, err)
+	}
+
+	if err := m.openFiles(); err != nil {
+		return err
+	}
+
+	if err := m.stateManager.Load(); err != nil {
+		return fmt.Errorf("failed to load state: %w", err)
+	}
+
+	return nil
+}
+
+// openFiles opens (creating if needed) the data and index files.
+func (m *PackedManager) openFiles() error {
+	if m.dataFile != nil {
+		return nil
+	}
+
+	dataFile, err := os.OpenFile(m.packPath, os.O_RDWR|os.O_CREATE|os.O_APPEND, 0644)
+	if err != nil {
+		return fmt.Errorf("failed to open pack data file %s: %w", m.packPath, err)
+	}
+	info, err := dataFile.Stat()
+	if err != nil {
+		dataFile.Close()
+		return fmt.Errorf("failed to stat pack data file %s: %w", m.packPath, err)
+	}
+
+	idxFile, err := os.OpenFile(m.idxPath, os.O_WRONLY|os.O_CREATE|os.O_APPEND, 0644)
+	if err != nil {
+		dataFile.Close()
+		return fmt.Errorf("failed to open pack index file %s: %w", m.idxPath, err)
+	}
+
+	m.dataFile = dataFile
+	m.idxFile = idxFile
+	m.dataSize = info.Size()
+	return nil
+}
+
+// Recover rebuilds the in-memory index and queue from the index file.
+// Unlike FileManager.Recover it reads a single file and does not touch
+// seed contents; those are pread on demand.
+func (m *PackedManager) Recover() error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	if err := m.stateManager.Load(); err != nil {
+		return fmt.Errorf("failed to load state: %w", err)
+	}
+
+	if err := m.openFiles(); err != nil {
+		return err
+	}
+
+	entries, err := m.loadIndex()
+	if err != nil {
+		return err
+	}
+	m.entries = entries
+
+	m.queue = make([]*seed.Seed, 0)
+	m.processed = make(map[uint64]*seed.Seed)
+
+	pendingCount := 0
+	for _, e := range entries {
+		if e.Meta.State == seed.SeedStatePending {
+			// Content is loaded lazily in Next/Get.
+			m.queue = append(m.queue, &seed.Seed{Meta: e.Meta})
+			pendingCount++
+		}
+	}
+
+	sort.Slice(m.queue, func(i, j int) bool {
+		return m.queue[i].Meta.ID < m.queue[j].Meta.ID
+	})
+
+	m.stateManager.UpdatePoolSize(len(m.queue))
+
+	totalSeeds := len(entries)
+	processedCount := totalSeeds - pendingCount
+
+	if totalSeeds == 0 {
+		logger.Info("[FRESH START] No seeds found in packed corpus, starting fresh")
+	} else if processedCount == 0 && pendingCount > 0 {
+		logger.Info("[FRESH START] Found %d initial seeds in packed corpus, no previous run detected", pendingCount)
+	} else if pendingCount > 0 {
+		logger.Info("[RESUME] Resuming from packed corpus: %d seeds (%d processed, %d pending)",
+			totalSeeds, processedCount, pendingCount)
+	} else {
+		logger.Info("[RESUME] All %d packed seeds already processed, ready for constraint solving", totalSeeds)
+	}
+
+	return nil
+}
+
+// loadIndex reads the index file sequentially; the last line per ID wins.
+func (m *PackedManager) loadIndex() (map[uint64]packedEntry, error) {
+	entries := make(map[uint64]packedEntry)
+
+	f, err := os.Open(m.idxPath)
+	if err != nil {
+		if os.IsNotExist(err) {
+			return entries, nil
+		}
+		return nil, fmt.Errorf("failed to open pack index file %s: %w", m.idxPath, err)
+	}
+	defer f.Close()
+
+	scanner := bufio.NewScanner(f)
+	scanner.Buffer(make([]byte, 0, 64*1024), 4<<20)
+	for scanner.Scan() {
+		line := scanner.Bytes()
+		if len(line) == 0 {
+			continue
+		}
+		var e packedEntry
+		if err := json.Unmarshal(line, &e); err != nil {
+			// A torn final line after a crash is expected; skip it.
+			logger.Warn("Skipping unparseable pack index line: %v", err)
+			continue
+		}
+		entries[e.Meta.ID] = e
+	}
+	if err := scanner.Err(); err != nil {
+		return nil, fmt.Errorf("failed to read pack index file %s: %w", m.idxPath, err)
+	}
+
+	return entries, nil
+}
+
+// appendPayload appends a payload record to the data file and returns its
+// offset and length. Caller must hold m.mu.
+func (m *PackedManager) appendPayload(s *seed.Seed) (offset, length int64, err error) {
+	payload := packedPayload{
+		Content:     s.Content,
+		TestCases:   s.TestCases,
+		CFlags:      s.CFlags,
+		FlagProfile: s.FlagProfile,
+	}
+	data, err := json.Marshal(payload)
+	if err != nil {
+		return 0, 0, fmt.Errorf("failed to marshal seed payload: %w", err)
+	}
+
+	offset = m.dataSize
+	n, err := m.dataFile.Write(data)
+	if err != nil {
+		return 0, 0, fmt.Errorf("failed to append to pack data file: %w", err)
+	}
+	m.dataSize += int64(n)
+	return offset, int64(n), nil
+}
+
+// appendIndexEntry appends an index line for e. Caller must hold m.mu.
+func (m *PackedManager) appendIndexEntry(e packedEntry) error {
+	line, err := json.Marshal(e)
+	if err != nil {
+		return fmt.Errorf("failed to marshal pack index entry: %w", err)
+	}
+	line = append(line, '\n')
+	if _, err := m.idxFile.Write(line); err != nil {
+		return fmt.Errorf("failed to append to pack index file: %w", err)
+	}
+	m.entries[e.Meta.ID] = e
+	return nil
+}
+
+// loadPayload reads a seed's payload from the data file via ReadAt (pread).
+// Caller must hold m.mu.
+func (m *PackedManager) loadPayload(e packedEntry) (*seed.Seed, error) {
+	buf := make([]byte, e.Length)
+	if _, err := m.dataFile.ReadAt(buf, e.Offset); err != nil {
+		return nil, fmt.Errorf("failed to read packed seed %d: %w", e.Meta.ID, err)
+	}
+	var payload packedPayload
+	if err := json.Unmarshal(buf, &payload); err != nil {
+		return nil, fmt.Errorf("failed to unmarshal packed seed %d: %w", e.Meta.ID, err)
+	}
+	return &seed.Seed{
+		Meta:        e.Meta,
+		Content:     payload.Content,
+		TestCases:   payload.TestCases,
+		CFlags:      payload.CFlags,
+		FlagProfile: payload.FlagProfile,
+	}, nil
+}
+
+// Add appends a new seed to the pack and adds it to the processing queue.
+func (m *PackedManager) Add(s *seed.Seed) error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	if s.Meta.ID == 0 {
+		s.Meta.ID = m.stateManager.NextID()
+	}
+
+	s.Meta.State = seed.SeedStatePending
+
+	if s.Meta.Depth == 0 && s.Meta.ParentID > 0 {
+		if parent, ok := m.processed[s.Meta.ParentID]; ok {
+			s.Meta.Depth = parent.Meta.Depth + 1
+		} else {
+			s.Meta.Depth = 1 // Default to 1 if parent not found
+		}
+	}
+
+	// Packed seeds have no per-seed files; FilePath carries the logical
+	// name for humans reading the index.
+	s.Meta.FileSize = int64(len(s.Content))
+	s.Meta.ContentHash = seed.GenerateContentHash(s.Content)
+	s.Meta.FilePath = fmt.Sprintf("pack:id-%06d", s.Meta.ID)
+
+	offset, length, err := m.appendPayload(s)
+	if err != nil {
+		return err
+	}
+	if err := m.appendIndexEntry(packedEntry{Offset: offset, Length: length, Meta: s.Meta}); err != nil {
+		return err
+	}
+
+	m.queue = append(m.queue, s)
+	m.stateManager.UpdatePoolSize(len(m.queue))
+
+	return nil
+}
+
+// AllocateID allocates and returns the next unique seed ID without persisting.
+func (m *PackedManager) AllocateID() uint64 {
+	return m.stateManager.NextID()
+}
+
+// Next retrieves the next seed to process from the queue, loading its
+// content from the pack if it was recovered lazily.
+func (m *PackedManager) Next() (*seed.Seed, bool) {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	if len(m.queue) == 0 {
+		return nil, false
+	}
+
+	s := m.queue[0]
+	m.queue = m.queue[1:]
+
+	if s.Content == "" {
+		if e, ok := m.entries[s.Meta.ID]; ok {
+			loaded, err := m.loadPayload(e)
+			if err != nil {
+				logger.Warn("Failed to load packed seed %d: %v", s.Meta.ID, err)
+			} else {
+				loaded.Meta = s.Meta
+				s = loaded
+			}
+		}
+	}
+
+	m.stateManager.UpdateCurrentID(s.Meta.ID)
+	m.stateManager.UpdatePoolSize(len(m.queue))
+
+	m.processed[s.Meta.ID] = s
+
+	return s, true
+}
+
+// Get retrieves a seed by ID, falling back to a pread from the pack for
+// seeds that are not resident in memory.
+func (m *PackedManager) Get(id uint64) (*seed.Seed, error) {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	if s, ok := m.processed[id]; ok {
+		return s, nil
+	}
+
+	for _, s := range m.queue {
+		if s.Meta.ID == id {
+			return s, nil
+		}
+	}
+
+	if e, ok := m.entries[id]; ok {
+		return m.loadPayload(e)
+	}
+
+	return nil, fmt.Errorf("seed %d not found in corpus", id)
+}
+
+// ReportResult updates a seed's metadata after fuzzing by appending a new
+// index entry; the payload is immutable and stays where it is.
+func (m *PackedManager) ReportResult(id uint64, result FuzzResult) error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	s, ok := m.processed[id]
+	if !ok {
+		s = &seed.Seed{Meta: seed.Metadata{ID: id}}
+		m.processed[id] = s
+	}
+
+	s.Meta.State = result.State
+	s.Meta.OldCoverage = result.OldCoverage
+	s.Meta.NewCoverage = result.NewCoverage
+
+	if result.NewCoverage > result.OldCoverage {
+		s.Meta.CovIncrease = result.NewCoverage - result.OldCoverage
+	} else {
+		s.Meta.CovIncrease = 0
+	}
+
+	s.Meta.OracleVerdict = result.OracleVerdict
+	s.Meta.BugType = result.BugType
+	s.Meta.BugDescription = result.BugDescription
+
+	logger.Debug("ReportResult: seed %d oracle_verdict=%q", id, s.Meta.OracleVerdict)
+
+	if e, ok := m.entries[id]; ok {
+		e.Meta = s.Meta
+		if err := m.appendIndexEntry(e); err != nil {
+			logger.Warn("Failed to update pack index for seed %d: %v", id, err)
+		}
+	}
+
+	m.stateManager.IncrementProcessed()
+	if result.NewCoverage > m.stateManager.GetState().TotalCoverage {
+		m.stateManager.UpdateCoverage(result.NewCoverage)
+	}
+
+	return nil
+}
+
+// Len returns the number of seeds in the queue.
+func (m *PackedManager) Len() int {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	return len(m.queue)
+}
+
+// Save persists the current state and flushes the pack files.
+func (m *PackedManager) Save() error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	if m.dataFile != nil {
+		if err := m.dataFile.Sync(); err != nil {
+			return fmt.Errorf("failed to sync pack data file: %w", err)
+		}
+	}
+	if m.idxFile != nil {
+		if err := m.idxFile.Sync(); err != nil {
+			return fmt.Errorf("failed to sync pack index file: %w", err)
+		}
+	}
+
+	return m.stateManager.Save()
+}
+
+// Finalize updates the global state when fuzzing completes.
+func (m *PackedManager) Finalize() error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	m.stateManager.UpdatePoolSize(0)
+	m.stateManager.UpdateCurrentID(0)
+	return m.stateManager.Save()
+}
+
+// UpdateTotalCoverage updates the total coverage in global state.
+func (m *PackedManager) UpdateTotalCoverage(coverageBasisPoints uint64) {
+	m.stateManager.UpdateCoverage(coverageBasisPoints)
+}
+
+// GetStateManager returns the underlying state manager.
+func (m *PackedManager) GetStateManager() *state.FileManager {
+	return m.stateManager
+}
+
+// ExportDirectoryLayout materializes every packed seed into the legacy
+// directory-per-seed layout under dir, for humans who want to browse the
+// corpus with normal tools. The pack remains the source of truth.
+func (m *PackedManager) ExportDirectoryLayout(dir string) error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	ids := make([]uint64, 0, len(m.entries))
+	for id := range m.entries {
+		ids = append(ids, id)
+	}
+	sort.Slice(ids, func(i, j int) bool { return ids[i] < ids[j] })
+
+	for _, id := range ids {
+		s, err := m.loadPayload(m.entries[id])
+		if err != nil {
+			return err
+		}
+		// SaveSeedWithMetadata rewrites FilePath/ContentPath on a copy so
+		// the in-memory pack metadata keeps its pack: naming.
+		export := *s
+		if _, err := seed.SaveSeedWithMetadata(dir, &export, m.namer); err != nil {
+			return fmt.Errorf("failed to export seed %d: %w", id, err)
+		}
+	}
+
+	return nil
+}
+
+// Close releases the pack file handles.
+func (m *PackedManager) Close() error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+
+	var firstErr error
+	if m.dataFile != nil {
+		if err := m.dataFile.Close(); err != nil {
+			firstErr = err
+		}
+		m.dataFile = nil
+	}
+	if m.idxFile != nil {
+		if err := m.idxFile.Close(); err != nil && firstErr == nil {
+			firstErr = err
+		}
+		m.idxFile = nil
+	}
+	return firstErr
+}
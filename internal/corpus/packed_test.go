@@ -0,0 +1,169 @@
+package corpus
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+func TestPackedManager(t *testing.T) {
+	t.Run("should add and retrieve seeds", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		manager := NewPackedManager(tmpDir)
+		if err := manager.Initialize(); err != nil {
+			t.Fatalf("failed to initialize: %v", err)
+		}
+
+		s := &seed.Seed{
+			Meta:    seed.Metadata{ParentID: 0, Depth: 0},
+			Content: "int main() { return 0; }",
+			TestCases: []seed.TestCase{
+				{RunningCommand: "./a.out", ExpectedResult: "0"},
+			},
+		}
+
+		if err := manager.Add(s); err != nil {
+			t.Fatalf("failed to add seed: %v", err)
+		}
+
+		if s.Meta.ID != 1 {
+			t.Errorf("expected ID 1, got %d", s.Meta.ID)
+		}
+
+		if manager.Len() != 1 {
+			t.Errorf("expected queue length 1, got %d", manager.Len())
+		}
+
+		retrieved, ok := manager.Next()
+		if !ok {
+			t.Fatal("expected to retrieve seed")
+		}
+		if retrieved.Content != s.Content {
+			t.Errorf("expected content %q, got %q", s.Content, retrieved.Content)
+		}
+
+		if manager.Len() != 0 {
+			t.Errorf("expected queue length 0, got %d", manager.Len())
+		}
+	})
+
+	t.Run("should recover from pack files", func(t *testing.T) {
+		tmpDir := t.TempDir()
+
+		manager1 := NewPackedManager(tmpDir)
+		_ = manager1.Initialize()
+
+		s1 := &seed.Seed{
+			Meta:    seed.Metadata{ParentID: 0, Depth: 0},
+			Content: "int main() { return 0; }",
+		}
+		s2 := &seed.Seed{
+			Meta:    seed.Metadata{ParentID: 0, Depth: 0},
+			Content: "int main() { return 1; }",
+		}
+
+		_ = manager1.Add(s1)
+		_ = manager1.Add(s2)
+		_ = manager1.Save()
+		_ = manager1.Close()
+
+		manager2 := NewPackedManager(tmpDir)
+		if err := manager2.Recover(); err != nil {
+			t.Fatalf("failed to recover: %v", err)
+		}
+
+		if manager2.Len() != 2 {
+			t.Errorf("expected queue length 2, got %d", manager2.Len())
+		}
+
+		// Recovery loads contents lazily; Next must hydrate them.
+		first, ok := manager2.Next()
+		if !ok {
+			t.Fatal("expected to retrieve first recovered seed")
+		}
+		if first.Content != s1.Content {
+			t.Errorf("expected content %q, got %q", s1.Content, first.Content)
+		}
+	})
+
+	t.Run("should keep last index entry per seed", func(t *testing.T) {
+		tmpDir := t.TempDir()
+
+		manager1 := NewPackedManager(tmpDir)
+		_ = manager1.Initialize()
+
+		s := &seed.Seed{
+			Meta:    seed.Metadata{ParentID: 0, Depth: 0},
+			Content: "int main() { return 0; }",
+		}
+		_ = manager1.Add(s)
+
+		retrieved, _ := manager1.Next()
+		if err := manager1.ReportResult(retrieved.Meta.ID, FuzzResult{
+			State:       seed.SeedStateProcessed,
+			OldCoverage: 1000,
+			NewCoverage: 2500,
+		}); err != nil {
+			t.Fatalf("failed to report result: %v", err)
+		}
+		_ = manager1.Save()
+		_ = manager1.Close()
+
+		manager2 := NewPackedManager(tmpDir)
+		if err := manager2.Recover(); err != nil {
+			t.Fatalf("failed to recover: %v", err)
+		}
+
+		// The seed was processed, so it must not re-enter the queue.
+		if manager2.Len() != 0 {
+			t.Errorf("expected empty queue, got %d", manager2.Len())
+		}
+
+		loaded, err := manager2.Get(retrieved.Meta.ID)
+		if err != nil {
+			t.Fatalf("failed to get seed: %v", err)
+		}
+		if loaded.Meta.State != seed.SeedStateProcessed {
+			t.Errorf("expected state %q, got %q", seed.SeedStateProcessed, loaded.Meta.State)
+		}
+		if loaded.Meta.CovIncrease != 1500 {
+			t.Errorf("expected CovIncrease 1500, got %d", loaded.Meta.CovIncrease)
+		}
+	})
+
+	t.Run("should export legacy directory layout", func(t *testing.T) {
+		tmpDir := t.TempDir()
+
+		manager := NewPackedManager(tmpDir)
+		_ = manager.Initialize()
+
+		s := &seed.Seed{
+			Meta:    seed.Metadata{ParentID: 0, Depth: 0},
+			Content: "int main() { return 0; }",
+		}
+		_ = manager.Add(s)
+
+		exportDir := filepath.Join(tmpDir, "export")
+		if err := manager.ExportDirectoryLayout(exportDir); err != nil {
+			t.Fatalf("failed to export: %v", err)
+		}
+
+		entries, err := os.ReadDir(exportDir)
+		if err != nil {
+			t.Fatalf("failed to read export dir: %v", err)
+		}
+		if len(entries) != 1 {
+			t.Fatalf("expected 1 exported seed directory, got %d", len(entries))
+		}
+		source := filepath.Join(exportDir, entries[0].Name(), "source.c")
+		data, err := os.ReadFile(source)
+		if err != nil {
+			t.Fatalf("failed to read exported source: %v", err)
+		}
+		if string(data) != s.Content {
+			t.Errorf("expected exported content %q, got %q", s.Content, string(data))
+		}
+	})
+}
@@ -74,6 +74,21 @@ type Analyzer struct {
 	targetFunctions   []string         // Functions to focus on
 	sourceDir         string           // Directory containing source files
 	weightDecayFactor float64          // Decay factor for BB weights after failed iterations
+
+	// Bitset coverage representation: every LineID is interned to a dense
+	// index (CFG lines up front, runtime-only lines on first sight) and the
+	// set of covered lines is tracked as a bitset alongside the mapping.
+	// Hot paths (CheckNewCoverage, SelectTarget reachability, stats) test
+	// bits instead of hashing LineIDs through copied maps.
+	lineIndex   *lineInterner
+	coveredMu   sync.RWMutex
+	coveredBits bitset
+
+	// targetIdx keeps uncovered, reachable BBs in a weight-keyed max-heap
+	// so SelectTarget is a peek instead of a full rescan of every parsed
+	// block. Maintained incrementally by markCovered / DecayBBWeight; nil
+	// on hand-built analyzers, which fall back to the linear scan.
+	targetIdx *targetIndex
 }
 
 func (c *Analyzer) normalizeFilePath(filePath string) string {
@@ -132,11 +147,13 @@ func NewAnalyzer(cfgPaths []string, targetFunctions []string, sourceDir string,
 		targetFunctions:   targetFunctions,
 		sourceDir:         sourceDir,
 		weightDecayFactor: weightDecayFactor,
+		lineIndex:         newLineInterner(),
 	}
 
-	// Parse all CFG files, merging functions from each
+	// Load all CFG files (from the binary cache when fresh, otherwise
+	// parsed and re-cached), merging functions from each
 	for _, path := range cfgPaths {
-		if err := cfgAnalyzer.parseCFGFile(path); err != nil {
+		if err := cfgAnalyzer.loadCFGFile(path); err != nil {
 			return nil, fmt.Errorf("failed to parse CFG file %s: %w", filepath.Base(path), err)
 		}
 	}
@@ -158,6 +175,18 @@ func NewAnalyzer(cfgPaths []string, targetFunctions []string, sourceDir string,
 	}
 	cfgAnalyzer.mapping = mapping
 
+	// Attach the binary delta log next to the JSON snapshot so checkpoints
+	// append instead of rewriting the whole mapping. Replay happens before
+	// the covered bitset is derived.
+	if mappingPath != "" {
+		if err := mapping.EnableBinaryLog(mappingPath + ".log"); err != nil {
+			logger.Warn("Failed to enable binary mapping log: %v", err)
+		}
+	}
+
+	cfgAnalyzer.rebuildCoveredBits()
+	cfgAnalyzer.targetIdx = cfgAnalyzer.buildTargetIndex()
+
 	return cfgAnalyzer, nil
 }
 
@@ -170,14 +199,40 @@ var (
 	reLineInfo       = regexp.MustCompile(`\[([^:\]]+):(\d+):\d+(?:\s+discrim\s+\d+)?\]`)
 )
 
-// parseCFGFile parses a single CFG file and merges its functions into the analyzer.
-func (c *Analyzer) parseCFGFile(cfgPath string) error {
+// loadCFGFile loads one CFG file's functions into the analyzer, preferring
+// the compiled binary cache next to the .cfg. Text parsing of the full
+// gcc/cc1 dumps dominates startup time; the cache cuts restarts to a
+// straight decode. A stale or unwritable cache never fails the load.
+func (c *Analyzer) loadCFGFile(cfgPath string) error {
+	funcs, ok := loadCFGCache(cfgPath, c.sourceDir)
+	if !ok {
+		var err error
+		funcs, err = c.parseCFGFunctions(cfgPath)
+		if err != nil {
+			return err
+		}
+		if err := writeCFGCache(cfgPath, c.sourceDir, funcs); err != nil {
+			logger.Warn("Failed to write CFG cache for %s: %v", filepath.Base(cfgPath), err)
+		}
+	}
+
+	for name, fn := range funcs {
+		c.functions[name] = fn
+		c.indexFunction(fn)
+	}
+	return nil
+}
+
+// parseCFGFunctions parses a single CFG file and returns its functions.
+func (c *Analyzer) parseCFGFunctions(cfgPath string) (map[string]*CFGFunction, error) {
 	file, err := os.Open(cfgPath)
 	if err != nil {
-		return fmt.Errorf("failed to open CFG file: %w", err)
+		return nil, fmt.Errorf("failed to open CFG file: %w", err)
 	}
 	defer file.Close()
 
+	functions := make(map[string]*CFGFunction)
+
 	scanner := bufio.NewScanner(file)
 	buf := make([]byte, 0, 1024*1024)
 	scanner.Buffer(buf, 10*1024*1024)
@@ -191,8 +246,7 @@ func (c *Analyzer) parseCFGFile(cfgPath string) error {
 
 		if matches := reFunctionHeader.FindStringSubmatch(line); matches != nil {
 			if currentFunc != nil {
-				c.functions[currentFunc.Name] = currentFunc
-				c.indexFunction(currentFunc)
+				functions[currentFunc.Name] = currentFunc
 			}
 
 			currentFunc = &CFGFunction{
@@ -278,21 +332,20 @@ func (c *Analyzer) parseCFGFile(cfgPath string) error {
 	}
 
 	if currentFunc != nil {
-		c.functions[currentFunc.Name] = currentFunc
-		c.indexFunction(currentFunc)
+		functions[currentFunc.Name] = currentFunc
 	}
 
 	if err := scanner.Err(); err != nil {
-		return fmt.Errorf("error reading CFG file: %w", err)
+		return nil, fmt.Errorf("error reading CFG file: %w", err)
 	}
 
-	return nil
+	return functions, nil
 }
 
 // Parse parses all configured CFG files (backward compatibility helper).
 func (c *Analyzer) Parse() error {
 	for _, path := range c.cfgPaths {
-		if err := c.parseCFGFile(path); err != nil {
+		if err := c.loadCFGFile(path); err != nil {
 			return err
 		}
 	}
@@ -322,6 +375,7 @@ func (c *Analyzer) indexFunction(fn *CFGFunction) {
 		for _, lineNum := range bb.Lines {
 			lid := c.makeLineID(bb.File, lineNum)
 			c.lineToBB[lid] = append(c.lineToBB[lid], bbID)
+			c.lineIndex.intern(lid)
 		}
 		key := fmt.Sprintf("%s:%d", fn.Name, bbID)
 		c.bbToSuccCount[key] = len(bb.Successors)
@@ -385,14 +439,65 @@ type BBCandidate struct {
 
 // SelectTarget selects the best uncovered basic block to target.
 func (c *Analyzer) SelectTarget() *TargetInfo {
-	coveredLines := c.mapping.GetCoveredLines()
-
-	candidate := c.selectTargetBB(c.targetFunctions, coveredLines)
+	var candidate *BBCandidate
+	if c.targetIdx != nil {
+		if ref, weight, ok := c.targetIdx.best(); ok {
+			candidate = c.candidateFromRef(ref, weight)
+		}
+	} else {
+		candidate = c.selectTargetBB(c.targetFunctions)
+	}
 	if candidate == nil {
 		logger.Debug("[Analyzer] No uncovered BBs found - all covered!")
 		return nil
 	}
+	return c.buildTargetInfo(candidate)
+}
 
+// SelectTargets returns up to k distinct top-weighted targets in heap
+// order, for callers that solve several targets concurrently. Falls back
+// to the single best candidate on hand-built analyzers without an index.
+func (c *Analyzer) SelectTargets(k int) []*TargetInfo {
+	if c.targetIdx == nil {
+		if info := c.SelectTarget(); info != nil {
+			return []*TargetInfo{info}
+		}
+		return nil
+	}
+
+	refs := c.targetIdx.topK(k)
+	infos := make([]*TargetInfo, 0, len(refs))
+	for _, ref := range refs {
+		if candidate := c.candidateFromRef(ref, c.GetBBWeight(ref.fn, ref.bbID)); candidate != nil {
+			infos = append(infos, c.buildTargetInfo(candidate))
+		}
+	}
+	return infos
+}
+
+// candidateFromRef materializes a BBCandidate for an index entry.
+func (c *Analyzer) candidateFromRef(ref bbRef, weight float64) *BBCandidate {
+	fn, ok := c.functions[ref.fn]
+	if !ok {
+		return nil
+	}
+	bb, ok := fn.Blocks[ref.bbID]
+	if !ok {
+		return nil
+	}
+	return &BBCandidate{
+		Function:       ref.fn,
+		BBID:           ref.bbID,
+		SuccessorCount: len(bb.Successors),
+		Lines:          bb.Lines,
+		File:           bb.File,
+		Weight:         weight,
+		Predecessors:   bb.Predecessors,
+	}
+}
+
+// buildTargetInfo enriches a selected candidate with base-seed context.
+func (c *Analyzer) buildTargetInfo(candidate *BBCandidate) *TargetInfo {
 	logger.Debug("[Analyzer] Selected candidate: %s:BB%d (weight=%.2f, succs=%d, preds=%v)",
 		candidate.Function, candidate.BBID, candidate.Weight, candidate.SuccessorCount, candidate.Predecessors)
 
@@ -404,7 +509,7 @@ func (c *Analyzer) SelectTarget() *TargetInfo {
 		File:           candidate.File,
 	}
 
-	baseSeedID, baseLine, found := c.findCoveredPredecessorSeed(candidate, coveredLines)
+	baseSeedID, baseLine, found := c.findCoveredPredecessorSeed(candidate)
 	if found {
 		info.BaseSeed = fmt.Sprintf("%d", baseSeedID)
 		info.BaseSeedLine = baseLine.Line
@@ -418,7 +523,7 @@ func (c *Analyzer) SelectTarget() *TargetInfo {
 			for _, bb := range fn.Blocks {
 				for _, lineNum := range bb.Lines {
 					lid := c.makeLineID(bb.File, lineNum)
-					if coveredLines[lid] {
+					if c.isLineCovered(lid) {
 						seedID, seedFound := c.mapping.GetSeedForLine(lid)
 						if seedFound {
 							info.BaseSeed = fmt.Sprintf("%d", seedID)
@@ -439,7 +544,7 @@ func (c *Analyzer) SelectTarget() *TargetInfo {
 	return info
 }
 
-func (c *Analyzer) selectTargetBB(targetFunctions []string, coveredLines map[LineID]bool) *BBCandidate {
+func (c *Analyzer) selectTargetBB(targetFunctions []string) *BBCandidate {
 	var candidates []BBCandidate
 
 	for _, funcName := range targetFunctions {
@@ -456,7 +561,7 @@ func (c *Analyzer) selectTargetBB(targetFunctions []string, coveredLines map[Lin
 			hasUncoveredLine := false
 			for _, lineNum := range bb.Lines {
 				lid := c.makeLineID(bb.File, lineNum)
-				if !coveredLines[lid] {
+				if !c.isLineCovered(lid) {
 					hasUncoveredLine = true
 					break
 				}
@@ -474,7 +579,7 @@ func (c *Analyzer) selectTargetBB(targetFunctions []string, coveredLines map[Lin
 					// Check if any line in predecessor is covered
 					for _, lineNum := range predBB.Lines {
 						lid := c.makeLineID(predBB.File, lineNum)
-						if coveredLines[lid] {
+						if c.isLineCovered(lid) {
 							isReachable = true
 							break
 						}
@@ -530,8 +635,8 @@ func (c *Analyzer) selectTargetBB(targetFunctions []string, coveredLines map[Lin
 	return &topCandidates[idx]
 }
 
-func (c *Analyzer) findCoveredPredecessorSeed(candidate *BBCandidate, coveredLines map[LineID]bool) (int64, LineID, bool) {
-	coveredPreds := c.GetCoveredPredecessors(candidate.Function, candidate.BBID, coveredLines)
+func (c *Analyzer) findCoveredPredecessorSeed(candidate *BBCandidate) (int64, LineID, bool) {
+	coveredPreds := c.coveredPredecessors(candidate.Function, candidate.BBID)
 	if len(coveredPreds) == 0 {
 		return 0, LineID{}, false
 	}
@@ -549,7 +654,7 @@ func (c *Analyzer) findCoveredPredecessorSeed(candidate *BBCandidate, coveredLin
 
 		for _, lineNum := range predBB.Lines {
 			lid := c.makeLineID(predBB.File, lineNum)
-			if coveredLines[lid] {
+			if c.isLineCovered(lid) {
 				seedID, found := c.mapping.GetSeedForLine(lid)
 				if found {
 					return seedID, lid, true
@@ -591,6 +696,37 @@ func (c *Analyzer) GetCoveredPredecessors(funcName string, bbID int, coveredLine
 	return coveredPreds
 }
 
+// coveredPredecessors is the bitset-backed variant of GetCoveredPredecessors
+// used on the target-selection hot path.
+func (c *Analyzer) coveredPredecessors(funcName string, bbID int) []int {
+	fn, ok := c.functions[funcName]
+	if !ok {
+		return nil
+	}
+
+	bb, ok := fn.Blocks[bbID]
+	if !ok {
+		return nil
+	}
+
+	var coveredPreds []int
+	for _, predID := range bb.Predecessors {
+		predBB, ok := fn.Blocks[predID]
+		if !ok {
+			continue
+		}
+		for _, lineNum := range predBB.Lines {
+			lid := c.makeLineID(predBB.File, lineNum)
+			if c.isLineCovered(lid) {
+				coveredPreds = append(coveredPreds, predID)
+				break
+			}
+		}
+	}
+
+	return coveredPreds
+}
+
 // Coverage tracking methods
 
 // RecordCoverage records covered lines for a seed. Should only be called for qualified seeds
@@ -598,22 +734,84 @@ func (c *Analyzer) GetCoveredPredecessors(funcName string, bbID int, coveredLine
 func (c *Analyzer) RecordCoverage(seedID int64, coveredLines []string) {
 	lineIDs := c.parseLinesToIDs(coveredLines)
 	c.mapping.RecordLines(lineIDs, seedID)
+	c.markCovered(lineIDs)
 }
 
 // CheckNewCoverage checks if the given lines would increase BB coverage without recording.
 // Returns true if any new BB would be covered.
 func (c *Analyzer) CheckNewCoverage(coveredLines []string) bool {
 	lineIDs := c.parseLinesToIDs(coveredLines)
-	currentCovered := c.mapping.GetCoveredLines()
 
+	if c.lineIndex == nil {
+		currentCovered := c.mapping.GetCoveredLines()
+		for _, lid := range lineIDs {
+			if !currentCovered[lid] {
+				return true
+			}
+		}
+		return false
+	}
+
+	c.coveredMu.RLock()
+	defer c.coveredMu.RUnlock()
 	for _, lid := range lineIDs {
-		if !currentCovered[lid] {
+		idx, known := c.lineIndex.lookup(lid)
+		if !known || !c.coveredBits.get(idx) {
 			return true
 		}
 	}
 	return false
 }
 
+// isLineCovered tests a single line against the covered bitset. Analyzers
+// hand-built without an interner (tests) fall back to the mapping.
+func (c *Analyzer) isLineCovered(lid LineID) bool {
+	if c.lineIndex == nil {
+		return c.mapping.IsCovered(lid)
+	}
+	idx, known := c.lineIndex.lookup(lid)
+	if !known {
+		return false
+	}
+	c.coveredMu.RLock()
+	defer c.coveredMu.RUnlock()
+	return c.coveredBits.get(idx)
+}
+
+// markCovered sets the bits for the given lines, interning any line seen for
+// the first time at runtime, and feeds first-time transitions to the
+// target index.
+func (c *Analyzer) markCovered(lineIDs []LineID) {
+	if c.lineIndex == nil {
+		return
+	}
+	var fresh []uint32
+	c.coveredMu.Lock()
+	for _, lid := range lineIDs {
+		idx := c.lineIndex.intern(lid)
+		if !c.coveredBits.get(idx) {
+			c.coveredBits.set(idx)
+			fresh = append(fresh, idx)
+		}
+	}
+	c.coveredMu.Unlock()
+
+	if c.targetIdx != nil && len(fresh) > 0 {
+		c.targetIdx.onLinesCovered(fresh)
+	}
+}
+
+// rebuildCoveredBits re-derives the covered bitset from the mapping (used at
+// construction and whenever a mapping is loaded from disk).
+func (c *Analyzer) rebuildCoveredBits() {
+	c.coveredMu.Lock()
+	defer c.coveredMu.Unlock()
+	c.coveredBits.clear()
+	for lid := range c.mapping.GetCoveredLines() {
+		c.coveredBits.set(c.lineIndex.intern(lid))
+	}
+}
+
 // parseLinesToIDs converts "file:line" strings to LineID structs.
 func (c *Analyzer) parseLinesToIDs(coveredLines []string) []LineID {
 	lineIDs := make([]LineID, 0, len(coveredLines))
@@ -634,13 +832,18 @@ func (c *Analyzer) GetCoveredLines() map[LineID]bool {
 	return c.mapping.GetCoveredLines()
 }
 
+// IsLineCovered reports whether a single source line is covered, without
+// materializing the full covered-lines map.
+func (c *Analyzer) IsLineCovered(file string, line int) bool {
+	return c.isLineCovered(c.makeLineID(file, line))
+}
+
 // GetFunctionCoverage returns BB coverage statistics for target functions.
 func (c *Analyzer) GetFunctionCoverage() map[string]struct{ Covered, Total int } {
-	coveredLines := c.GetCoveredLines()
 	result := make(map[string]struct{ Covered, Total int })
 
 	for _, funcName := range c.targetFunctions {
-		covered, total := c.getFunctionCoverage(funcName, coveredLines)
+		covered, total := c.getFunctionCoverage(funcName)
 		result[funcName] = struct{ Covered, Total int }{covered, total}
 	}
 
@@ -650,12 +853,11 @@ func (c *Analyzer) GetFunctionCoverage() map[string]struct{ Covered, Total int }
 // GetTotalBBCoverage returns the total BB coverage across all target functions.
 // Returns (coveredBBs, totalBBs).
 func (c *Analyzer) GetTotalBBCoverage() (int, int) {
-	coveredLines := c.GetCoveredLines()
 	totalCovered := 0
 	totalBBs := 0
 
 	for _, funcName := range c.targetFunctions {
-		covered, total := c.getFunctionCoverage(funcName, coveredLines)
+		covered, total := c.getFunctionCoverage(funcName)
 		totalCovered += covered
 		totalBBs += total
 	}
@@ -673,7 +875,7 @@ func (c *Analyzer) GetBBCoverageBasisPoints() uint64 {
 	return uint64(covered * 10000 / total)
 }
 
-func (c *Analyzer) getFunctionCoverage(funcName string, coveredLines map[LineID]bool) (covered, total int) {
+func (c *Analyzer) getFunctionCoverage(funcName string) (covered, total int) {
 	fn, ok := c.functions[funcName]
 	if !ok {
 		return 0, 0
@@ -687,7 +889,7 @@ func (c *Analyzer) getFunctionCoverage(funcName string, coveredLines map[LineID]
 		total++
 		for _, lineNum := range bb.Lines {
 			lid := c.makeLineID(bb.File, lineNum)
-			if coveredLines[lid] {
+			if c.isLineCovered(lid) {
 				coveredBBs[bbID] = true
 				break
 			}
@@ -699,18 +901,17 @@ func (c *Analyzer) getFunctionCoverage(funcName string, coveredLines map[LineID]
 
 // GetFunctionLineCoverage returns line coverage statistics.
 func (c *Analyzer) GetFunctionLineCoverage() map[string]struct{ Covered, Total int } {
-	coveredLines := c.GetCoveredLines()
 	result := make(map[string]struct{ Covered, Total int })
 
 	for _, funcName := range c.targetFunctions {
-		covered, total := c.getFunctionLineCoverage(funcName, coveredLines)
+		covered, total := c.getFunctionLineCoverage(funcName)
 		result[funcName] = struct{ Covered, Total int }{covered, total}
 	}
 
 	return result
 }
 
-func (c *Analyzer) getFunctionLineCoverage(funcName string, coveredLines map[LineID]bool) (covered, total int) {
+func (c *Analyzer) getFunctionLineCoverage(funcName string) (covered, total int) {
 	fn, ok := c.functions[funcName]
 	if !ok {
 		return 0, 0
@@ -729,7 +930,7 @@ func (c *Analyzer) getFunctionLineCoverage(funcName string, coveredLines map[Lin
 
 	coveredCount := 0
 	for lid := range allLines {
-		if coveredLines[lid] {
+		if c.isLineCovered(lid) {
 			coveredCount++
 		}
 	}
@@ -768,10 +969,9 @@ func (c *Analyzer) getFunctionTotalLines(funcName string) int {
 
 // GetTotalCoveredTargetLines returns the total number of covered lines in target functions.
 func (c *Analyzer) GetTotalCoveredTargetLines() int {
-	coveredLines := c.GetCoveredLines()
 	total := 0
 	for _, funcName := range c.targetFunctions {
-		covered, _ := c.getFunctionLineCoverage(funcName, coveredLines)
+		covered, _ := c.getFunctionLineCoverage(funcName)
 		total += covered
 	}
 	return total
@@ -784,6 +984,12 @@ func (c *Analyzer) LoadMapping(path string) error {
 		return err
 	}
 	c.mapping = loaded
+	if c.lineIndex != nil {
+		c.rebuildCoveredBits()
+		if c.targetIdx != nil {
+			c.targetIdx = c.buildTargetIndex()
+		}
+	}
 	return nil
 }
 
@@ -791,6 +997,15 @@ func (c *Analyzer) SaveMapping(path string) error {
 	return c.mapping.Save(path)
 }
 
+// FinalizeMapping compacts the binary delta log and writes the JSON snapshot
+// for external tooling. Called once when fuzzing completes.
+func (c *Analyzer) FinalizeMapping(path string) error {
+	if err := c.mapping.Compact(); err != nil {
+		return fmt.Errorf("failed to compact mapping log: %w", err)
+	}
+	return c.mapping.SaveSnapshot(path)
+}
+
 func (c *Analyzer) GetMapping() *CoverageMapping {
 	return c.mapping
 }
@@ -813,6 +1028,10 @@ func (c *Analyzer) DecayBBWeight(funcName string, bbID int) {
 	wi.Weight *= c.weightDecayFactor
 	logger.Debug("BB %s weight decayed: %.2f -> %.2f (attempts=%d, factor=%.2f)",
 		key, oldWeight, wi.Weight, wi.Attempts, c.weightDecayFactor)
+
+	if c.targetIdx != nil {
+		c.targetIdx.onWeightChanged(funcName, bbID, wi.Weight)
+	}
 }
 
 // RecordSuccess is called when a BB is successfully covered.
@@ -929,6 +1148,11 @@ type CoverageMapping struct {
 	mu          sync.RWMutex
 	LineToSeeds map[string][]int64 `json:"line_to_seeds"`
 	path        string
+
+	// binLog, when enabled, receives every newly added (seed, line) pair as
+	// an append-only binary delta so checkpoints flush a buffer instead of
+	// rewriting the whole mapping as JSON. See mapping_log.go.
+	binLog *mappingLog
 }
 
 // NewCoverageMapping creates a new CoverageMapping instance.
@@ -949,12 +1173,31 @@ func NewCoverageMapping(path string) (*CoverageMapping, error) {
 	return cm, nil
 }
 
-// RecordLine adds a seed to the line's seed list (no duplicates).
-// Returns true if this seed is newly added to this line.
-func (cm *CoverageMapping) RecordLine(line LineID, seedID int64) bool {
+// EnableBinaryLog attaches the append-only delta log at path, replaying any
+// existing records into the mapping (deduplicated, so a log that overlaps
+// the JSON snapshot is safe). Once enabled, Save only flushes the log;
+// Compact and SaveSnapshot produce the durable artifacts at finalize.
+func (cm *CoverageMapping) EnableBinaryLog(path string) error {
 	cm.mu.Lock()
 	defer cm.mu.Unlock()
 
+	if cm.binLog != nil {
+		return nil
+	}
+
+	binLog, err := openMappingLog(path, func(seedID int64, line LineID) {
+		cm.addLocked(line, seedID)
+	})
+	if err != nil {
+		return err
+	}
+	cm.binLog = binLog
+	return nil
+}
+
+// addLocked inserts one (line, seed) pair without touching the log.
+// Returns true if the pair was newly added. Caller holds cm.mu.
+func (cm *CoverageMapping) addLocked(line LineID, seedID int64) bool {
 	key := line.String()
 	seeds := cm.LineToSeeds[key]
 
@@ -969,6 +1212,19 @@ func (cm *CoverageMapping) RecordLine(line LineID, seedID int64) bool {
 	return true
 }
 
+// RecordLine adds a seed to the line's seed list (no duplicates).
+// Returns true if this seed is newly added to this line.
+func (cm *CoverageMapping) RecordLine(line LineID, seedID int64) bool {
+	cm.mu.Lock()
+	defer cm.mu.Unlock()
+
+	if !cm.addLocked(line, seedID) {
+		return false
+	}
+	cm.appendDeltaLocked(seedID, []LineID{line})
+	return true
+}
+
 // RecordLines adds a seed to multiple lines' seed lists.
 // Returns the count of lines where this seed was newly added.
 func (cm *CoverageMapping) RecordLines(lines []LineID, seedID int64) int {
@@ -976,30 +1232,33 @@ func (cm *CoverageMapping) RecordLines(lines []LineID, seedID int64) int {
 	defer cm.mu.Unlock()
 
 	newCount := 0
+	var added []LineID
 	for _, line := range lines {
-		key := line.String()
-		seeds := cm.LineToSeeds[key]
-
-		// Check if seed already recorded for this line
-		found := false
-		for _, s := range seeds {
-			if s == seedID {
-				found = true
-				break
-			}
-		}
-
-		if !found {
-			cm.LineToSeeds[key] = append(seeds, seedID)
-			if len(seeds) == 0 {
+		wasCovered := len(cm.LineToSeeds[line.String()]) > 0
+		if cm.addLocked(line, seedID) {
+			added = append(added, line)
+			if !wasCovered {
 				// This is a newly covered line
 				newCount++
 			}
 		}
 	}
+	cm.appendDeltaLocked(seedID, added)
 	return newCount
 }
 
+// appendDeltaLocked forwards newly added pairs to the binary log, if
+// enabled. Log errors are reported but never fail the recording: the
+// in-memory mapping stays authoritative. Caller holds cm.mu.
+func (cm *CoverageMapping) appendDeltaLocked(seedID int64, added []LineID) {
+	if cm.binLog == nil || len(added) == 0 {
+		return
+	}
+	if err := cm.binLog.appendDelta(seedID, added); err != nil {
+		logger.Warn("Failed to append to mapping log: %v", err)
+	}
+}
+
 // GetSeedForLine returns a randomly selected seed from the seeds that covered this line.
 func (cm *CoverageMapping) GetSeedForLine(line LineID) (int64, bool) {
 	cm.mu.RLock()
@@ -1097,9 +1356,28 @@ func (cm *CoverageMapping) TotalCoveredLines() int {
 }
 
 func (cm *CoverageMapping) Save(path string) error {
-	cm.mu.RLock()
-	defer cm.mu.RUnlock()
+	cm.mu.Lock()
+	defer cm.mu.Unlock()
+
+	// With the binary log enabled, a checkpoint is just a log flush: the
+	// JSON snapshot is only rewritten by SaveSnapshot at finalize.
+	if cm.binLog != nil {
+		return cm.binLog.flush()
+	}
+
+	return cm.saveJSONLocked(path)
+}
+
+// SaveSnapshot writes the JSON form of the mapping regardless of whether the
+// binary log is enabled (external tooling reads the JSON file).
+func (cm *CoverageMapping) SaveSnapshot(path string) error {
+	cm.mu.Lock()
+	defer cm.mu.Unlock()
+	return cm.saveJSONLocked(path)
+}
 
+// saveJSONLocked writes the full JSON snapshot. Caller holds cm.mu.
+func (cm *CoverageMapping) saveJSONLocked(path string) error {
 	if path == "" {
 		path = cm.path
 	}
@@ -1124,6 +1402,45 @@ func (cm *CoverageMapping) Save(path string) error {
 	return nil
 }
 
+// Compact rewrites the binary log to one delta record per seed, discarding
+// the append history. No-op when the log is disabled.
+func (cm *CoverageMapping) Compact() error {
+	cm.mu.Lock()
+	defer cm.mu.Unlock()
+
+	if cm.binLog == nil {
+		return nil
+	}
+
+	seedLines := make(map[int64][]LineID)
+	for key, seeds := range cm.LineToSeeds {
+		lid, ok := parseMappingKey(key)
+		if !ok {
+			continue
+		}
+		for _, seedID := range seeds {
+			seedLines[seedID] = append(seedLines[seedID], lid)
+		}
+	}
+
+	return cm.binLog.rewrite(seedLines)
+}
+
+// parseMappingKey splits a "file:line" mapping key at its last colon (file
+// paths may themselves contain colons).
+func parseMappingKey(key string) (LineID, bool) {
+	for i := len(key) - 1; i >= 0; i-- {
+		if key[i] == ':' {
+			line, err := strconv.Atoi(key[i+1:])
+			if err != nil || line <= 0 {
+				return LineID{}, false
+			}
+			return LineID{File: key[:i], Line: line}, true
+		}
+	}
+	return LineID{}, false
+}
+
 func (cm *CoverageMapping) Load(path string) error {
 	cm.mu.Lock()
 	defer cm.mu.Unlock()
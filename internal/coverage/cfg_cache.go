@@ -0,0 +1,107 @@
+package coverage
+
+import (
+	"encoding/gob"
+	"fmt"
+	"os"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+// Compiled CFG cache.
+//
+// Parsing the GCC .cfg dumps is line-by-line regex work; for the full
+// gcc/cc1 dumps it takes over a minute before the first fuzzing iteration.
+// After the first parse we serialize the function graph into a binary file
+// next to the .cfg and decode that on later runs, so campaign restarts pay
+// decode cost instead of parse cost. The cache records the source dump's
+// size and mtime plus the sourceDir the paths were normalized against; any
+// mismatch (or decode error) falls back to a fresh parse that rewrites it.
+
+const cfgCacheVersion = 1
+
+// cfgCacheFile is the on-disk form of one compiled CFG dump.
+type cfgCacheFile struct {
+	Version     int
+	SourceSize  int64
+	SourceMTime int64 // UnixNano of the .cfg dump
+	SourceDir   string
+	Functions   map[string]*CFGFunction
+}
+
+// cfgCachePath returns the cache file path for a CFG dump.
+func cfgCachePath(cfgPath string) string {
+	return cfgPath + ".cache"
+}
+
+// loadCFGCache returns the cached function graph for cfgPath if the cache
+// exists and still matches the dump. Any failure is a cache miss, never an
+// error: the caller just re-parses.
+func loadCFGCache(cfgPath, sourceDir string) (map[string]*CFGFunction, bool) {
+	srcInfo, err := os.Stat(cfgPath)
+	if err != nil {
+		return nil, false
+	}
+
+	f, err := os.Open(cfgCachePath(cfgPath))
+	if err != nil {
+		return nil, false
+	}
+	defer f.Close()
+
+	var cached cfgCacheFile
+	if err := gob.NewDecoder(f).Decode(&cached); err != nil {
+		logger.Warn("Discarding unreadable CFG cache for %s: %v", cfgPath, err)
+		return nil, false
+	}
+
+	if cached.Version != cfgCacheVersion ||
+		cached.SourceSize != srcInfo.Size() ||
+		cached.SourceMTime != srcInfo.ModTime().UnixNano() ||
+		cached.SourceDir != sourceDir {
+		logger.Debug("[CFGCache] Stale cache for %s, re-parsing", cfgPath)
+		return nil, false
+	}
+
+	logger.Debug("[CFGCache] Loaded %d functions from %s", len(cached.Functions), cfgCachePath(cfgPath))
+	return cached.Functions, true
+}
+
+// writeCFGCache serializes a parsed function graph next to its CFG dump via
+// write-then-rename, so a crash mid-write never leaves a torn cache.
+func writeCFGCache(cfgPath, sourceDir string, functions map[string]*CFGFunction) error {
+	srcInfo, err := os.Stat(cfgPath)
+	if err != nil {
+		return fmt.Errorf("failed to stat CFG file: %w", err)
+	}
+
+	cachePath := cfgCachePath(cfgPath)
+	tmpPath := cachePath + ".tmp"
+	f, err := os.OpenFile(tmpPath, os.O_CREATE|os.O_WRONLY|os.O_TRUNC, 0644)
+	if err != nil {
+		return fmt.Errorf("failed to create CFG cache: %w", err)
+	}
+
+	cached := cfgCacheFile{
+		Version:     cfgCacheVersion,
+		SourceSize:  srcInfo.Size(),
+		SourceMTime: srcInfo.ModTime().UnixNano(),
+		SourceDir:   sourceDir,
+		Functions:   functions,
+	}
+	if err := gob.NewEncoder(f).Encode(&cached); err != nil {
+		f.Close()
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to encode CFG cache: %w", err)
+	}
+	if err := f.Close(); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to close CFG cache: %w", err)
+	}
+
+	if err := os.Rename(tmpPath, cachePath); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to replace CFG cache: %w", err)
+	}
+	return nil
+}
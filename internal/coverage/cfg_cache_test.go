@@ -0,0 +1,124 @@
+package coverage
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+const cacheTestCFG = `;; Function test_func (test_func, funcdef_no=0, decl_uid=2)
+;;   with 3 basic blocks.
+
+;; 2 succs {3 4}
+<bb 2>:
+if (x_3(D) > 10)
+  goto <bb 3>
+else
+  goto <bb 4>
+endif
+
+;; 1 succs {2}
+<bb 3>:
+return x_3(D)
+
+;; 1 succs {2}
+<bb 4>:
+x_5 = x_3(D) + 1;
+goto <bb 2>
+
+test_func (test_func, funcdef_no=0, decl_uid=2) {
+}
+`
+
+func TestCFGCache_RoundTrip(t *testing.T) {
+	tmpDir := t.TempDir()
+	cfgPath := filepath.Join(tmpDir, "test.cfg")
+	require.NoError(t, os.WriteFile(cfgPath, []byte(cacheTestCFG), 0644))
+
+	analyzer := &Analyzer{sourceDir: ""}
+	funcs, err := analyzer.parseCFGFunctions(cfgPath)
+	require.NoError(t, err)
+	require.Contains(t, funcs, "test_func")
+
+	require.NoError(t, writeCFGCache(cfgPath, "", funcs))
+	_, err = os.Stat(cfgCachePath(cfgPath))
+	require.NoError(t, err)
+
+	loaded, ok := loadCFGCache(cfgPath, "")
+	require.True(t, ok)
+	require.Contains(t, loaded, "test_func")
+	fn := loaded["test_func"]
+	assert.Equal(t, funcs["test_func"].MangledName, fn.MangledName)
+	assert.Equal(t, len(funcs["test_func"].Blocks), len(fn.Blocks))
+	assert.Equal(t, funcs["test_func"].SuccsMap, fn.SuccsMap)
+}
+
+func TestCFGCache_Invalidation(t *testing.T) {
+	tmpDir := t.TempDir()
+	cfgPath := filepath.Join(tmpDir, "test.cfg")
+	require.NoError(t, os.WriteFile(cfgPath, []byte(cacheTestCFG), 0644))
+
+	analyzer := &Analyzer{sourceDir: ""}
+	funcs, err := analyzer.parseCFGFunctions(cfgPath)
+	require.NoError(t, err)
+	require.NoError(t, writeCFGCache(cfgPath, "", funcs))
+
+	// Fresh cache hits.
+	_, ok := loadCFGCache(cfgPath, "")
+	assert.True(t, ok)
+
+	// A different sourceDir normalizes paths differently, so it must miss.
+	_, ok = loadCFGCache(cfgPath, "gcc/gcc")
+	assert.False(t, ok)
+
+	// Touching the dump invalidates via mtime.
+	future := time.Now().Add(time.Hour)
+	require.NoError(t, os.Chtimes(cfgPath, future, future))
+	_, ok = loadCFGCache(cfgPath, "")
+	assert.False(t, ok)
+
+	// A corrupt cache file is a miss, not an error.
+	require.NoError(t, writeCFGCache(cfgPath, "", funcs))
+	require.NoError(t, os.WriteFile(cfgCachePath(cfgPath), []byte("garbage"), 0644))
+	_, ok = loadCFGCache(cfgPath, "")
+	assert.False(t, ok)
+}
+
+// TestCFGCache_UsedByNewAnalyzer proves the second construction decodes the
+// cache instead of re-parsing: the dump is swapped for same-length content
+// with the original mtime restored, and the stale function name survives.
+func TestCFGCache_UsedByNewAnalyzer(t *testing.T) {
+	tmpDir := t.TempDir()
+	cfgPath := filepath.Join(tmpDir, "test.cfg")
+	require.NoError(t, os.WriteFile(cfgPath, []byte(cacheTestCFG), 0644))
+	info, err := os.Stat(cfgPath)
+	require.NoError(t, err)
+
+	mappingPath := filepath.Join(tmpDir, "mapping.json")
+	analyzer1, err := NewAnalyzer([]string{cfgPath}, []string{"test_func"}, "", mappingPath, 0.8)
+	require.NoError(t, err)
+	_, ok := analyzer1.GetFunction("test_func")
+	require.True(t, ok)
+
+	// Same byte length, different function name; restore mtime so the
+	// cache header still matches.
+	swapped := []byte(cacheTestCFG)
+	copy(swapped, []byte(";; Function swap_func (swap_func"))
+	require.Len(t, swapped, len(cacheTestCFG))
+	require.NoError(t, os.WriteFile(cfgPath, swapped, 0644))
+	require.NoError(t, os.Chtimes(cfgPath, info.ModTime(), info.ModTime()))
+
+	analyzer2, err := NewAnalyzer([]string{cfgPath}, []string{"test_func"}, "", mappingPath, 0.8)
+	require.NoError(t, err)
+	_, ok = analyzer2.GetFunction("test_func")
+	assert.True(t, ok, "expected cached graph, not a re-parse")
+
+	// Deleting the cache forces a re-parse that sees the new content.
+	require.NoError(t, os.Remove(cfgCachePath(cfgPath)))
+	_, err = NewAnalyzer([]string{cfgPath}, []string{"test_func"}, "", mappingPath, 0.8)
+	assert.Error(t, err, "test_func no longer exists in the dump")
+}
@@ -75,3 +75,10 @@ type PreCompileCoverage interface {
 type PostCompileCoverage interface {
 	MeasureCompiled(s *seed.Seed) (Report, error)
 }
+
+// FlushableCoverage is an optional interface for coverage implementations
+// that keep the merged total resident in memory and persist it on demand.
+// The engine flushes on the same cadence as the rest of its checkpoint.
+type FlushableCoverage interface {
+	FlushTotal() error
+}
@@ -2,12 +2,14 @@ package coverage
 
 import (
 	"bufio"
+	"crypto/sha256"
 	"fmt"
 	"os"
 	"os/exec"
 	"path/filepath"
 	"regexp"
 	"strings"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/logger"
 )
@@ -45,11 +47,23 @@ type DivergenceAnalyzer interface {
 	Cleanup() error
 }
 
+// maxCachedTraces bounds the trace cache. Within one constraint-solving retry
+// loop only the base seed repeats, so a handful of entries is plenty; once the
+// limit is hit the whole cache is dropped rather than tracking LRU order.
+const maxCachedTraces = 8
+
 // UftraceAnalyzer implements DivergenceAnalyzer using uftrace.
 type UftraceAnalyzer struct {
 	workDir     string // Temporary directory for trace files
 	uftraceBin  string // Path to uftrace binary
 	contextSize int    // Number of functions to include in context
+
+	// Parsed call sequences keyed by (compiler path, seed content hash).
+	// Recording a cc1 trace under uftrace costs seconds, and the base seed
+	// is re-traced on every retry of the same constraint, so caching the
+	// parsed result skips record/extract/parse entirely on a hit.
+	cacheMu    sync.Mutex
+	traceCache map[string][]FunctionCall
 }
 
 // NewUftraceAnalyzer creates a new analyzer.
@@ -97,42 +111,15 @@ func NewUftraceAnalyzerWithWorkDir(workDir string) (*UftraceAnalyzer, error) {
 func (a *UftraceAnalyzer) Analyze(baseSeedPath, mutatedSeedPath, compilerPath string) (*DivergencePoint, error) {
 	logger.Debug("[Divergence] Starting analysis: base=%s, mutated=%s", baseSeedPath, mutatedSeedPath)
 
-	trace1Dir := filepath.Join(a.workDir, "trace1")
-	trace2Dir := filepath.Join(a.workDir, "trace2")
-
-	// Clean up any existing trace directories
-	os.RemoveAll(trace1Dir)
-	os.RemoveAll(trace2Dir)
-
-	// Step 1: Record traces
-	logger.Debug("[Divergence] Recording base trace...")
-	if err := a.recordTrace(compilerPath, baseSeedPath, trace1Dir); err != nil {
-		return nil, fmt.Errorf("recording base trace: %w", err)
-	}
-	logger.Debug("[Divergence] Recording mutated trace...")
-	if err := a.recordTrace(compilerPath, mutatedSeedPath, trace2Dir); err != nil {
-		return nil, fmt.Errorf("recording mutated trace: %w", err)
-	}
-
-	// Step 2: Extract cc1 PIDs from task.txt
-	pid1, err := a.extractCC1PID(trace1Dir)
+	// Steps 1-3: Record traces and export call sequences (cached per seed
+	// content, so re-analyzing the same base seed costs nothing).
+	calls1, err := a.callsForSeed(compilerPath, baseSeedPath, "trace1")
 	if err != nil {
-		return nil, fmt.Errorf("extracting cc1 PID from trace1: %w", err)
+		return nil, fmt.Errorf("tracing base seed: %w", err)
 	}
-	pid2, err := a.extractCC1PID(trace2Dir)
-	if err != nil {
-		return nil, fmt.Errorf("extracting cc1 PID from trace2: %w", err)
-	}
-	logger.Debug("[Divergence] cc1 PIDs: trace1=%s, trace2=%s", pid1, pid2)
-
-	// Step 3: Export and filter call sequences
-	calls1, err := a.exportCalls(trace1Dir, pid1)
+	calls2, err := a.callsForSeed(compilerPath, mutatedSeedPath, "trace2")
 	if err != nil {
-		return nil, fmt.Errorf("exporting calls from trace1: %w", err)
-	}
-	calls2, err := a.exportCalls(trace2Dir, pid2)
-	if err != nil {
-		return nil, fmt.Errorf("exporting calls from trace2: %w", err)
+		return nil, fmt.Errorf("tracing mutated seed: %w", err)
 	}
 	logger.Debug("[Divergence] Exported calls: trace1=%d, trace2=%d", len(calls1), len(calls2))
 
@@ -155,6 +142,78 @@ func (a *UftraceAnalyzer) Analyze(baseSeedPath, mutatedSeedPath, compilerPath st
 	return divergence, nil
 }
 
+// callsForSeed returns the parsed cc1 call sequence for a seed, recording a
+// fresh trace only on a cache miss. traceName picks the subdirectory under the
+// work directory so base and mutated traces never clobber each other.
+func (a *UftraceAnalyzer) callsForSeed(compilerPath, seedPath, traceName string) ([]FunctionCall, error) {
+	key, keyErr := a.traceCacheKey(compilerPath, seedPath)
+	if keyErr == nil {
+		if calls, ok := a.cachedCalls(key); ok {
+			logger.Debug("[Divergence] Trace cache hit for %s", seedPath)
+			return calls, nil
+		}
+	} else {
+		// An unreadable seed will fail in recordTrace anyway; just skip caching.
+		logger.Debug("[Divergence] Trace cache disabled for %s: %v", seedPath, keyErr)
+	}
+
+	traceDir := filepath.Join(a.workDir, traceName)
+	os.RemoveAll(traceDir)
+
+	logger.Debug("[Divergence] Recording trace for %s...", seedPath)
+	if err := a.recordTrace(compilerPath, seedPath, traceDir); err != nil {
+		return nil, fmt.Errorf("recording trace: %w", err)
+	}
+
+	pid, err := a.extractCC1PID(traceDir)
+	if err != nil {
+		return nil, fmt.Errorf("extracting cc1 PID: %w", err)
+	}
+	logger.Debug("[Divergence] cc1 PID for %s: %s", seedPath, pid)
+
+	calls, err := a.exportCalls(traceDir, pid)
+	if err != nil {
+		return nil, fmt.Errorf("exporting calls: %w", err)
+	}
+
+	if keyErr == nil {
+		a.storeCalls(key, calls)
+	}
+	return calls, nil
+}
+
+// traceCacheKey hashes the seed content so the cache survives the seed being
+// rewritten in place between retries with identical content.
+func (a *UftraceAnalyzer) traceCacheKey(compilerPath, seedPath string) (string, error) {
+	data, err := os.ReadFile(seedPath)
+	if err != nil {
+		return "", fmt.Errorf("reading seed for cache key: %w", err)
+	}
+	sum := sha256.Sum256(data)
+	return fmt.Sprintf("%s:%x", compilerPath, sum), nil
+}
+
+// cachedCalls looks up a previously parsed call sequence. Callers must treat
+// the returned slice as read-only.
+func (a *UftraceAnalyzer) cachedCalls(key string) ([]FunctionCall, bool) {
+	a.cacheMu.Lock()
+	defer a.cacheMu.Unlock()
+	calls, ok := a.traceCache[key]
+	return calls, ok
+}
+
+// storeCalls inserts a parsed call sequence, dropping the whole cache when it
+// grows past maxCachedTraces (mutated seeds are one-shot keys, so stale
+// entries accumulate without eviction).
+func (a *UftraceAnalyzer) storeCalls(key string, calls []FunctionCall) {
+	a.cacheMu.Lock()
+	defer a.cacheMu.Unlock()
+	if a.traceCache == nil || len(a.traceCache) >= maxCachedTraces {
+		a.traceCache = make(map[string][]FunctionCall)
+	}
+	a.traceCache[key] = calls
+}
+
 // recordTrace runs uftrace record to capture function calls.
 func (a *UftraceAnalyzer) recordTrace(compilerPath, seedPath, traceDir string) error {
 	// uftrace record -P '.*' -d traceDir compiler -c seedPath -o /dev/null
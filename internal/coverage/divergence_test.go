@@ -1,6 +1,7 @@
 package coverage
 
 import (
+	"fmt"
 	"os"
 	"path/filepath"
 	"strings"
@@ -286,6 +287,103 @@ func TestExtractCC1PIDNotFound(t *testing.T) {
 	}
 }
 
+func TestTraceCacheHitSkipsRecording(t *testing.T) {
+	tmpDir := t.TempDir()
+	seedPath := filepath.Join(tmpDir, "seed.c")
+	if err := os.WriteFile(seedPath, []byte("int main(void) { return 0; }\n"), 0644); err != nil {
+		t.Fatalf("Failed to write seed: %v", err)
+	}
+
+	// No uftrace binary is set, so a cache miss would fail loudly; a hit
+	// must return the stored calls without touching uftrace at all.
+	analyzer := &UftraceAnalyzer{workDir: tmpDir, contextSize: 5}
+
+	key, err := analyzer.traceCacheKey("/usr/bin/gcc", seedPath)
+	if err != nil {
+		t.Fatalf("traceCacheKey failed: %v", err)
+	}
+	want := []FunctionCall{{Name: "main", Depth: 0}, {Name: "c_parser_peek_token", Depth: 1}}
+	analyzer.storeCalls(key, want)
+
+	calls, err := analyzer.callsForSeed("/usr/bin/gcc", seedPath, "trace1")
+	if err != nil {
+		t.Fatalf("callsForSeed failed on cache hit: %v", err)
+	}
+	if len(calls) != len(want) || calls[0].Name != "main" {
+		t.Errorf("Expected cached calls, got %v", calls)
+	}
+
+	// A different compiler path must be a distinct key.
+	otherKey, err := analyzer.traceCacheKey("/usr/bin/gcc-14", seedPath)
+	if err != nil {
+		t.Fatalf("traceCacheKey failed: %v", err)
+	}
+	if otherKey == key {
+		t.Error("Expected different cache keys for different compilers")
+	}
+	if _, ok := analyzer.cachedCalls(otherKey); ok {
+		t.Error("Expected cache miss for different compiler")
+	}
+}
+
+func TestTraceCacheKeyTracksContent(t *testing.T) {
+	tmpDir := t.TempDir()
+	seedPath := filepath.Join(tmpDir, "seed.c")
+
+	if err := os.WriteFile(seedPath, []byte("int x;"), 0644); err != nil {
+		t.Fatalf("Failed to write seed: %v", err)
+	}
+	analyzer := &UftraceAnalyzer{}
+	key1, err := analyzer.traceCacheKey("/usr/bin/gcc", seedPath)
+	if err != nil {
+		t.Fatalf("traceCacheKey failed: %v", err)
+	}
+
+	// Rewriting the file with identical content keeps the key stable.
+	if err := os.WriteFile(seedPath, []byte("int x;"), 0644); err != nil {
+		t.Fatalf("Failed to rewrite seed: %v", err)
+	}
+	key2, err := analyzer.traceCacheKey("/usr/bin/gcc", seedPath)
+	if err != nil {
+		t.Fatalf("traceCacheKey failed: %v", err)
+	}
+	if key1 != key2 {
+		t.Error("Expected identical content to produce identical keys")
+	}
+
+	// Changing the content changes the key.
+	if err := os.WriteFile(seedPath, []byte("int y;"), 0644); err != nil {
+		t.Fatalf("Failed to rewrite seed: %v", err)
+	}
+	key3, err := analyzer.traceCacheKey("/usr/bin/gcc", seedPath)
+	if err != nil {
+		t.Fatalf("traceCacheKey failed: %v", err)
+	}
+	if key3 == key1 {
+		t.Error("Expected changed content to produce a different key")
+	}
+}
+
+func TestTraceCacheBounded(t *testing.T) {
+	analyzer := &UftraceAnalyzer{}
+
+	for i := 0; i < maxCachedTraces; i++ {
+		analyzer.storeCalls(fmt.Sprintf("key-%d", i), []FunctionCall{{Name: "f", Depth: 0}})
+	}
+	if len(analyzer.traceCache) != maxCachedTraces {
+		t.Fatalf("Expected %d cached traces, got %d", maxCachedTraces, len(analyzer.traceCache))
+	}
+
+	// The insert past the limit resets the cache instead of growing it.
+	analyzer.storeCalls("overflow", []FunctionCall{{Name: "g", Depth: 0}})
+	if len(analyzer.traceCache) != 1 {
+		t.Errorf("Expected cache reset to 1 entry, got %d", len(analyzer.traceCache))
+	}
+	if _, ok := analyzer.cachedCalls("overflow"); !ok {
+		t.Error("Expected the newest entry to survive the reset")
+	}
+}
+
 func TestNilDivergencePoint(t *testing.T) {
 	var div *DivergencePoint
 
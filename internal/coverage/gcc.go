@@ -1,13 +1,14 @@
 package coverage
 
 import (
-	"encoding/json"
 	"fmt"
 	"os"
 	"path/filepath"
 	"strings"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/exec"
+	"github.com/zjy-dev/de-fuzz/internal/logger"
 	"github.com/zjy-dev/de-fuzz/internal/seed"
 
 	"github.com/zjy-dev/gcovr-json-util/v2/pkg/gcovr"
@@ -42,12 +43,32 @@ type GCCCoverage struct {
 	totalReportPath  string                 // Path to total.json
 	filterConfigPath string                 // Path to filter config YAML (from compiler-isa-strategy.yaml)
 	seedReportDir    string                 // Directory to store individual seed reports
+	gcovPath         string                 // gcov executable for native ingestion (empty = gcovr subprocess)
+	gcovPrefixDir    string                 // Per-worker GCOV_PREFIX directory (empty = shared build tree)
 
 	// Cached filter config (loaded once)
 	filterConfig *gcovr.FilterConfig
 
 	// Cache for last computed increase (to avoid recomputing in GetIncrease)
 	lastIncreaseReport *gcovr.CoverageIncreaseReport
+
+	// Resident merged total coverage. Loaded lazily from totalReportPath on
+	// first use (so a recovered campaign keeps its accumulated coverage),
+	// updated in memory by Merge and written back to disk only by FlushTotal.
+	// total.json grows with the campaign, so the old read-modify-write cycle
+	// made every merge pay for the full file; the resident total keeps Merge
+	// proportional to the seed report instead.
+	//
+	// totalMu guards the fields below. HasIncreased and Merge already run
+	// under the engine's merge lock, but FlushTotal is called from the
+	// checkpoint path, which the parallel engines run concurrently with
+	// merging.
+	totalMu       sync.Mutex
+	totalBuilder  *gcovrReportBuilder
+	totalSnapshot *gcovr.GcovrReport // built view of totalBuilder; nil when stale
+	totalLoaded   bool               // lazy load from totalReportPath has run
+	totalPresent  bool               // a total exists (on disk or merged in memory)
+	totalDirty    bool               // in-memory merges not yet flushed to disk
 }
 
 type targetFunctionMatcher struct {
@@ -219,8 +240,14 @@ func (g *GCCCoverage) Clean() error {
 	return nil
 }
 
-// Prepare resets runtime coverage artifacts before a new compilation.
+// Prepare resets runtime coverage artifacts before a new compilation. In
+// prefix-isolation mode only this tracker's own prefix directory is reset;
+// the full build-tree walk is skipped because the instrumented compiler no
+// longer writes there.
 func (g *GCCCoverage) Prepare() error {
+	if g.gcovPrefixDir != "" {
+		return g.resetPrefixDir()
+	}
 	return g.Clean()
 }
 
@@ -233,7 +260,7 @@ func (g *GCCCoverage) Measure(s *seed.Seed) (Report, error) {
 	}
 
 	// Step 1: Clean previous coverage data (.gcda files)
-	if err := g.Clean(); err != nil {
+	if err := g.Prepare(); err != nil {
 		return nil, fmt.Errorf("failed to clean coverage files: %w", err)
 	}
 
@@ -265,6 +292,35 @@ func (g *GCCCoverage) MeasureCompiled(s *seed.Seed) (Report, error) {
 		return nil, fmt.Errorf("failed to create seed report directory: %w", err)
 	}
 
+	// Isolation mode: the counters live in this tracker's prefix directory
+	// and are restored into the build tree under a lock for the gcov pass.
+	if g.gcovPrefixDir != "" {
+		if err := g.measureIsolated(seedReportPath); err != nil {
+			return nil, err
+		}
+		return &GcovrReport{path: seedReportPath}, nil
+	}
+
+	if err := g.measureBuildTree(seedReportPath); err != nil {
+		return nil, err
+	}
+
+	return &GcovrReport{path: seedReportPath}, nil
+}
+
+// measureBuildTree generates a coverage report from the .gcda files
+// currently sitting in the build tree (next to their .gcno files).
+func (g *GCCCoverage) measureBuildTree(seedReportPath string) error {
+	// Native path: ingest gcov --json-format output in-process instead of
+	// shelling out to gcovr (Python startup costs 400-900ms per seed).
+	if g.gcovPath != "" {
+		if err := g.measureNativeGcov(seedReportPath); err == nil {
+			return nil
+		} else {
+			logger.Warn("Native gcov ingestion failed, falling back to gcovr: %v", err)
+		}
+	}
+
 	// Build the full gcovr command
 	// Example: cd /build/gcc && gcovr --exclude '.*\.(h|hpp|hxx)$' --gcov-executable "gcov-14 --demangled-names" -r .. --json-pretty --json /path/to/<seed>.json
 	fullCommand := fmt.Sprintf("cd %s && %s --json-pretty --json %s",
@@ -275,13 +331,13 @@ func (g *GCCCoverage) MeasureCompiled(s *seed.Seed) (Report, error) {
 
 	result, err := g.executor.Run("sh", "-c", fullCommand)
 	if err != nil {
-		return nil, fmt.Errorf("failed to run gcovr: %w (stdout: %s, stderr: %s)",
+		return fmt.Errorf("failed to run gcovr: %w (stdout: %s, stderr: %s)",
 			err, result.Stdout, result.Stderr)
 	}
 
 	// Step 4: Verify the report file was created
 	if _, err := os.Stat(seedReportPath); err != nil {
-		return nil, fmt.Errorf(
+		return fmt.Errorf(
 			"gcovr report file not created: %w (command: %s, stdout: %s, stderr: %s)",
 			err,
 			fullCommand,
@@ -290,11 +346,52 @@ func (g *GCCCoverage) MeasureCompiled(s *seed.Seed) (Report, error) {
 		)
 	}
 
-	return &GcovrReport{path: seedReportPath}, nil
+	return nil
+}
+
+// loadTotal populates the resident total from total.json on first use so a
+// recovered campaign keeps its accumulated coverage. Callers must hold
+// totalMu.
+func (g *GCCCoverage) loadTotal() error {
+	if g.totalLoaded {
+		return nil
+	}
+
+	g.totalBuilder = newGcovrReportBuilder()
+	if _, err := os.Stat(g.totalReportPath); err == nil {
+		report, err := gcovr.ParseReport(g.totalReportPath)
+		if err != nil {
+			return fmt.Errorf("failed to parse base report: %w", err)
+		}
+		g.foldIntoTotal(report)
+		g.totalPresent = true
+	}
+
+	g.totalLoaded = true
+	return nil
+}
+
+// foldIntoTotal accumulates one report into the resident total and
+// invalidates the built snapshot. Callers must hold totalMu.
+func (g *GCCCoverage) foldIntoTotal(report *gcovr.GcovrReport) {
+	for i := range report.Files {
+		g.totalBuilder.addGcovrFile(&report.Files[i])
+	}
+	g.totalSnapshot = nil
+}
+
+// builtTotal returns the built view of the resident total, rebuilding it
+// only after a merge invalidated the snapshot. Callers must hold totalMu.
+func (g *GCCCoverage) builtTotal() *gcovr.GcovrReport {
+	if g.totalSnapshot == nil {
+		g.totalSnapshot = g.totalBuilder.build()
+	}
+	return g.totalSnapshot
 }
 
 // HasIncreased checks if the new report has increased coverage compared to the total.
-// If total.json doesn't exist, this is considered the first seed and returns true.
+// If no total coverage has been accumulated yet, this is considered the first
+// seed and returns true.
 func (g *GCCCoverage) HasIncreased(newReport Report) (bool, error) {
 	// Reset cached increase report
 	g.lastIncreaseReport = nil
@@ -305,15 +402,16 @@ func (g *GCCCoverage) HasIncreased(newReport Report) (bool, error) {
 		return false, fmt.Errorf("expected GcovrReport, got %T", newReport)
 	}
 
-	// If total report doesn't exist, this is the first seed
-	if _, err := os.Stat(g.totalReportPath); os.IsNotExist(err) {
-		return true, nil
+	g.totalMu.Lock()
+	defer g.totalMu.Unlock()
+
+	if err := g.loadTotal(); err != nil {
+		return false, err
 	}
 
-	// Parse the base (total) report using gcovr-json-util
-	baseReport, err := gcovr.ParseReport(g.totalReportPath)
-	if err != nil {
-		return false, fmt.Errorf("failed to parse base report: %w", err)
+	// No accumulated coverage yet: this is the first seed
+	if !g.totalPresent {
+		return true, nil
 	}
 
 	// Parse the new report using gcovr-json-util
@@ -322,7 +420,7 @@ func (g *GCCCoverage) HasIncreased(newReport Report) (bool, error) {
 		return false, fmt.Errorf("failed to parse new report: %w", err)
 	}
 
-	baseReport = g.applyTargetFilter(baseReport)
+	baseReport := g.applyTargetFilter(g.builtTotal())
 	newReportParsed = g.applyTargetFilter(newReportParsed)
 
 	// Compute coverage increase
@@ -338,9 +436,10 @@ func (g *GCCCoverage) HasIncreased(newReport Report) (bool, error) {
 	return len(increaseReport.Increases) > 0, nil
 }
 
-// Merge merges the new coverage report into the total report.
-// If total.json doesn't exist, copies the new report as total.json.
-// Otherwise, uses gcovr to merge: mv total.json tmp.json && gcovr -a tmp.json -a <seed>.json -o total.json && rm tmp.json
+// Merge folds the new coverage report into the resident total. The on-disk
+// total.json is NOT rewritten here — it used to be, and late in a campaign a
+// single merge spent over a second on JSON load/store of the grown file.
+// FlushTotal persists the total at checkpoint intervals instead.
 func (g *GCCCoverage) Merge(newReport Report) error {
 	// Get the path to the new report
 	gcovrRep, ok := newReport.(*GcovrReport)
@@ -348,71 +447,74 @@ func (g *GCCCoverage) Merge(newReport Report) error {
 		return fmt.Errorf("expected GcovrReport, got %T", newReport)
 	}
 
-	// If total report doesn't exist, just copy the new report as total
-	if _, err := os.Stat(g.totalReportPath); os.IsNotExist(err) {
-		// Ensure the directory exists
-		if err := os.MkdirAll(filepath.Dir(g.totalReportPath), 0755); err != nil {
-			return fmt.Errorf("failed to create directory for total report: %w", err)
-		}
+	g.totalMu.Lock()
+	defer g.totalMu.Unlock()
 
-		// Copy the seed report to total.json
-		data, err := os.ReadFile(gcovrRep.path)
-		if err != nil {
-			return fmt.Errorf("failed to read new report: %w", err)
-		}
+	if err := g.loadTotal(); err != nil {
+		return err
+	}
 
-		if err := os.WriteFile(g.totalReportPath, data, 0644); err != nil {
-			return fmt.Errorf("failed to write total report: %w", err)
-		}
-		return nil
+	report, err := gcovr.ParseReport(gcovrRep.path)
+	if err != nil {
+		return fmt.Errorf("failed to parse new report: %w", err)
 	}
 
-	// Merge using gcovr command as described in README:
-	// mv total.json tmp.json && gcovr --json-pretty --json total.json -a tmp.json -a <seed>.json && rm tmp.json
-	tmpReportPath := g.totalReportPath + ".tmp.json"
+	g.foldIntoTotal(report)
+	g.totalPresent = true
+	g.totalDirty = true
+	return nil
+}
 
-	// Rename current total to tmp
-	if err := os.Rename(g.totalReportPath, tmpReportPath); err != nil {
-		return fmt.Errorf("failed to rename total report to tmp: %w", err)
-	}
+// FlushTotal writes the resident total back to total.json when it has
+// unflushed merges. The engine calls it on the same cadence as the rest of
+// the checkpoint (saveState), and once more when the campaign finishes.
+func (g *GCCCoverage) FlushTotal() error {
+	g.totalMu.Lock()
+	defer g.totalMu.Unlock()
+	return g.flushTotal()
+}
 
-	// Run gcovr merge command
-	mergeCmd := fmt.Sprintf("gcovr -a %s -a %s --json-pretty --json %s",
-		tmpReportPath,
-		gcovrRep.path,
-		g.totalReportPath,
-	)
+// flushTotal is FlushTotal without the locking. Callers must hold totalMu.
+func (g *GCCCoverage) flushTotal() error {
+	if !g.totalDirty {
+		return nil
+	}
 
-	result, err := g.executor.Run("sh", "-c", mergeCmd)
-	if err != nil {
-		// Try to restore the original total.json if merge fails
-		os.Rename(tmpReportPath, g.totalReportPath)
-		return fmt.Errorf("failed to merge reports: %w (stdout: %s, stderr: %s)",
-			err, result.Stdout, result.Stderr)
+	if err := os.MkdirAll(filepath.Dir(g.totalReportPath), 0755); err != nil {
+		return fmt.Errorf("failed to create directory for total report: %w", err)
 	}
 
-	// Remove tmp file
-	os.Remove(tmpReportPath)
+	// Write-then-rename so a crash mid-flush cannot corrupt total.json.
+	tmpPath := g.totalReportPath + ".tmp.json"
+	if err := writeGcovrReport(tmpPath, g.builtTotal()); err != nil {
+		return err
+	}
+	if err := os.Rename(tmpPath, g.totalReportPath); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to replace total report: %w", err)
+	}
 
+	g.totalDirty = false
 	return nil
 }
 
-// GetTotalReport returns the current total accumulated coverage report.
+// GetTotalReport returns the current total accumulated coverage report. Any
+// unflushed in-memory merges are persisted first so the returned path-backed
+// report is current.
 func (g *GCCCoverage) GetTotalReport() (Report, error) {
-	// Check if total report exists
-	if _, err := os.Stat(g.totalReportPath); os.IsNotExist(err) {
-		return nil, fmt.Errorf("total report does not exist: %s", g.totalReportPath)
+	g.totalMu.Lock()
+	defer g.totalMu.Unlock()
+
+	if err := g.loadTotal(); err != nil {
+		return nil, err
 	}
 
-	// Validate it's valid JSON by attempting to parse it
-	var js json.RawMessage
-	data, err := os.ReadFile(g.totalReportPath)
-	if err != nil {
-		return nil, fmt.Errorf("failed to read total report: %w", err)
+	if !g.totalPresent {
+		return nil, fmt.Errorf("total report does not exist: %s", g.totalReportPath)
 	}
 
-	if err := json.Unmarshal(data, &js); err != nil {
-		return nil, fmt.Errorf("total report is not valid JSON: %w", err)
+	if err := g.flushTotal(); err != nil {
+		return nil, err
 	}
 
 	return &GcovrReport{path: g.totalReportPath}, nil
@@ -470,20 +572,22 @@ func (g *GCCCoverage) GetIncrease(newReport Report) (*CoverageIncrease, error) {
 	}, nil
 }
 
-// GetStats returns the current total coverage statistics.
+// GetStats returns the current total coverage statistics, computed from the
+// resident total without touching total.json.
 func (g *GCCCoverage) GetStats() (*CoverageStats, error) {
-	// Check if total report exists
-	if _, err := os.Stat(g.totalReportPath); os.IsNotExist(err) {
-		return &CoverageStats{}, nil // Return zero stats if no coverage yet
+	g.totalMu.Lock()
+	defer g.totalMu.Unlock()
+
+	if err := g.loadTotal(); err != nil {
+		return nil, err
 	}
 
-	// Parse the total report
-	totalReport, err := gcovr.ParseReport(g.totalReportPath)
-	if err != nil {
-		return nil, fmt.Errorf("failed to parse total report: %w", err)
+	// Return zero stats if no coverage yet
+	if !g.totalPresent {
+		return &CoverageStats{}, nil
 	}
 
-	totalReport = g.applyTargetFilter(totalReport)
+	totalReport := g.applyTargetFilter(g.builtTotal())
 
 	// Calculate coverage statistics using gcovr-json-util
 	coverageReport, err := gcovr.CalculateCoverage(totalReport)
@@ -570,6 +674,13 @@ func (g *GCCCoverage) ExtractCoveredLinesFiltered(report Report) ([]string, erro
 	return coveredLines, nil
 }
 
+// NewGcovrReport wraps an existing on-disk gcovr JSON report as a Report.
+// Replay and benchmark harnesses use it to feed fabricated reports through
+// the same extraction path as real gcovr output.
+func NewGcovrReport(path string) *GcovrReport {
+	return &GcovrReport{path: path}
+}
+
 // ExtractCoveredLinesFromPath extracts covered lines from a gcovr JSON file path.
 func ExtractCoveredLinesFromPath(reportPath string) ([]string, error) {
 	report := &GcovrReport{path: reportPath}
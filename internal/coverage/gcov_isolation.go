@@ -0,0 +1,182 @@
+package coverage
+
+import (
+	"fmt"
+	"io"
+	"io/fs"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+)
+
+// Per-worker GCOV_PREFIX isolation.
+//
+// The .gcda counters of the instrumented compiler live next to their .gcno
+// files in the shared GCC build tree, which is why compile+measure cycles
+// are strictly serialized in parallel mode: two concurrent compiles would
+// corrupt each other's counters, and Prepare() has to walk the whole tree
+// to reset them before every cycle.
+//
+// GCOV_PREFIX moves the write side out of the way. When the instrumented
+// compiler runs with GCOV_PREFIX=<dir> and GCOV_PREFIX_STRIP=0, every
+// .gcda is written under <dir> with its original absolute path appended,
+// leaving the build tree untouched. Each worker gets its own prefix
+// directory, so compiles overlap freely and Prepare() shrinks to resetting
+// that one small directory.
+//
+// Measurement still needs .gcda next to .gcno (gcov resolves the notes
+// file relative to the data file), so MeasureCompiled briefly moves the
+// worker's counters back into the build tree under a package-level lock,
+// measures, and removes them again. Compiles run concurrently; only the
+// millisecond-scale gcov pass is serialized.
+
+// buildTreeMu serializes access to the shared build tree during the
+// restore+measure+remove window of isolated measurements.
+var buildTreeMu sync.Mutex
+
+// buildTreeSweep clears counters left behind by non-isolated users (the
+// initial corpus measurement runs before the worker pool starts) exactly
+// once, instead of re-walking the tree on every cycle.
+var buildTreeSweep sync.Once
+
+// GcovPrefixEnv returns the environment assignments under which the
+// instrumented compiler must run for its .gcda files to land in prefixDir.
+// The prefix is absolutized because the compiler resolves a relative
+// GCOV_PREFIX against its own working directory.
+func GcovPrefixEnv(prefixDir string) []string {
+	if abs, err := filepath.Abs(prefixDir); err == nil {
+		prefixDir = abs
+	}
+	return []string{
+		"GCOV_PREFIX=" + prefixDir,
+		"GCOV_PREFIX_STRIP=0",
+	}
+}
+
+// EnableGcovPrefixIsolation switches the tracker into per-worker counter
+// isolation mode. The caller must run the instrumented compiler under
+// GcovPrefixEnv(prefixDir) for every compile measured by this tracker.
+func (g *GCCCoverage) EnableGcovPrefixIsolation(prefixDir string) error {
+	abs := prefixDir
+	if a, err := filepath.Abs(prefixDir); err == nil {
+		abs = a
+	}
+	if err := os.MkdirAll(abs, 0755); err != nil {
+		return fmt.Errorf("failed to create gcov prefix directory: %w", err)
+	}
+	g.gcovPrefixDir = abs
+	return nil
+}
+
+// GcovEnv returns the environment assignments for this tracker's prefix
+// directory, or nil when isolation is disabled.
+func (g *GCCCoverage) GcovEnv() []string {
+	if g.gcovPrefixDir == "" {
+		return nil
+	}
+	return GcovPrefixEnv(g.gcovPrefixDir)
+}
+
+// resetPrefixDir clears the per-worker prefix directory. This replaces the
+// full build-tree walk of Clean() on the isolated hot path.
+func (g *GCCCoverage) resetPrefixDir() error {
+	if err := os.RemoveAll(g.gcovPrefixDir); err != nil {
+		return fmt.Errorf("failed to reset gcov prefix directory: %w", err)
+	}
+	if err := os.MkdirAll(g.gcovPrefixDir, 0755); err != nil {
+		return fmt.Errorf("failed to recreate gcov prefix directory: %w", err)
+	}
+	return nil
+}
+
+// collectPrefixedGcda lists the .gcda files the instrumented compiler wrote
+// under the prefix directory, as paths relative to it. With
+// GCOV_PREFIX_STRIP=0 each relative path is the original build-tree
+// location with the leading slash removed.
+func (g *GCCCoverage) collectPrefixedGcda() ([]string, error) {
+	var files []string
+	err := filepath.WalkDir(g.gcovPrefixDir, func(path string, d fs.DirEntry, err error) error {
+		if err != nil {
+			return err
+		}
+		if d.IsDir() || !strings.HasSuffix(path, ".gcda") {
+			return nil
+		}
+		rel, err := filepath.Rel(g.gcovPrefixDir, path)
+		if err != nil {
+			return err
+		}
+		files = append(files, rel)
+		return nil
+	})
+	if err != nil {
+		return nil, fmt.Errorf("failed to walk gcov prefix directory: %w", err)
+	}
+	return files, nil
+}
+
+// measureIsolated generates the seed report from the worker's prefixed
+// counters: restore them into the build tree (next to their .gcno files),
+// run the normal measurement, then remove them. Only this window holds the
+// build-tree lock; compilation has already happened outside it.
+func (g *GCCCoverage) measureIsolated(seedReportPath string) error {
+	relPaths, err := g.collectPrefixedGcda()
+	if err != nil {
+		return err
+	}
+	if len(relPaths) == 0 {
+		return fmt.Errorf("no .gcda files under %s (was the compiler run with GcovEnv?)", g.gcovPrefixDir)
+	}
+
+	buildTreeMu.Lock()
+	defer buildTreeMu.Unlock()
+
+	var sweepErr error
+	buildTreeSweep.Do(func() { sweepErr = g.Clean() })
+	if sweepErr != nil {
+		return fmt.Errorf("failed to sweep build tree before isolated measurement: %w", sweepErr)
+	}
+
+	restored := make([]string, 0, len(relPaths))
+	defer func() {
+		for _, path := range restored {
+			os.Remove(path)
+		}
+	}()
+
+	for _, rel := range relPaths {
+		target := string(filepath.Separator) + rel
+		if err := moveGcdaFile(filepath.Join(g.gcovPrefixDir, rel), target); err != nil {
+			return fmt.Errorf("failed to restore %s into build tree: %w", rel, err)
+		}
+		restored = append(restored, target)
+	}
+
+	return g.measureBuildTree(seedReportPath)
+}
+
+// moveGcdaFile moves a counter file into place, falling back to copy+remove
+// when the prefix directory sits on a different filesystem.
+func moveGcdaFile(src, dst string) error {
+	if err := os.Rename(src, dst); err == nil {
+		return nil
+	}
+	in, err := os.Open(src)
+	if err != nil {
+		return err
+	}
+	defer in.Close()
+	out, err := os.Create(dst)
+	if err != nil {
+		return err
+	}
+	if _, err := io.Copy(out, in); err != nil {
+		out.Close()
+		return err
+	}
+	if err := out.Close(); err != nil {
+		return err
+	}
+	return os.Remove(src)
+}
@@ -0,0 +1,154 @@
+package coverage
+
+import (
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+
+	"github.com/zjy-dev/de-fuzz/internal/exec"
+)
+
+func TestGcovPrefixEnv(t *testing.T) {
+	env := GcovPrefixEnv("/tmp/worker-0/gcov-prefix")
+
+	if len(env) != 2 {
+		t.Fatalf("GcovPrefixEnv() returned %d assignments, want 2", len(env))
+	}
+	if env[0] != "GCOV_PREFIX=/tmp/worker-0/gcov-prefix" {
+		t.Errorf("unexpected GCOV_PREFIX assignment: %s", env[0])
+	}
+	if env[1] != "GCOV_PREFIX_STRIP=0" {
+		t.Errorf("unexpected GCOV_PREFIX_STRIP assignment: %s", env[1])
+	}
+
+	// A relative prefix must be absolutized: the compiler resolves it
+	// against its own working directory, not ours.
+	env = GcovPrefixEnv("relative/prefix")
+	if !strings.HasPrefix(env[0], "GCOV_PREFIX=/") {
+		t.Errorf("relative prefix was not absolutized: %s", env[0])
+	}
+}
+
+func TestGCCCoverage_PrepareIsolated_ResetsOnlyPrefixDir(t *testing.T) {
+	buildTree, err := os.MkdirTemp("", "gcov-isolation-test-*")
+	if err != nil {
+		t.Fatalf("Failed to create temp dir: %v", err)
+	}
+	defer os.RemoveAll(buildTree)
+
+	// A counter in the build tree must survive isolated Prepare: only the
+	// per-worker prefix directory is reset, the tree walk is skipped.
+	treeGcda := filepath.Join(buildTree, "cc1.gcda")
+	if err := os.WriteFile(treeGcda, []byte("counters"), 0644); err != nil {
+		t.Fatalf("Failed to create build-tree .gcda: %v", err)
+	}
+
+	gcc := NewGCCCoverage(
+		exec.NewCommandExecutor(),
+		nil,
+		buildTree,
+		"gcovr",
+		filepath.Join(buildTree, "total.json"),
+		"",
+	)
+
+	prefixDir := filepath.Join(buildTree, "worker-0", "gcov-prefix")
+	if err := gcc.EnableGcovPrefixIsolation(prefixDir); err != nil {
+		t.Fatalf("EnableGcovPrefixIsolation() error = %v", err)
+	}
+
+	staleGcda := filepath.Join(prefixDir, "stale.gcda")
+	if err := os.WriteFile(staleGcda, []byte("stale"), 0644); err != nil {
+		t.Fatalf("Failed to create stale prefixed .gcda: %v", err)
+	}
+
+	if err := gcc.Prepare(); err != nil {
+		t.Fatalf("Prepare() error = %v", err)
+	}
+
+	if _, err := os.Stat(staleGcda); !os.IsNotExist(err) {
+		t.Error("Prepare() did not reset the prefix directory")
+	}
+	if _, err := os.Stat(prefixDir); err != nil {
+		t.Errorf("Prepare() did not recreate the prefix directory: %v", err)
+	}
+	if _, err := os.Stat(treeGcda); err != nil {
+		t.Error("Prepare() must not touch the build tree in isolation mode")
+	}
+}
+
+func TestGCCCoverage_CollectPrefixedGcda(t *testing.T) {
+	tmpDir, err := os.MkdirTemp("", "gcov-isolation-test-*")
+	if err != nil {
+		t.Fatalf("Failed to create temp dir: %v", err)
+	}
+	defer os.RemoveAll(tmpDir)
+
+	gcc := NewGCCCoverage(
+		exec.NewCommandExecutor(),
+		nil,
+		tmpDir,
+		"gcovr",
+		filepath.Join(tmpDir, "total.json"),
+		"",
+	)
+	prefixDir := filepath.Join(tmpDir, "gcov-prefix")
+	if err := gcc.EnableGcovPrefixIsolation(prefixDir); err != nil {
+		t.Fatalf("EnableGcovPrefixIsolation() error = %v", err)
+	}
+
+	// With GCOV_PREFIX_STRIP=0 the compiler mirrors the original absolute
+	// path under the prefix directory.
+	mirrored := filepath.Join(prefixDir, "build", "gcc", "cc1.gcda")
+	if err := os.MkdirAll(filepath.Dir(mirrored), 0755); err != nil {
+		t.Fatalf("Failed to create mirrored directory: %v", err)
+	}
+	if err := os.WriteFile(mirrored, []byte("counters"), 0644); err != nil {
+		t.Fatalf("Failed to create mirrored .gcda: %v", err)
+	}
+	// Non-.gcda files must be ignored.
+	if err := os.WriteFile(filepath.Join(prefixDir, "build", "gcc", "cc1.gcno"), []byte("notes"), 0644); err != nil {
+		t.Fatalf("Failed to create .gcno: %v", err)
+	}
+
+	files, err := gcc.collectPrefixedGcda()
+	if err != nil {
+		t.Fatalf("collectPrefixedGcda() error = %v", err)
+	}
+	if len(files) != 1 {
+		t.Fatalf("collectPrefixedGcda() returned %d files, want 1: %v", len(files), files)
+	}
+	if files[0] != filepath.Join("build", "gcc", "cc1.gcda") {
+		t.Errorf("unexpected relative path: %s", files[0])
+	}
+}
+
+func TestMoveGcdaFile(t *testing.T) {
+	tmpDir, err := os.MkdirTemp("", "gcov-isolation-test-*")
+	if err != nil {
+		t.Fatalf("Failed to create temp dir: %v", err)
+	}
+	defer os.RemoveAll(tmpDir)
+
+	src := filepath.Join(tmpDir, "src.gcda")
+	dst := filepath.Join(tmpDir, "dst.gcda")
+	if err := os.WriteFile(src, []byte("counters"), 0644); err != nil {
+		t.Fatalf("Failed to create source file: %v", err)
+	}
+
+	if err := moveGcdaFile(src, dst); err != nil {
+		t.Fatalf("moveGcdaFile() error = %v", err)
+	}
+
+	if _, err := os.Stat(src); !os.IsNotExist(err) {
+		t.Error("source file was not removed")
+	}
+	data, err := os.ReadFile(dst)
+	if err != nil {
+		t.Fatalf("Failed to read destination: %v", err)
+	}
+	if string(data) != "counters" {
+		t.Errorf("destination content = %q, want %q", data, "counters")
+	}
+}
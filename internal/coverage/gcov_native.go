@@ -0,0 +1,334 @@
+package coverage
+
+import (
+	"compress/gzip"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+
+	"github.com/zjy-dev/gcovr-json-util/v2/pkg/gcovr"
+)
+
+// Native gcov-JSON ingestion.
+//
+// gcovr is a Python tool: interpreter startup plus full-report serialization
+// costs 400-900ms per coverage measurement, every iteration. The native path
+// instead runs the (native, millisecond-scale) `gcov --json-format` binary
+// once over the .gcda files and parses its intermediate JSON in-process,
+// emitting a report in the same gcovr JSON shape so HasIncreased, Merge,
+// ExtractCoveredLinesFiltered and the target filter all work unchanged.
+// gcovr remains the fallback whenever the native path fails. Report merging
+// itself happens against the resident total in gcc.go and needs no
+// subprocess at all.
+
+// nativeReportFormatVersion is written into natively produced reports; it
+// matches the gcovr JSON format the rest of the pipeline already consumes.
+const nativeReportFormatVersion = "0.5"
+
+// gcovJSONOutput mirrors the top level of a `gcov --json-format` document
+// (one per .gcda file, gzip-compressed as <source>.gcov.json.gz).
+type gcovJSONOutput struct {
+	FormatVersion string         `json:"format_version"`
+	DataFile      string         `json:"data_file"`
+	Files         []gcovJSONFile `json:"files"`
+}
+
+type gcovJSONFile struct {
+	File      string             `json:"file"`
+	Functions []gcovJSONFunction `json:"functions"`
+	Lines     []gcovJSONLine     `json:"lines"`
+}
+
+type gcovJSONFunction struct {
+	Name           string `json:"name"`
+	DemangledName  string `json:"demangled_name"`
+	StartLine      int    `json:"start_line"`
+	ExecutionCount int64  `json:"execution_count"`
+}
+
+type gcovJSONLine struct {
+	LineNumber   int    `json:"line_number"`
+	Count        int64  `json:"count"`
+	FunctionName string `json:"function_name"`
+}
+
+// EnableNativeGcov switches Measure/Merge onto the native ingestion path.
+// gcovPath must be the gcov executable matching the instrumented compiler
+// (e.g. gcov-14); a mismatched gcov cannot read the .gcda format.
+func (g *GCCCoverage) EnableNativeGcov(gcovPath string) {
+	g.gcovPath = gcovPath
+}
+
+// measureNativeGcov produces a gcovr-shaped JSON report at seedReportPath by
+// running gcov --json-format over the .gcda files and aggregating its
+// intermediate output in-process.
+func (g *GCCCoverage) measureNativeGcov(seedReportPath string) error {
+	searchPath := g.gcovrExecPath
+	if abs, err := filepath.Abs(searchPath); err == nil {
+		searchPath = abs
+	}
+
+	// gcov writes its .gcov.json.gz files into the working directory, so run
+	// it inside a scratch dir to keep the build tree clean. A single xargs
+	// batch invocation keeps subprocess count at one for the common case.
+	tmpDir, err := os.MkdirTemp(g.seedReportDir, "gcov-native-")
+	if err != nil {
+		return fmt.Errorf("failed to create gcov scratch dir: %w", err)
+	}
+	defer os.RemoveAll(tmpDir)
+
+	gcovCmd := fmt.Sprintf(
+		"cd %s && find %s -name '*.gcda' -print0 | xargs -0 -r %s --json-format >/dev/null",
+		tmpDir, searchPath, g.gcovPath,
+	)
+	if result, err := g.executor.Run("sh", "-c", gcovCmd); err != nil {
+		return fmt.Errorf("failed to run gcov: %w (stdout: %s, stderr: %s)",
+			err, result.Stdout, result.Stderr)
+	}
+
+	report, err := aggregateGcovJSONDir(tmpDir)
+	if err != nil {
+		return err
+	}
+
+	return writeGcovrReport(seedReportPath, report)
+}
+
+// aggregateGcovJSONDir parses every .gcov.json.gz under dir and folds them
+// into a single gcovr-shaped report. The same source file can appear in
+// several gcov documents (headers compiled into multiple translation units),
+// so line counts are summed per (file, line).
+func aggregateGcovJSONDir(dir string) (*gcovr.GcovrReport, error) {
+	entries, err := os.ReadDir(dir)
+	if err != nil {
+		return nil, fmt.Errorf("failed to read gcov output dir: %w", err)
+	}
+
+	builder := newGcovrReportBuilder()
+	parsed := 0
+	for _, entry := range entries {
+		if entry.IsDir() || filepath.Ext(entry.Name()) != ".gz" {
+			continue
+		}
+		output, err := parseGcovJSONFile(filepath.Join(dir, entry.Name()))
+		if err != nil {
+			return nil, err
+		}
+		for i := range output.Files {
+			builder.addFile(&output.Files[i])
+		}
+		parsed++
+	}
+
+	if parsed == 0 {
+		return nil, fmt.Errorf("gcov produced no JSON output in %s (no .gcda files?)", dir)
+	}
+
+	return builder.build(), nil
+}
+
+// parseGcovJSONFile decompresses and decodes one gcov intermediate document.
+func parseGcovJSONFile(path string) (*gcovJSONOutput, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open gcov output %s: %w", path, err)
+	}
+	defer f.Close()
+
+	gz, err := gzip.NewReader(f)
+	if err != nil {
+		return nil, fmt.Errorf("failed to decompress gcov output %s: %w", path, err)
+	}
+	defer gz.Close()
+
+	var output gcovJSONOutput
+	if err := json.NewDecoder(gz).Decode(&output); err != nil {
+		return nil, fmt.Errorf("failed to decode gcov output %s: %w", path, err)
+	}
+	return &output, nil
+}
+
+// gcovrReportBuilder accumulates gcov documents into per-file line and
+// function tables keyed for deduplication.
+type gcovrReportBuilder struct {
+	files map[string]*gcovrFileBuilder
+}
+
+type gcovrFileBuilder struct {
+	path      string
+	lines     map[int]*gcovr.Line
+	functions map[string]*gcovr.Function
+	// mangledToDemangled rewrites gcov's mangled per-line function names to
+	// the demangled form, matching gcovr's --demangled-names output that the
+	// target filter and coverage mapping were built against.
+	mangledToDemangled map[string]string
+}
+
+func newGcovrReportBuilder() *gcovrReportBuilder {
+	return &gcovrReportBuilder{files: make(map[string]*gcovrFileBuilder)}
+}
+
+func (b *gcovrReportBuilder) addFile(file *gcovJSONFile) {
+	if len(file.Lines) == 0 && len(file.Functions) == 0 {
+		return
+	}
+
+	path := normalizeCoveragePath(file.File)
+	fb, ok := b.files[path]
+	if !ok {
+		fb = &gcovrFileBuilder{
+			path:               path,
+			lines:              make(map[int]*gcovr.Line),
+			functions:          make(map[string]*gcovr.Function),
+			mangledToDemangled: make(map[string]string),
+		}
+		b.files[path] = fb
+	}
+
+	for i := range file.Functions {
+		fn := &file.Functions[i]
+		if fn.DemangledName != "" {
+			fb.mangledToDemangled[fn.Name] = fn.DemangledName
+		}
+		if _, exists := fb.functions[fn.Name]; !exists {
+			fb.functions[fn.Name] = &gcovr.Function{
+				Name:          fn.Name,
+				DemangledName: fn.DemangledName,
+			}
+		}
+	}
+
+	for i := range file.Lines {
+		line := &file.Lines[i]
+		functionName := line.FunctionName
+		if demangled, ok := fb.mangledToDemangled[functionName]; ok {
+			functionName = demangled
+		}
+		if existing, ok := fb.lines[line.LineNumber]; ok {
+			existing.Count += int(line.Count)
+		} else {
+			fb.lines[line.LineNumber] = &gcovr.Line{
+				LineNumber:   line.LineNumber,
+				Count:        int(line.Count),
+				FunctionName: functionName,
+			}
+		}
+	}
+}
+
+// build renders the accumulated state as a gcovr report with deterministic
+// (sorted) file and line ordering.
+func (b *gcovrReportBuilder) build() *gcovr.GcovrReport {
+	report := &gcovr.GcovrReport{
+		FormatVersion: nativeReportFormatVersion,
+		Files:         make([]gcovr.File, 0, len(b.files)),
+	}
+
+	paths := make([]string, 0, len(b.files))
+	for path := range b.files {
+		paths = append(paths, path)
+	}
+	sort.Strings(paths)
+
+	for _, path := range paths {
+		fb := b.files[path]
+		file := gcovr.File{
+			FilePath:  fb.path,
+			Lines:     make([]gcovr.Line, 0, len(fb.lines)),
+			Functions: make([]gcovr.Function, 0, len(fb.functions)),
+		}
+
+		lineNumbers := make([]int, 0, len(fb.lines))
+		for n := range fb.lines {
+			lineNumbers = append(lineNumbers, n)
+		}
+		sort.Ints(lineNumbers)
+		for _, n := range lineNumbers {
+			file.Lines = append(file.Lines, *fb.lines[n])
+		}
+
+		names := make([]string, 0, len(fb.functions))
+		for name := range fb.functions {
+			names = append(names, name)
+		}
+		sort.Strings(names)
+		for _, name := range names {
+			file.Functions = append(file.Functions, *fb.functions[name])
+		}
+
+		report.Files = append(report.Files, file)
+	}
+
+	return report
+}
+
+// mergeGcovrReports folds the coverage of add into base: line counts sum,
+// files and functions union. Both inputs are left untouched; the merged
+// report is returned. This is the in-process equivalent of `gcovr -a`.
+func mergeGcovrReports(base, add *gcovr.GcovrReport) *gcovr.GcovrReport {
+	builder := newGcovrReportBuilder()
+	for _, report := range []*gcovr.GcovrReport{base, add} {
+		if report == nil {
+			continue
+		}
+		for i := range report.Files {
+			builder.addGcovrFile(&report.Files[i])
+		}
+	}
+
+	merged := builder.build()
+	if base != nil && base.FormatVersion != "" {
+		merged.FormatVersion = base.FormatVersion
+	}
+	return merged
+}
+
+// addGcovrFile folds an already gcovr-shaped file into the builder (used by
+// merging, where inputs carry demangled names already).
+func (b *gcovrReportBuilder) addGcovrFile(file *gcovr.File) {
+	path := normalizeCoveragePath(file.FilePath)
+	fb, ok := b.files[path]
+	if !ok {
+		fb = &gcovrFileBuilder{
+			path:               path,
+			lines:              make(map[int]*gcovr.Line),
+			functions:          make(map[string]*gcovr.Function),
+			mangledToDemangled: make(map[string]string),
+		}
+		b.files[path] = fb
+	}
+
+	for i := range file.Functions {
+		fn := file.Functions[i]
+		if _, exists := fb.functions[fn.Name]; !exists {
+			fnCopy := fn
+			fb.functions[fn.Name] = &fnCopy
+		}
+	}
+
+	for i := range file.Lines {
+		line := file.Lines[i]
+		if existing, ok := fb.lines[line.LineNumber]; ok {
+			existing.Count += line.Count
+		} else {
+			lineCopy := line
+			fb.lines[line.LineNumber] = &lineCopy
+		}
+	}
+}
+
+// writeGcovrReport serializes a report using the gcovr JSON field names (the
+// library's struct tags), so gcovr.ParseReport and external gcovr tooling
+// both read it back.
+func writeGcovrReport(path string, report *gcovr.GcovrReport) error {
+	data, err := json.MarshalIndent(report, "", "  ")
+	if err != nil {
+		return fmt.Errorf("failed to marshal report: %w", err)
+	}
+	if err := os.WriteFile(path, data, 0644); err != nil {
+		return fmt.Errorf("failed to write report %s: %w", path, err)
+	}
+	return nil
+}
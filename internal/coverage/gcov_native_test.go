@@ -0,0 +1,187 @@
+package coverage
+
+import (
+	"compress/gzip"
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/zjy-dev/gcovr-json-util/v2/pkg/gcovr"
+)
+
+// writeGcovFixture writes a gcov --json-format document the way gcov does:
+// gzip-compressed JSON named <something>.gcov.json.gz.
+func writeGcovFixture(t *testing.T, dir, name string, output *gcovJSONOutput) {
+	t.Helper()
+
+	f, err := os.Create(filepath.Join(dir, name))
+	if err != nil {
+		t.Fatalf("failed to create fixture: %v", err)
+	}
+	defer f.Close()
+
+	gz := gzip.NewWriter(f)
+	if err := json.NewEncoder(gz).Encode(output); err != nil {
+		t.Fatalf("failed to encode fixture: %v", err)
+	}
+	if err := gz.Close(); err != nil {
+		t.Fatalf("failed to close gzip writer: %v", err)
+	}
+}
+
+func TestAggregateGcovJSONDir_MergesFilesAndDemangles(t *testing.T) {
+	dir := t.TempDir()
+
+	// Two gcov documents covering the same header: the aggregate must sum
+	// line counts and rewrite line function names to the demangled form.
+	writeGcovFixture(t, dir, "a.gcov.json.gz", &gcovJSONOutput{
+		FormatVersion: "1",
+		DataFile:      "a.gcda",
+		Files: []gcovJSONFile{
+			{
+				File: "gcc/cfgexpand.cc",
+				Functions: []gcovJSONFunction{
+					{Name: "_Z10expand_gimP4treeb", DemangledName: "expand_gimple(tree*, bool)", StartLine: 10, ExecutionCount: 2},
+				},
+				Lines: []gcovJSONLine{
+					{LineNumber: 12, Count: 2, FunctionName: "_Z10expand_gimP4treeb"},
+					{LineNumber: 13, Count: 0, FunctionName: "_Z10expand_gimP4treeb"},
+				},
+			},
+		},
+	})
+	writeGcovFixture(t, dir, "b.gcov.json.gz", &gcovJSONOutput{
+		FormatVersion: "1",
+		DataFile:      "b.gcda",
+		Files: []gcovJSONFile{
+			{
+				File: "gcc/cfgexpand.cc",
+				Functions: []gcovJSONFunction{
+					{Name: "_Z10expand_gimP4treeb", DemangledName: "expand_gimple(tree*, bool)", StartLine: 10, ExecutionCount: 1},
+				},
+				Lines: []gcovJSONLine{
+					{LineNumber: 12, Count: 3, FunctionName: "_Z10expand_gimP4treeb"},
+				},
+			},
+		},
+	})
+
+	report, err := aggregateGcovJSONDir(dir)
+	if err != nil {
+		t.Fatalf("aggregateGcovJSONDir failed: %v", err)
+	}
+
+	if len(report.Files) != 1 {
+		t.Fatalf("expected 1 merged file, got %d", len(report.Files))
+	}
+	file := report.Files[0]
+	if file.FilePath != "gcc/cfgexpand.cc" {
+		t.Errorf("FilePath = %q", file.FilePath)
+	}
+	if len(file.Lines) != 2 {
+		t.Fatalf("expected 2 lines, got %d", len(file.Lines))
+	}
+	if file.Lines[0].LineNumber != 12 || file.Lines[0].Count != 5 {
+		t.Errorf("line 12: got number=%d count=%d, want 12/5", file.Lines[0].LineNumber, file.Lines[0].Count)
+	}
+	if file.Lines[0].FunctionName != "expand_gimple(tree*, bool)" {
+		t.Errorf("line function name not demangled: %q", file.Lines[0].FunctionName)
+	}
+	if len(file.Functions) != 1 {
+		t.Fatalf("expected 1 function, got %d", len(file.Functions))
+	}
+	if file.Functions[0].DemangledName != "expand_gimple(tree*, bool)" {
+		t.Errorf("function demangled name = %q", file.Functions[0].DemangledName)
+	}
+}
+
+func TestAggregateGcovJSONDir_EmptyDirErrors(t *testing.T) {
+	if _, err := aggregateGcovJSONDir(t.TempDir()); err == nil {
+		t.Fatal("expected error when no gcov output exists")
+	}
+}
+
+func TestAggregateGcovJSONDir_RoundTripsThroughParseReport(t *testing.T) {
+	dir := t.TempDir()
+	writeGcovFixture(t, dir, "a.gcov.json.gz", &gcovJSONOutput{
+		FormatVersion: "1",
+		Files: []gcovJSONFile{
+			{
+				File:  "gcc/function.cc",
+				Lines: []gcovJSONLine{{LineNumber: 100, Count: 1, FunctionName: "assign_parms"}},
+			},
+		},
+	})
+
+	report, err := aggregateGcovJSONDir(dir)
+	if err != nil {
+		t.Fatalf("aggregateGcovJSONDir failed: %v", err)
+	}
+
+	// The written report must be readable by the same parser that consumes
+	// gcovr's own output (HasIncreased, GetStats, ExtractCoveredLines...).
+	reportPath := filepath.Join(dir, "seed.json")
+	if err := writeGcovrReport(reportPath, report); err != nil {
+		t.Fatalf("writeGcovrReport failed: %v", err)
+	}
+	parsed, err := gcovr.ParseReport(reportPath)
+	if err != nil {
+		t.Fatalf("ParseReport rejected native report: %v", err)
+	}
+	if len(parsed.Files) != 1 || parsed.Files[0].FilePath != "gcc/function.cc" {
+		t.Fatalf("round-trip mismatch: %+v", parsed.Files)
+	}
+}
+
+func TestMergeGcovrReports_SumsLineCounts(t *testing.T) {
+	base := &gcovr.GcovrReport{
+		FormatVersion: nativeReportFormatVersion,
+		Files: []gcovr.File{
+			{
+				FilePath: "gcc/cfgexpand.cc",
+				Lines: []gcovr.Line{
+					{LineNumber: 10, Count: 1, FunctionName: "expand_one"},
+					{LineNumber: 11, Count: 0, FunctionName: "expand_one"},
+				},
+			},
+		},
+	}
+	add := &gcovr.GcovrReport{
+		FormatVersion: nativeReportFormatVersion,
+		Files: []gcovr.File{
+			{
+				FilePath: "gcc/cfgexpand.cc",
+				Lines: []gcovr.Line{
+					{LineNumber: 11, Count: 4, FunctionName: "expand_one"},
+				},
+			},
+			{
+				FilePath: "gcc/function.cc",
+				Lines: []gcovr.Line{
+					{LineNumber: 7, Count: 2, FunctionName: "assign_parms"},
+				},
+			},
+		},
+	}
+
+	merged := mergeGcovrReports(base, add)
+
+	if len(merged.Files) != 2 {
+		t.Fatalf("expected 2 files after merge, got %d", len(merged.Files))
+	}
+	// Files come back sorted by path.
+	cfg := merged.Files[0]
+	if cfg.FilePath != "gcc/cfgexpand.cc" || len(cfg.Lines) != 2 {
+		t.Fatalf("unexpected first file: %+v", cfg)
+	}
+	if cfg.Lines[0].Count != 1 {
+		t.Errorf("line 10 count = %d, want 1", cfg.Lines[0].Count)
+	}
+	if cfg.Lines[1].Count != 4 {
+		t.Errorf("line 11 count = %d, want 0+4", cfg.Lines[1].Count)
+	}
+	if merged.Files[1].FilePath != "gcc/function.cc" {
+		t.Errorf("second file = %q", merged.Files[1].FilePath)
+	}
+}
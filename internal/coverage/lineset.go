@@ -0,0 +1,107 @@
+package coverage
+
+import (
+	"math/bits"
+	"sync"
+)
+
+// Interned line-ID table and bitset coverage representation.
+//
+// The analyzer's hot paths (CheckNewCoverage on every measured seed, the
+// reachability scans in SelectTarget, the per-summary coverage stats) used to
+// copy and hash map[LineID]bool snapshots with ~10k entries. Interning every
+// LineID to a dense integer once lets coverage live in fixed-size bitsets, so
+// membership checks are a shift and a mask and "any new line?" is a handful
+// of word-wise operations instead of thousands of string/struct hashes.
+
+// lineInterner assigns each distinct LineID a dense index. CFG lines are
+// interned up front at parse time; lines observed at runtime outside the CFG
+// universe (e.g. from inlined code) are appended on first sight.
+type lineInterner struct {
+	mu    sync.RWMutex
+	ids   map[LineID]uint32
+	lines []LineID
+}
+
+func newLineInterner() *lineInterner {
+	return &lineInterner{ids: make(map[LineID]uint32)}
+}
+
+// intern returns the dense index for the line, assigning one if needed.
+func (t *lineInterner) intern(line LineID) uint32 {
+	t.mu.RLock()
+	id, ok := t.ids[line]
+	t.mu.RUnlock()
+	if ok {
+		return id
+	}
+
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	if id, ok := t.ids[line]; ok {
+		return id
+	}
+	id = uint32(len(t.lines))
+	t.ids[line] = id
+	t.lines = append(t.lines, line)
+	return id
+}
+
+// lookup returns the index for a line without assigning a new one.
+func (t *lineInterner) lookup(line LineID) (uint32, bool) {
+	t.mu.RLock()
+	defer t.mu.RUnlock()
+	id, ok := t.ids[line]
+	return id, ok
+}
+
+// lineAt returns the LineID for a dense index.
+func (t *lineInterner) lineAt(id uint32) LineID {
+	t.mu.RLock()
+	defer t.mu.RUnlock()
+	return t.lines[id]
+}
+
+// size returns the number of interned lines.
+func (t *lineInterner) size() int {
+	t.mu.RLock()
+	defer t.mu.RUnlock()
+	return len(t.lines)
+}
+
+// bitset is a growable set of dense line indexes.
+type bitset struct {
+	words []uint64
+}
+
+func (b *bitset) set(i uint32) {
+	word := int(i >> 6)
+	for word >= len(b.words) {
+		b.words = append(b.words, 0)
+	}
+	b.words[word] |= 1 << (i & 63)
+}
+
+func (b *bitset) get(i uint32) bool {
+	word := int(i >> 6)
+	if word >= len(b.words) {
+		return false
+	}
+	return b.words[word]&(1<<(i&63)) != 0
+}
+
+// count returns the number of set bits.
+func (b *bitset) count() int {
+	total := 0
+	for _, w := range b.words {
+		total += bits.OnesCount64(w)
+	}
+	return total
+}
+
+// clear resets the set without releasing storage.
+func (b *bitset) clear() {
+	for i := range b.words {
+		b.words[i] = 0
+	}
+}
@@ -0,0 +1,77 @@
+package coverage
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestLineInterner_StableDenseIDs(t *testing.T) {
+	interner := newLineInterner()
+
+	a := interner.intern(LineID{File: "gcc/cfgexpand.cc", Line: 100})
+	b := interner.intern(LineID{File: "gcc/cfgexpand.cc", Line: 101})
+	assert.Equal(t, uint32(0), a)
+	assert.Equal(t, uint32(1), b)
+
+	// Re-interning must return the same index.
+	assert.Equal(t, a, interner.intern(LineID{File: "gcc/cfgexpand.cc", Line: 100}))
+	assert.Equal(t, 2, interner.size())
+
+	idx, ok := interner.lookup(LineID{File: "gcc/cfgexpand.cc", Line: 101})
+	require.True(t, ok)
+	assert.Equal(t, b, idx)
+
+	_, ok = interner.lookup(LineID{File: "gcc/function.cc", Line: 1})
+	assert.False(t, ok)
+
+	assert.Equal(t, LineID{File: "gcc/cfgexpand.cc", Line: 100}, interner.lineAt(a))
+}
+
+func TestBitset_SetGetCount(t *testing.T) {
+	var b bitset
+
+	assert.False(t, b.get(0))
+	assert.False(t, b.get(1000))
+
+	b.set(0)
+	b.set(63)
+	b.set(64)
+	b.set(9999)
+
+	assert.True(t, b.get(0))
+	assert.True(t, b.get(63))
+	assert.True(t, b.get(64))
+	assert.True(t, b.get(9999))
+	assert.False(t, b.get(65))
+	assert.Equal(t, 4, b.count())
+
+	b.clear()
+	assert.False(t, b.get(0))
+	assert.Equal(t, 0, b.count())
+}
+
+// TestAnalyzer_BitsetTracksMapping: RecordCoverage must keep the bitset and
+// the mapping in sync so CheckNewCoverage answers from bits alone.
+func TestAnalyzer_BitsetTracksMapping(t *testing.T) {
+	cm, err := NewCoverageMapping("")
+	require.NoError(t, err)
+
+	analyzer := &Analyzer{
+		mapping:   cm,
+		lineIndex: newLineInterner(),
+	}
+
+	assert.True(t, analyzer.CheckNewCoverage([]string{"a.c:10"}))
+
+	analyzer.RecordCoverage(1, []string{"a.c:10", "a.c:12"})
+
+	assert.False(t, analyzer.CheckNewCoverage([]string{"a.c:10", "a.c:12"}))
+	assert.True(t, analyzer.CheckNewCoverage([]string{"a.c:10", "a.c:13"}))
+	assert.True(t, analyzer.IsLineCovered("a.c", 12))
+	assert.False(t, analyzer.IsLineCovered("a.c", 13))
+
+	// The mapping stayed the source of truth.
+	assert.True(t, cm.IsCovered(LineID{File: "a.c", Line: 10}))
+}
@@ -0,0 +1,324 @@
+package coverage
+
+import (
+	"bufio"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"os"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+// Append-only binary delta log for CoverageMapping.
+//
+// Checkpointing used to rewrite the whole line-to-seed mapping as JSON every
+// save; on long campaigns that file grows to hundreds of megabytes and each
+// checkpoint stalls the fuzzing loop for seconds. The log instead appends
+// only the (seed, newly covered lines) deltas as they happen, so a checkpoint
+// is a buffer flush, and restart replays the log sequentially instead of
+// unmarshaling a giant JSON document. Finalize compacts the log back to one
+// record per seed and still emits the JSON snapshot for external tooling.
+//
+// File layout (all integers little-endian):
+//
+//	header:  "DFCM" + uint32 version
+//	records: recFile  = 0x01, uint32 len, len bytes (interned file path;
+//	         implicit ID = number of file records seen so far)
+//	         recDelta = 0x02, int64 seed ID, uint32 n,
+//	         n x (uint32 file ID, uint32 line)
+//
+// A torn trailing record (crash mid-append) is detected on replay and
+// truncated away; everything before it is intact.
+
+const (
+	mappingLogMagic   = "DFCM"
+	mappingLogVersion = uint32(1)
+
+	recFile  = byte(0x01)
+	recDelta = byte(0x02)
+)
+
+// mappingLog is the open handle on the delta log. It has no locking of its
+// own: CoverageMapping calls it under its own mutex.
+type mappingLog struct {
+	path    string
+	f       *os.File
+	w       *bufio.Writer
+	fileIDs map[string]uint32
+	files   []string
+}
+
+// openMappingLog opens (or creates) the log at path and replays any existing
+// records through record, which receives each (seedID, line) pair.
+func openMappingLog(path string, record func(seedID int64, line LineID)) (*mappingLog, error) {
+	f, err := os.OpenFile(path, os.O_CREATE|os.O_RDWR, 0644)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open mapping log: %w", err)
+	}
+
+	l := &mappingLog{
+		path:    path,
+		f:       f,
+		fileIDs: make(map[string]uint32),
+	}
+
+	goodOffset, err := l.replay(record)
+	if err != nil {
+		f.Close()
+		return nil, err
+	}
+
+	// Drop any torn trailing record and position for appends.
+	if err := f.Truncate(goodOffset); err != nil {
+		f.Close()
+		return nil, fmt.Errorf("failed to truncate mapping log: %w", err)
+	}
+	if _, err := f.Seek(goodOffset, io.SeekStart); err != nil {
+		f.Close()
+		return nil, fmt.Errorf("failed to seek mapping log: %w", err)
+	}
+
+	l.w = bufio.NewWriter(f)
+	if goodOffset == 0 {
+		if err := l.writeHeader(); err != nil {
+			f.Close()
+			return nil, err
+		}
+	}
+
+	return l, nil
+}
+
+func (l *mappingLog) writeHeader() error {
+	if _, err := l.w.WriteString(mappingLogMagic); err != nil {
+		return fmt.Errorf("failed to write mapping log header: %w", err)
+	}
+	if err := binary.Write(l.w, binary.LittleEndian, mappingLogVersion); err != nil {
+		return fmt.Errorf("failed to write mapping log version: %w", err)
+	}
+	return nil
+}
+
+// replay reads the log from the start, feeding every delta pair to record,
+// and returns the offset of the last fully intact record.
+func (l *mappingLog) replay(record func(seedID int64, line LineID)) (int64, error) {
+	info, err := l.f.Stat()
+	if err != nil {
+		return 0, fmt.Errorf("failed to stat mapping log: %w", err)
+	}
+	if info.Size() == 0 {
+		return 0, nil
+	}
+
+	r := bufio.NewReader(l.f)
+
+	magic := make([]byte, len(mappingLogMagic))
+	if _, err := io.ReadFull(r, magic); err != nil || string(magic) != mappingLogMagic {
+		return 0, fmt.Errorf("mapping log %s has bad magic", l.path)
+	}
+	var version uint32
+	if err := binary.Read(r, binary.LittleEndian, &version); err != nil {
+		return 0, fmt.Errorf("mapping log %s has truncated header", l.path)
+	}
+	if version != mappingLogVersion {
+		return 0, fmt.Errorf("mapping log %s has unsupported version %d", l.path, version)
+	}
+
+	offset := int64(len(mappingLogMagic)) + 4
+	for {
+		recordLen, err := l.replayOne(r, record)
+		if err == io.EOF {
+			return offset, nil
+		}
+		if err != nil {
+			logger.Warn("Mapping log %s: dropping torn tail at offset %d: %v", l.path, offset, err)
+			return offset, nil
+		}
+		offset += recordLen
+	}
+}
+
+// replayOne consumes a single record, returning its encoded length.
+// io.EOF means a clean end; any other error means a torn record.
+func (l *mappingLog) replayOne(r *bufio.Reader, record func(seedID int64, line LineID)) (int64, error) {
+	kind, err := r.ReadByte()
+	if err != nil {
+		return 0, err
+	}
+
+	switch kind {
+	case recFile:
+		var strLen uint32
+		if err := binary.Read(r, binary.LittleEndian, &strLen); err != nil {
+			return 0, unexpectedEOF(err)
+		}
+		buf := make([]byte, strLen)
+		if _, err := io.ReadFull(r, buf); err != nil {
+			return 0, unexpectedEOF(err)
+		}
+		path := string(buf)
+		l.fileIDs[path] = uint32(len(l.files))
+		l.files = append(l.files, path)
+		return 1 + 4 + int64(strLen), nil
+
+	case recDelta:
+		var seedID int64
+		var n uint32
+		if err := binary.Read(r, binary.LittleEndian, &seedID); err != nil {
+			return 0, unexpectedEOF(err)
+		}
+		if err := binary.Read(r, binary.LittleEndian, &n); err != nil {
+			return 0, unexpectedEOF(err)
+		}
+		for i := uint32(0); i < n; i++ {
+			var fileID, line uint32
+			if err := binary.Read(r, binary.LittleEndian, &fileID); err != nil {
+				return 0, unexpectedEOF(err)
+			}
+			if err := binary.Read(r, binary.LittleEndian, &line); err != nil {
+				return 0, unexpectedEOF(err)
+			}
+			if int(fileID) >= len(l.files) {
+				return 0, fmt.Errorf("delta references unknown file ID %d", fileID)
+			}
+			record(seedID, LineID{File: l.files[fileID], Line: int(line)})
+		}
+		return 1 + 8 + 4 + int64(n)*8, nil
+
+	default:
+		return 0, fmt.Errorf("unknown record type 0x%02x", kind)
+	}
+}
+
+// unexpectedEOF converts a clean EOF inside a record into an error so the
+// caller treats it as a torn record instead of a clean end.
+func unexpectedEOF(err error) error {
+	if err == io.EOF {
+		return io.ErrUnexpectedEOF
+	}
+	return err
+}
+
+// appendDelta writes one (seed, lines) delta, interning new file paths.
+func (l *mappingLog) appendDelta(seedID int64, lines []LineID) error {
+	if len(lines) == 0 {
+		return nil
+	}
+
+	for _, lid := range lines {
+		if _, ok := l.fileIDs[lid.File]; ok {
+			continue
+		}
+		if err := l.w.WriteByte(recFile); err != nil {
+			return err
+		}
+		if err := binary.Write(l.w, binary.LittleEndian, uint32(len(lid.File))); err != nil {
+			return err
+		}
+		if _, err := l.w.WriteString(lid.File); err != nil {
+			return err
+		}
+		l.fileIDs[lid.File] = uint32(len(l.files))
+		l.files = append(l.files, lid.File)
+	}
+
+	if err := l.w.WriteByte(recDelta); err != nil {
+		return err
+	}
+	if err := binary.Write(l.w, binary.LittleEndian, seedID); err != nil {
+		return err
+	}
+	if err := binary.Write(l.w, binary.LittleEndian, uint32(len(lines))); err != nil {
+		return err
+	}
+	for _, lid := range lines {
+		if err := binary.Write(l.w, binary.LittleEndian, l.fileIDs[lid.File]); err != nil {
+			return err
+		}
+		if err := binary.Write(l.w, binary.LittleEndian, uint32(lid.Line)); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// flush pushes buffered records to stable storage. This is the whole cost of
+// a checkpoint when the log is enabled.
+func (l *mappingLog) flush() error {
+	if err := l.w.Flush(); err != nil {
+		return fmt.Errorf("failed to flush mapping log: %w", err)
+	}
+	if err := l.f.Sync(); err != nil {
+		return fmt.Errorf("failed to sync mapping log: %w", err)
+	}
+	return nil
+}
+
+// rewrite replaces the log content with the given per-seed state (used by
+// compaction) via write-then-rename, then reopens for appending.
+func (l *mappingLog) rewrite(seedLines map[int64][]LineID) error {
+	tmpPath := l.path + ".tmp"
+	tmpFile, err := os.OpenFile(tmpPath, os.O_CREATE|os.O_WRONLY|os.O_TRUNC, 0644)
+	if err != nil {
+		return fmt.Errorf("failed to create compacted mapping log: %w", err)
+	}
+
+	compacted := &mappingLog{
+		path:    tmpPath,
+		f:       tmpFile,
+		w:       bufio.NewWriter(tmpFile),
+		fileIDs: make(map[string]uint32),
+	}
+	if err := compacted.writeHeader(); err != nil {
+		tmpFile.Close()
+		os.Remove(tmpPath)
+		return err
+	}
+	for seedID, lines := range seedLines {
+		if err := compacted.appendDelta(seedID, lines); err != nil {
+			tmpFile.Close()
+			os.Remove(tmpPath)
+			return fmt.Errorf("failed to write compacted delta: %w", err)
+		}
+	}
+	if err := compacted.flush(); err != nil {
+		tmpFile.Close()
+		os.Remove(tmpPath)
+		return err
+	}
+	if err := tmpFile.Close(); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to close compacted mapping log: %w", err)
+	}
+
+	if err := os.Rename(tmpPath, l.path); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to replace mapping log: %w", err)
+	}
+
+	// Swap the handle onto the compacted file.
+	l.w.Flush()
+	l.f.Close()
+	f, err := os.OpenFile(l.path, os.O_RDWR, 0644)
+	if err != nil {
+		return fmt.Errorf("failed to reopen mapping log: %w", err)
+	}
+	if _, err := f.Seek(0, io.SeekEnd); err != nil {
+		f.Close()
+		return fmt.Errorf("failed to seek mapping log: %w", err)
+	}
+	l.f = f
+	l.w = bufio.NewWriter(f)
+	l.fileIDs = compacted.fileIDs
+	l.files = compacted.files
+	return nil
+}
+
+// close flushes and closes the log file.
+func (l *mappingLog) close() error {
+	if err := l.flush(); err != nil {
+		return err
+	}
+	return l.f.Close()
+}
@@ -0,0 +1,140 @@
+package coverage
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestMappingLog_AppendFlushReplay(t *testing.T) {
+	logPath := filepath.Join(t.TempDir(), "mapping.log")
+
+	cm, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, cm.EnableBinaryLog(logPath))
+
+	assert.True(t, cm.RecordLine(LineID{File: "gcc/cfgexpand.cc", Line: 100}, 1))
+	assert.Equal(t, 2, cm.RecordLines([]LineID{
+		{File: "gcc/cfgexpand.cc", Line: 101},
+		{File: "gcc/function.cc", Line: 7},
+	}, 2))
+
+	// Checkpoint = flush, no JSON rewrite.
+	require.NoError(t, cm.Save(""))
+
+	// A fresh mapping replays the log back to the same state.
+	restored, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, restored.EnableBinaryLog(logPath))
+
+	assert.True(t, restored.IsCovered(LineID{File: "gcc/cfgexpand.cc", Line: 100}))
+	assert.True(t, restored.IsCovered(LineID{File: "gcc/cfgexpand.cc", Line: 101}))
+	assert.True(t, restored.IsCovered(LineID{File: "gcc/function.cc", Line: 7}))
+	assert.Equal(t, []int64{1}, restored.GetSeedsForLine(LineID{File: "gcc/cfgexpand.cc", Line: 100}))
+	assert.Equal(t, []int64{2}, restored.GetSeedsForLine(LineID{File: "gcc/function.cc", Line: 7}))
+}
+
+func TestMappingLog_TornTailIsDropped(t *testing.T) {
+	logPath := filepath.Join(t.TempDir(), "mapping.log")
+
+	cm, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, cm.EnableBinaryLog(logPath))
+	cm.RecordLine(LineID{File: "a.c", Line: 10}, 1)
+	require.NoError(t, cm.Save(""))
+
+	// Simulate a crash mid-append: chop bytes off the end of the log.
+	data, err := os.ReadFile(logPath)
+	require.NoError(t, err)
+	require.NoError(t, os.WriteFile(logPath, data[:len(data)-3], 0644))
+
+	restored, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, restored.EnableBinaryLog(logPath))
+
+	// The torn record is gone but the mapping is still usable, and new
+	// appends after recovery replay cleanly.
+	restored.RecordLine(LineID{File: "b.c", Line: 20}, 2)
+	require.NoError(t, restored.Save(""))
+
+	final, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, final.EnableBinaryLog(logPath))
+	assert.True(t, final.IsCovered(LineID{File: "b.c", Line: 20}))
+}
+
+func TestMappingLog_CompactPreservesState(t *testing.T) {
+	logPath := filepath.Join(t.TempDir(), "mapping.log")
+
+	cm, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, cm.EnableBinaryLog(logPath))
+
+	// Record the same line repeatedly across "iterations" to bloat the log.
+	for i := int64(1); i <= 50; i++ {
+		cm.RecordLines([]LineID{
+			{File: "a.c", Line: 10},
+			{File: "a.c", Line: int(i)},
+		}, i)
+	}
+	require.NoError(t, cm.Save(""))
+	bloated, err := os.Stat(logPath)
+	require.NoError(t, err)
+
+	require.NoError(t, cm.Compact())
+	compacted, err := os.Stat(logPath)
+	require.NoError(t, err)
+	assert.Less(t, compacted.Size(), bloated.Size())
+
+	restored, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, restored.EnableBinaryLog(logPath))
+	assert.Equal(t, cm.TotalCoveredLines(), restored.TotalCoveredLines())
+	assert.ElementsMatch(t,
+		cm.GetSeedsForLine(LineID{File: "a.c", Line: 10}),
+		restored.GetSeedsForLine(LineID{File: "a.c", Line: 10}))
+
+	// The compacted log must still accept appends.
+	restored.RecordLine(LineID{File: "c.c", Line: 1}, 99)
+	require.NoError(t, restored.Save(""))
+}
+
+func TestCoverageMapping_SaveSnapshotWithLogEnabled(t *testing.T) {
+	dir := t.TempDir()
+	logPath := filepath.Join(dir, "mapping.log")
+	jsonPath := filepath.Join(dir, "mapping.json")
+
+	cm, err := NewCoverageMapping("")
+	require.NoError(t, err)
+	require.NoError(t, cm.EnableBinaryLog(logPath))
+	cm.RecordLine(LineID{File: "a.c", Line: 10}, 1)
+
+	// Save only flushes the log; the JSON file appears via SaveSnapshot.
+	require.NoError(t, cm.Save(jsonPath))
+	_, err = os.Stat(jsonPath)
+	assert.True(t, os.IsNotExist(err))
+
+	require.NoError(t, cm.SaveSnapshot(jsonPath))
+	loaded, err := NewCoverageMapping(jsonPath)
+	require.NoError(t, err)
+	assert.True(t, loaded.IsCovered(LineID{File: "a.c", Line: 10}))
+}
+
+func TestParseMappingKey(t *testing.T) {
+	lid, ok := parseMappingKey("gcc/cfgexpand.cc:123")
+	require.True(t, ok)
+	assert.Equal(t, LineID{File: "gcc/cfgexpand.cc", Line: 123}, lid)
+
+	// Windows-style path with embedded colon splits at the last colon.
+	lid, ok = parseMappingKey("C:/src/a.c:7")
+	require.True(t, ok)
+	assert.Equal(t, LineID{File: "C:/src/a.c", Line: 7}, lid)
+
+	_, ok = parseMappingKey("no-colon")
+	assert.False(t, ok)
+	_, ok = parseMappingKey("a.c:notanumber")
+	assert.False(t, ok)
+}
@@ -0,0 +1,259 @@
+package coverage
+
+import (
+	"container/heap"
+	"fmt"
+	"math/rand"
+	"sync"
+)
+
+// Indexed priority structure over uncovered basic blocks.
+//
+// selectTargetBB used to rescan every BB of every target function per
+// SelectTarget call — hundreds of thousands of blocks against full cc1
+// CFG dumps, once per fuzzing iteration. The targetIndex keeps the
+// candidate set (uncovered, reachable BBs) in a max-heap keyed by
+// weight, updated incrementally: markCovered decrements per-BB
+// uncovered-line counters and bumps successor reachability, and
+// DecayBBWeight re-sifts the one affected entry. Selection becomes a
+// heap peek, and top-K selection (for the parallel worker pool) a
+// bounded pop/push.
+//
+// Ties: the linear scan picked uniformly among max-weight candidates.
+// The heap orders equal weights by a random tiebreak fixed at insertion,
+// which preserves "an arbitrary max-weight BB" without paying O(ties)
+// per call; after every selection the chosen BB either decays below its
+// peers or gets covered, so the ordering among the rest still rotates.
+
+// bbRef identifies a basic block within a parsed function.
+type bbRef struct {
+	fn   string
+	bbID int
+}
+
+func (r bbRef) key() string { return fmt.Sprintf("%s:%d", r.fn, r.bbID) }
+
+// targetEntry is one candidate BB (uncovered lines, bbID > 1) in the
+// priority heap.
+type targetEntry struct {
+	ref          bbRef
+	weight       float64
+	tiebreak     uint64 // random, fixed at insert; orders equal weights
+	heapIdx      int    // index in the heap, -1 when evicted
+	uncovered    int    // this BB's own lines not yet covered
+	coveredPreds int    // predecessors with at least one covered line
+	entryBB      bool   // no predecessors (function entry)
+}
+
+func (e *targetEntry) eligible() bool {
+	return e.uncovered > 0 && (e.entryBB || e.coveredPreds > 0)
+}
+
+// bbState tracks coverage of every block in the target functions —
+// including non-candidates — because any block's covered→true transition
+// can make its successors reachable.
+type bbState struct {
+	remaining int  // uncovered own lines
+	covered   bool // any own line covered
+	succs     []int
+}
+
+// targetHeap is a max-heap of eligible candidates (container/heap).
+type targetHeap []*targetEntry
+
+func (h targetHeap) Len() int { return len(h) }
+func (h targetHeap) Less(i, j int) bool {
+	if h[i].weight != h[j].weight {
+		return h[i].weight > h[j].weight
+	}
+	return h[i].tiebreak > h[j].tiebreak
+}
+func (h targetHeap) Swap(i, j int) {
+	h[i], h[j] = h[j], h[i]
+	h[i].heapIdx = i
+	h[j].heapIdx = j
+}
+func (h *targetHeap) Push(x any) {
+	e := x.(*targetEntry)
+	e.heapIdx = len(*h)
+	*h = append(*h, e)
+}
+func (h *targetHeap) Pop() any {
+	old := *h
+	n := len(old)
+	e := old[n-1]
+	old[n-1] = nil
+	e.heapIdx = -1
+	*h = old[:n-1]
+	return e
+}
+
+// targetIndex is the incrementally-maintained candidate index. All
+// methods are safe for concurrent use.
+type targetIndex struct {
+	mu      sync.Mutex
+	entries map[bbRef]*targetEntry
+	states  map[bbRef]*bbState
+	lineBBs map[uint32][]bbRef // interned line index -> blocks containing it
+	heap    targetHeap
+}
+
+// buildTargetIndex constructs the index from the analyzer's current
+// functions, weights and covered bitset. Called after parsing and
+// whenever a mapping is (re)loaded.
+func (c *Analyzer) buildTargetIndex() *targetIndex {
+	idx := &targetIndex{
+		entries: make(map[bbRef]*targetEntry),
+		states:  make(map[bbRef]*bbState),
+		lineBBs: make(map[uint32][]bbRef),
+	}
+
+	c.coveredMu.RLock()
+	defer c.coveredMu.RUnlock()
+
+	// Pass 1: per-block coverage state for every block, so predecessor
+	// reachability can be derived in pass 2.
+	for _, funcName := range c.targetFunctions {
+		fn, ok := c.functions[funcName]
+		if !ok {
+			continue
+		}
+		for bbID, bb := range fn.Blocks {
+			ref := bbRef{fn: funcName, bbID: bbID}
+			st := &bbState{succs: bb.Successors}
+			for _, lineNum := range bb.Lines {
+				lineIdx := c.lineIndex.intern(c.makeLineID(bb.File, lineNum))
+				idx.lineBBs[lineIdx] = append(idx.lineBBs[lineIdx], ref)
+				if c.coveredBits.get(lineIdx) {
+					st.covered = true
+				} else {
+					st.remaining++
+				}
+			}
+			idx.states[ref] = st
+		}
+	}
+
+	// Pass 2: candidate entries with reachability counters.
+	for _, funcName := range c.targetFunctions {
+		fn, ok := c.functions[funcName]
+		if !ok {
+			continue
+		}
+		for bbID, bb := range fn.Blocks {
+			if bbID <= 1 || len(bb.Lines) == 0 {
+				continue
+			}
+			ref := bbRef{fn: funcName, bbID: bbID}
+			e := &targetEntry{
+				ref:       ref,
+				weight:    float64(len(bb.Successors)),
+				tiebreak:  rand.Uint64(),
+				heapIdx:   -1,
+				uncovered: idx.states[ref].remaining,
+				entryBB:   len(bb.Predecessors) == 0,
+			}
+			if wi, ok := c.bbWeights[ref.key()]; ok {
+				e.weight = wi.Weight
+			}
+			for _, predID := range bb.Predecessors {
+				if st, ok := idx.states[bbRef{fn: funcName, bbID: predID}]; ok && st.covered {
+					e.coveredPreds++
+				}
+			}
+			idx.entries[ref] = e
+			if e.eligible() {
+				heap.Push(&idx.heap, e)
+			}
+		}
+	}
+
+	return idx
+}
+
+// onLinesCovered processes freshly covered line indices (first-time
+// transitions only; markCovered dedupes against the bitset).
+func (t *targetIndex) onLinesCovered(lineIdxs []uint32) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	for _, lineIdx := range lineIdxs {
+		for _, ref := range t.lineBBs[lineIdx] {
+			st := t.states[ref]
+			st.remaining--
+
+			if e, ok := t.entries[ref]; ok {
+				e.uncovered--
+				if e.uncovered <= 0 && e.heapIdx >= 0 {
+					heap.Remove(&t.heap, e.heapIdx) // fully covered
+				}
+			}
+
+			if !st.covered {
+				st.covered = true
+				// This block just became a covered predecessor; its
+				// successors may now be reachable.
+				for _, succID := range st.succs {
+					succ, ok := t.entries[bbRef{fn: ref.fn, bbID: succID}]
+					if !ok {
+						continue
+					}
+					succ.coveredPreds++
+					if succ.eligible() && succ.heapIdx < 0 {
+						heap.Push(&t.heap, succ)
+					}
+				}
+			}
+		}
+	}
+}
+
+// onWeightChanged re-sifts the entry after DecayBBWeight.
+func (t *targetIndex) onWeightChanged(funcName string, bbID int, weight float64) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	e, ok := t.entries[bbRef{fn: funcName, bbID: bbID}]
+	if !ok {
+		return
+	}
+	e.weight = weight
+	if e.heapIdx >= 0 {
+		heap.Fix(&t.heap, e.heapIdx)
+	}
+}
+
+// best returns the highest-weighted eligible candidate without removing
+// it, or false when every reachable BB is covered.
+func (t *targetIndex) best() (bbRef, float64, bool) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if len(t.heap) == 0 {
+		return bbRef{}, 0, false
+	}
+	e := t.heap[0]
+	return e.ref, e.weight, true
+}
+
+// topK returns up to k distinct highest-weighted candidates (heap order)
+// by popping and re-pushing, so it stays O(k log n).
+func (t *targetIndex) topK(k int) []bbRef {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if k > len(t.heap) {
+		k = len(t.heap)
+	}
+	popped := make([]*targetEntry, 0, k)
+	refs := make([]bbRef, 0, k)
+	for i := 0; i < k; i++ {
+		e := heap.Pop(&t.heap).(*targetEntry)
+		popped = append(popped, e)
+		refs = append(refs, e.ref)
+	}
+	for _, e := range popped {
+		heap.Push(&t.heap, e)
+	}
+	return refs
+}
@@ -0,0 +1,115 @@
+package coverage
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// branchyCFG is a diamond CFG with line info so every block has Lines:
+//
+//	bb2 (entry) -> bb3, bb4 -> bb5
+func writeBranchyCFG(t *testing.T, dir string) string {
+	t.Helper()
+	cfgContent := `;; Function branchy (branchy, funcdef_no=0, decl_uid=2)
+;;   with 6 basic blocks.
+
+;; 2 succs { 3 4 }
+;; 3 succs { 5 }
+;; 4 succs { 5 }
+;; 5 succs { 1 }
+
+branchy (int x)
+{
+  <bb 2> :
+  [test.c:10:3] _1 = x_2(D) > 0;
+
+  <bb 3> :
+  [test.c:20:5] y_3 = x_2(D) + 1;
+
+  <bb 4> :
+  [test.c:30:5] y_4 = x_2(D) - 1;
+
+  <bb 5> :
+  [test.c:40:3] return y_5;
+
+}
+`
+	cfgPath := filepath.Join(dir, "branchy.cfg")
+	require.NoError(t, os.WriteFile(cfgPath, []byte(cfgContent), 0644))
+	return cfgPath
+}
+
+func TestTargetIndex_IncrementalSelection(t *testing.T) {
+	tmpDir := t.TempDir()
+	cfgPath := writeBranchyCFG(t, tmpDir)
+	mappingPath := filepath.Join(tmpDir, "mapping.json")
+
+	analyzer, err := NewAnalyzer([]string{cfgPath}, []string{"branchy"}, "", mappingPath, 0.8)
+	require.NoError(t, err)
+	require.NotNil(t, analyzer.targetIdx)
+
+	// Only the entry BB is eligible while nothing is covered: bb3-bb5
+	// have no covered predecessor yet.
+	target := analyzer.SelectTarget()
+	require.NotNil(t, target)
+	assert.Equal(t, 2, target.BBID)
+
+	// Covering bb2 removes it and unlocks both successors.
+	analyzer.RecordCoverage(1, []string{"test.c:10"})
+	target = analyzer.SelectTarget()
+	require.NotNil(t, target)
+	assert.Contains(t, []int{3, 4}, target.BBID)
+
+	// The index and the legacy linear scan must agree on the candidate set.
+	legacy := analyzer.selectTargetBB(analyzer.targetFunctions)
+	require.NotNil(t, legacy)
+	assert.Contains(t, []int{3, 4}, legacy.BBID)
+
+	// Top-K yields distinct candidates in weight order.
+	targets := analyzer.SelectTargets(2)
+	require.Len(t, targets, 2)
+	assert.NotEqual(t, targets[0].BBID, targets[1].BBID)
+
+	// Decaying bb3 (1.0 -> 0.8) makes bb4 the unique maximum.
+	analyzer.DecayBBWeight("branchy", 3)
+	target = analyzer.SelectTarget()
+	require.NotNil(t, target)
+	assert.Equal(t, 4, target.BBID)
+
+	// Covering bb4 unlocks bb5 (weight 1.0), which now beats decayed bb3.
+	analyzer.RecordCoverage(2, []string{"test.c:30"})
+	target = analyzer.SelectTarget()
+	require.NotNil(t, target)
+	assert.Equal(t, 5, target.BBID)
+
+	// Full coverage empties the heap.
+	analyzer.RecordCoverage(3, []string{"test.c:20", "test.c:40"})
+	assert.Nil(t, analyzer.SelectTarget())
+	assert.Empty(t, analyzer.SelectTargets(2))
+}
+
+func TestTargetIndex_RebuiltOnLoadMapping(t *testing.T) {
+	tmpDir := t.TempDir()
+	cfgPath := writeBranchyCFG(t, tmpDir)
+	mappingPath := filepath.Join(tmpDir, "mapping.json")
+
+	// First analyzer covers the entry BB and persists the mapping.
+	analyzer1, err := NewAnalyzer([]string{cfgPath}, []string{"branchy"}, "", mappingPath, 0.8)
+	require.NoError(t, err)
+	analyzer1.RecordCoverage(1, []string{"test.c:10"})
+	require.NoError(t, analyzer1.SaveMapping(mappingPath))
+
+	// A fresh analyzer reloading that mapping must rebuild the index:
+	// bb2 is covered, so its successors are the selectable frontier.
+	analyzer2, err := NewAnalyzer([]string{cfgPath}, []string{"branchy"}, "", filepath.Join(tmpDir, "other.json"), 0.8)
+	require.NoError(t, err)
+	require.NoError(t, analyzer2.LoadMapping(mappingPath))
+
+	target := analyzer2.SelectTarget()
+	require.NotNil(t, target)
+	assert.Contains(t, []int{3, 4}, target.BBID)
+}
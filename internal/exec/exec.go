@@ -2,7 +2,9 @@ package exec
 
 import (
 	"bytes"
+	"os"
 	"os/exec"
+	"sync"
 )
 
 // ExecutionResult holds the outcome of a command execution.
@@ -10,29 +12,110 @@ type ExecutionResult struct {
 	Stdout   string
 	Stderr   string
 	ExitCode int
+
+	// Truncated reports that stdout or stderr exceeded the executor's
+	// output cap and was cut off. The captured prefix is still returned.
+	Truncated bool
 }
 
+// DefaultMaxOutputBytes is the per-stream capture cap used when running
+// untrusted binaries (seed programs under QEMU or natively): generous
+// enough for any real diagnostic output, small enough that a seed
+// printing gigabytes cannot OOM the fuzzer.
+const DefaultMaxOutputBytes = 16 << 20
+
 // Executor defines an interface for running external commands.
 // This allows for mocking in tests.
 type Executor interface {
 	Run(command string, args ...string) (*ExecutionResult, error)
 }
 
+// bufferPool recycles the capture buffers across Run calls. The executor
+// is the funnel for every external invocation (gcc, gcovr, qemu, objdump),
+// so fresh multi-megabyte buffers per call are measurable GC pressure.
+var bufferPool = sync.Pool{
+	New: func() interface{} { return new(bytes.Buffer) },
+}
+
+func getBuffer() *bytes.Buffer {
+	return bufferPool.Get().(*bytes.Buffer)
+}
+
+func putBuffer(b *bytes.Buffer) {
+	// Oversized buffers are dropped instead of pooled so one output bomb
+	// does not pin its capacity for the rest of the campaign.
+	if b.Cap() > 4<<20 {
+		return
+	}
+	b.Reset()
+	bufferPool.Put(b)
+}
+
+// cappedWriter fills buf up to limit bytes and silently discards the rest,
+// flagging the truncation. It never errors, so the child process keeps
+// running (and exiting normally) instead of dying on a broken pipe.
+type cappedWriter struct {
+	buf       *bytes.Buffer
+	remaining int
+	truncated bool
+}
+
+func (w *cappedWriter) Write(p []byte) (int, error) {
+	n := len(p)
+	if w.remaining <= 0 {
+		w.truncated = w.truncated || n > 0
+		return n, nil
+	}
+	if n > w.remaining {
+		w.buf.Write(p[:w.remaining])
+		w.remaining = 0
+		w.truncated = true
+		return n, nil
+	}
+	w.buf.Write(p)
+	w.remaining -= n
+	return n, nil
+}
+
 // CommandExecutor is a concrete implementation of the Executor interface
 // that runs actual commands on the host system.
-type CommandExecutor struct{}
+type CommandExecutor struct {
+	// maxOutputBytes caps each captured stream; 0 means unbounded.
+	maxOutputBytes int
+}
 
-// NewCommandExecutor creates a new CommandExecutor.
+// NewCommandExecutor creates a new CommandExecutor with unbounded output
+// capture.
 func NewCommandExecutor() *CommandExecutor {
 	return &CommandExecutor{}
 }
 
+// NewBoundedCommandExecutor creates a CommandExecutor that captures at most
+// maxOutputBytes per stream, flagging ExecutionResult.Truncated beyond
+// that. A seed that prints gigabytes can no longer OOM the fuzzer.
+func NewBoundedCommandExecutor(maxOutputBytes int) *CommandExecutor {
+	return &CommandExecutor{maxOutputBytes: maxOutputBytes}
+}
+
 // Run executes the given command and returns its result.
 func (e *CommandExecutor) Run(command string, args ...string) (*ExecutionResult, error) {
 	cmd := exec.Command(command, args...)
-	var stdout, stderr bytes.Buffer
-	cmd.Stdout = &stdout
-	cmd.Stderr = &stderr
+
+	stdout := getBuffer()
+	stderr := getBuffer()
+	defer putBuffer(stdout)
+	defer putBuffer(stderr)
+
+	var outWriter, errWriter *cappedWriter
+	if e.maxOutputBytes > 0 {
+		outWriter = &cappedWriter{buf: stdout, remaining: e.maxOutputBytes}
+		errWriter = &cappedWriter{buf: stderr, remaining: e.maxOutputBytes}
+		cmd.Stdout = outWriter
+		cmd.Stderr = errWriter
+	} else {
+		cmd.Stdout = stdout
+		cmd.Stderr = stderr
+	}
 
 	err := cmd.Run()
 
@@ -41,6 +124,9 @@ func (e *CommandExecutor) Run(command string, args ...string) (*ExecutionResult,
 		Stderr:   stderr.String(),
 		ExitCode: cmd.ProcessState.ExitCode(),
 	}
+	if outWriter != nil {
+		result.Truncated = outWriter.truncated || errWriter.truncated
+	}
 
 	// cmd.Run() returns an error for non-zero exit codes, but we handle
 	// the exit code explicitly. So, we only return other kinds of errors
@@ -53,3 +139,48 @@ func (e *CommandExecutor) Run(command string, args ...string) (*ExecutionResult,
 
 	return result, nil
 }
+
+// RunToFile executes the command with stdout streamed straight to
+// stdoutPath instead of being buffered in memory, for invocations whose
+// output is immediately re-read from disk anyway (large JSON reports,
+// trace dumps). Stderr is captured as usual; ExecutionResult.Stdout is
+// empty.
+func (e *CommandExecutor) RunToFile(command, stdoutPath string, args ...string) (*ExecutionResult, error) {
+	outFile, err := os.Create(stdoutPath)
+	if err != nil {
+		return nil, err
+	}
+	defer outFile.Close()
+
+	cmd := exec.Command(command, args...)
+	cmd.Stdout = outFile
+
+	stderr := getBuffer()
+	defer putBuffer(stderr)
+
+	var errWriter *cappedWriter
+	if e.maxOutputBytes > 0 {
+		errWriter = &cappedWriter{buf: stderr, remaining: e.maxOutputBytes}
+		cmd.Stderr = errWriter
+	} else {
+		cmd.Stderr = stderr
+	}
+
+	runErr := cmd.Run()
+
+	result := &ExecutionResult{
+		Stderr:   stderr.String(),
+		ExitCode: cmd.ProcessState.ExitCode(),
+	}
+	if errWriter != nil {
+		result.Truncated = errWriter.truncated
+	}
+
+	if runErr != nil {
+		if _, ok := runErr.(*exec.ExitError); !ok {
+			return nil, runErr
+		}
+	}
+
+	return result, nil
+}
@@ -1,6 +1,7 @@
 package exec
 
 import (
+	"os"
 	"testing"
 
 	"github.com/stretchr/testify/assert"
@@ -38,3 +39,46 @@ func TestCommandExecutor_Run(t *testing.T) {
 		assert.Error(t, err)
 	})
 }
+
+func TestBoundedCommandExecutor_Run(t *testing.T) {
+	t.Run("should truncate output beyond the cap", func(t *testing.T) {
+		executor := NewBoundedCommandExecutor(1024)
+		// Emit well over the cap; the process must still exit cleanly.
+		result, err := executor.Run("sh", "-c", "head -c 100000 /dev/zero | tr '\\0' 'x'")
+		require.NoError(t, err)
+		assert.Equal(t, 0, result.ExitCode)
+		assert.True(t, result.Truncated)
+		assert.Len(t, result.Stdout, 1024)
+	})
+
+	t.Run("should not flag output within the cap", func(t *testing.T) {
+		executor := NewBoundedCommandExecutor(1024)
+		result, err := executor.Run("echo", "small")
+		require.NoError(t, err)
+		assert.False(t, result.Truncated)
+		assert.Equal(t, "small\n", result.Stdout)
+	})
+
+	t.Run("should cap stderr independently", func(t *testing.T) {
+		executor := NewBoundedCommandExecutor(8)
+		result, err := executor.Run("sh", "-c", "echo 'a very long error line' 1>&2")
+		require.NoError(t, err)
+		assert.True(t, result.Truncated)
+		assert.Len(t, result.Stderr, 8)
+	})
+}
+
+func TestCommandExecutor_RunToFile(t *testing.T) {
+	executor := NewCommandExecutor()
+	outPath := t.TempDir() + "/stdout.txt"
+
+	result, err := executor.RunToFile("sh", outPath, "-c", "echo file-bound; echo diag 1>&2")
+	require.NoError(t, err)
+	assert.Equal(t, 0, result.ExitCode)
+	assert.Empty(t, result.Stdout, "stdout goes to the file, not the result")
+	assert.Equal(t, "diag\n", result.Stderr)
+
+	data, err := os.ReadFile(outPath)
+	require.NoError(t, err)
+	assert.Equal(t, "file-bound\n", string(data))
+}
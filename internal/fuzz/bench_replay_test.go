@@ -0,0 +1,258 @@
+package fuzz
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/zjy-dev/gcovr-json-util/v2/pkg/gcovr"
+
+	"github.com/zjy-dev/de-fuzz/internal/compiler"
+	"github.com/zjy-dev/de-fuzz/internal/corpus"
+	"github.com/zjy-dev/de-fuzz/internal/coverage"
+	"github.com/zjy-dev/de-fuzz/internal/llm"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
+	"github.com/zjy-dev/de-fuzz/internal/oracle"
+	"github.com/zjy-dev/de-fuzz/internal/prompt"
+	"github.com/zjy-dev/de-fuzz/internal/prompt/mechanism"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// Replayable end-to-end iteration benchmark.
+//
+// It replays a recorded campaign (testdata/bench_campaign.jsonl, served
+// by llm.Replayer) against the full engine pipeline — prompt build,
+// response parsing, dedup, syntax gate, compile, coverage extraction,
+// analyzer recording, oracle, corpus admission — with the LLM, compiler
+// and coverage measurement stubbed to deterministic in-process fakes, so
+// the numbers isolate *our* per-iteration overhead from provider and
+// toolchain latency. Run it before rolling a build to the fleet:
+//
+//	go test ./internal/fuzz/ -bench BenchmarkEngineReplayCampaign -benchtime 200x
+//
+// Per-stage means (compile, coverage, oracle) are reported as custom
+// benchmark metrics alongside the standard ns/op iteration cost.
+
+// benchCFG is the CFG fixture for the replay campaign: a diamond where
+// bb5 is reachable but its line is never reported covered, so the target
+// frontier never empties and the loop runs for the full iteration budget.
+const benchCFG = `;; Function branchy (branchy, funcdef_no=0, decl_uid=2)
+;;   with 6 basic blocks.
+
+;; 2 succs { 3 4 }
+;; 3 succs { 5 }
+;; 4 succs { 5 }
+;; 5 succs { 1 }
+
+branchy (int x)
+{
+  <bb 2> :
+  [test.c:10:3] _1 = x_2(D) > 0;
+
+  <bb 3> :
+  [test.c:20:5] y_3 = x_2(D) + 1;
+
+  <bb 4> :
+  [test.c:30:5] y_4 = x_2(D) - 1;
+
+  <bb 5> :
+  [test.c:40:3] return y_5;
+
+}
+`
+
+// benchReplayCompiler pretends every seed compiles instantly.
+type benchReplayCompiler struct {
+	workDir string
+}
+
+func (c *benchReplayCompiler) Compile(s *seed.Seed) (*compiler.CompileResult, error) {
+	return &compiler.CompileResult{
+		Success:    true,
+		BinaryPath: filepath.Join(c.workDir, "a.out"),
+	}, nil
+}
+
+func (c *benchReplayCompiler) GetWorkDir() string { return c.workDir }
+
+// benchReplayCoverage scripts coverage measurement: every report covers
+// the entry line, alternate calls add one of the two branch lines, and
+// the join line (test.c:40) never appears. Reports are written as real
+// gcovr JSON so the engine's extraction path runs unmodified.
+type benchReplayCoverage struct {
+	dir    string
+	calls  int
+	merged map[string]bool
+}
+
+func newBenchReplayCoverage(dir string) *benchReplayCoverage {
+	return &benchReplayCoverage{dir: dir, merged: make(map[string]bool)}
+}
+
+func (c *benchReplayCoverage) reportLines() []int {
+	lines := []int{10}
+	if c.calls%2 == 0 {
+		lines = append(lines, 20)
+	} else {
+		lines = append(lines, 30)
+	}
+	return lines
+}
+
+func (c *benchReplayCoverage) Clean() error { return nil }
+
+func (c *benchReplayCoverage) Measure(s *seed.Seed) (coverage.Report, error) {
+	c.calls++
+	lines := make([]gcovr.Line, 0, 2)
+	for _, n := range c.reportLines() {
+		lines = append(lines, gcovr.Line{LineNumber: n, Count: 1, FunctionName: "branchy"})
+	}
+	report := &gcovr.GcovrReport{
+		FormatVersion: "0.5",
+		Files:         []gcovr.File{{FilePath: "test.c", Lines: lines}},
+	}
+	data, err := json.Marshal(report)
+	if err != nil {
+		return nil, err
+	}
+	path := filepath.Join(c.dir, fmt.Sprintf("measure-%d.json", c.calls))
+	if err := os.WriteFile(path, data, 0644); err != nil {
+		return nil, err
+	}
+	return coverage.NewGcovrReport(path), nil
+}
+
+func (c *benchReplayCoverage) HasIncreased(newReport coverage.Report) (bool, error) {
+	for _, n := range c.reportLines() {
+		if !c.merged[fmt.Sprintf("test.c:%d", n)] {
+			return true, nil
+		}
+	}
+	return false, nil
+}
+
+func (c *benchReplayCoverage) GetIncrease(newReport coverage.Report) (*coverage.CoverageIncrease, error) {
+	return &coverage.CoverageIncrease{Summary: "benchmark"}, nil
+}
+
+func (c *benchReplayCoverage) Merge(newReport coverage.Report) error {
+	for _, n := range c.reportLines() {
+		c.merged[fmt.Sprintf("test.c:%d", n)] = true
+	}
+	return nil
+}
+
+func (c *benchReplayCoverage) GetTotalReport() (coverage.Report, error) {
+	return nil, fmt.Errorf("benchmark coverage keeps no total report")
+}
+
+func (c *benchReplayCoverage) GetStats() (*coverage.CoverageStats, error) {
+	return &coverage.CoverageStats{TotalLines: 4, TotalCoveredLines: len(c.merged)}, nil
+}
+
+// benchReplayOracle never finds a bug; it exists so the oracle stage is
+// part of the measured pipeline.
+type benchReplayOracle struct{}
+
+func (o *benchReplayOracle) Analyze(s *seed.Seed, ctx *oracle.AnalyzeContext, results []oracle.Result) (*oracle.Bug, error) {
+	return nil, nil
+}
+
+// buildReplayEngine wires a full engine over the recorded campaign.
+func buildReplayEngine(b *testing.B, iterations int) *Engine {
+	b.Helper()
+	tmpDir := b.TempDir()
+
+	cfgPath := filepath.Join(tmpDir, "branchy.cfg")
+	if err := os.WriteFile(cfgPath, []byte(benchCFG), 0644); err != nil {
+		b.Fatal(err)
+	}
+
+	analyzer, err := coverage.NewAnalyzer(
+		[]string{cfgPath},
+		[]string{"branchy"},
+		"",
+		filepath.Join(tmpDir, "mapping.json"),
+		0.8,
+	)
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	corp := corpus.NewFileManager(tmpDir)
+	if err := corp.Initialize(); err != nil {
+		b.Fatal(err)
+	}
+	if err := corp.Add(&seed.Seed{Content: "int main(void) { return 0; }"}); err != nil {
+		b.Fatal(err)
+	}
+
+	replayer, err := llm.NewReplayer(filepath.Join("testdata", "bench_campaign.jsonl"))
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	contract, ok := mechanism.Get("canary")
+	if !ok {
+		b.Fatal("canary mechanism contract not registered")
+	}
+	understandingPath := filepath.Join(tmpDir, "understanding.md")
+	if err := os.WriteFile(understandingPath, []byte("benchmark understanding"), 0644); err != nil {
+		b.Fatal(err)
+	}
+	promptService, err := prompt.NewPromptService(
+		filepath.Join("..", "..", "prompts", "base"),
+		understandingPath,
+		prompt.NewBuilder(0, "", contract),
+	)
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	return NewEngine(Config{
+		Corpus:        corp,
+		Compiler:      &benchReplayCompiler{workDir: tmpDir},
+		Coverage:      newBenchReplayCoverage(tmpDir),
+		Oracle:        &benchReplayOracle{},
+		OracleType:    "canary",
+		LLM:           replayer,
+		Analyzer:      analyzer,
+		PromptService: promptService,
+		MaxIterations: iterations,
+		MaxRetries:    1,
+		MappingPath:   filepath.Join(tmpDir, "state", "coverage_mapping.json"),
+	})
+}
+
+func BenchmarkEngineReplayCampaign(b *testing.B) {
+	engine := buildReplayEngine(b, b.N)
+
+	stages := []string{metrics.StageLLM, metrics.StageCompile, metrics.StageCoverage, metrics.StageOracle}
+	beforeCount := make(map[string]uint64, len(stages))
+	beforeSum := make(map[string]float64, len(stages))
+	for _, stage := range stages {
+		beforeCount[stage], beforeSum[stage] = metrics.StageStats(stage)
+	}
+
+	b.ResetTimer()
+	start := time.Now()
+	if err := engine.Run(); err != nil {
+		b.Fatal(err)
+	}
+	elapsed := time.Since(start)
+	b.StopTimer()
+
+	if elapsed > 0 {
+		b.ReportMetric(float64(engine.GetIterationCount())/elapsed.Seconds(), "iters/sec")
+	}
+	for _, stage := range stages {
+		count, sum := metrics.StageStats(stage)
+		if delta := count - beforeCount[stage]; delta > 0 {
+			mean := (sum - beforeSum[stage]) / float64(delta) * 1e3
+			b.ReportMetric(mean, stage+"-ms/call")
+		}
+	}
+}
@@ -0,0 +1,150 @@
+package fuzz
+
+import (
+	"bufio"
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"sync"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// dedup.go holds the campaign-wide seed duplicate index.
+//
+// LLM retry loops regularly re-emit content we have already processed —
+// often the parent seed verbatim — and nothing downstream noticed until
+// the full compile + coverage + oracle pipeline had run again.
+// tryMutatedSeed now keys every candidate by a hash of its normalized
+// source (plus compile flags, which change the produced binary) and
+// returns the recorded verdict for known content. The index is persisted
+// as JSON lines next to the coverage mapping so restarts keep the
+// savings.
+
+// DedupIndexFileName is the on-disk duplicate index, one JSON record per
+// line, stored in the state directory alongside the coverage mapping.
+const DedupIndexFileName = "dedup.idx"
+
+// dedupRecord captures the verdict recorded the first time a piece of
+// content was compiled and analyzed.
+type dedupRecord struct {
+	Hash          string             `json:"hash"`
+	SeedID        uint64             `json:"seed_id,omitempty"`
+	Verdict       seed.OracleVerdict `json:"verdict,omitempty"`
+	CompileFailed bool               `json:"compile_failed,omitempty"`
+	CompileError  string             `json:"compile_error,omitempty"`
+}
+
+// seedDedupIndex maps content-hash keys to recorded verdicts. Safe for
+// concurrent use by parallel workers.
+type seedDedupIndex struct {
+	mu      sync.Mutex
+	path    string // empty means in-memory only
+	entries map[string]dedupRecord
+	file    *os.File
+}
+
+// newSeedDedupIndex creates the index, loading any persisted entries
+// from stateDir. An empty stateDir yields an in-memory index (tests,
+// engines without a mapping path).
+func newSeedDedupIndex(stateDir string) *seedDedupIndex {
+	d := &seedDedupIndex{entries: make(map[string]dedupRecord)}
+	if stateDir == "" {
+		return d
+	}
+	d.path = filepath.Join(stateDir, DedupIndexFileName)
+	d.load()
+	return d
+}
+
+// load reads the persisted index, skipping torn records the same way the
+// packed corpus index does.
+func (d *seedDedupIndex) load() {
+	f, err := os.Open(d.path)
+	if err != nil {
+		if !os.IsNotExist(err) {
+			logger.Warn("Failed to open dedup index %s: %v", d.path, err)
+		}
+		return
+	}
+	defer f.Close()
+
+	scanner := bufio.NewScanner(f)
+	scanner.Buffer(make([]byte, 0, 64*1024), 4*1024*1024)
+	for scanner.Scan() {
+		line := scanner.Bytes()
+		if len(line) == 0 {
+			continue
+		}
+		var rec dedupRecord
+		if err := json.Unmarshal(line, &rec); err != nil {
+			logger.Warn("Skipping torn dedup index record: %v", err)
+			continue
+		}
+		d.entries[rec.Hash] = rec
+	}
+	if err := scanner.Err(); err != nil {
+		logger.Warn("Failed to read dedup index %s: %v", d.path, err)
+	}
+	if len(d.entries) > 0 {
+		logger.Info("Loaded %d dedup index entries from %s", len(d.entries), filepath.Base(d.path))
+	}
+}
+
+// lookup returns the recorded verdict for a content key.
+func (d *seedDedupIndex) lookup(hash string) (dedupRecord, bool) {
+	d.mu.Lock()
+	defer d.mu.Unlock()
+	rec, ok := d.entries[hash]
+	return rec, ok
+}
+
+// record stores the verdict for freshly processed content and appends it
+// to the on-disk index. Persistence is best effort: a lost record only
+// costs one redundant recompile after a restart.
+func (d *seedDedupIndex) record(rec dedupRecord) {
+	d.mu.Lock()
+	defer d.mu.Unlock()
+
+	if _, ok := d.entries[rec.Hash]; ok {
+		return
+	}
+	d.entries[rec.Hash] = rec
+
+	if d.path == "" {
+		return
+	}
+	if d.file == nil {
+		if err := os.MkdirAll(filepath.Dir(d.path), 0755); err != nil {
+			logger.Warn("Failed to create dedup index directory: %v", err)
+			d.path = ""
+			return
+		}
+		f, err := os.OpenFile(d.path, os.O_WRONLY|os.O_CREATE|os.O_APPEND, 0644)
+		if err != nil {
+			logger.Warn("Failed to open dedup index for append: %v", err)
+			d.path = ""
+			return
+		}
+		d.file = f
+	}
+
+	data, err := json.Marshal(rec)
+	if err != nil {
+		return
+	}
+	if _, err := d.file.Write(append(data, '\n')); err != nil {
+		logger.Warn("Failed to append dedup index record: %v", err)
+	}
+}
+
+// dedupKeyForSeed builds the index key from the seed's content and
+// everything flag-related that changes the compiled binary.
+func dedupKeyForSeed(s *seed.Seed) string {
+	extras := append([]string{}, s.CFlags...)
+	if s.FlagProfile != nil && s.FlagProfile.Name != "" {
+		extras = append(extras, "profile:"+s.FlagProfile.Name)
+	}
+	return seed.DedupKey(s.Content, extras...)
+}
@@ -0,0 +1,77 @@
+package fuzz
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+func TestSeedDedupIndex(t *testing.T) {
+	t.Run("should record and look up verdicts", func(t *testing.T) {
+		idx := newSeedDedupIndex(t.TempDir())
+
+		key := seed.DedupKey("int main(void) { return 0; }")
+		if _, ok := idx.lookup(key); ok {
+			t.Fatal("empty index should not contain the key")
+		}
+
+		idx.record(dedupRecord{Hash: key, SeedID: 7, Verdict: seed.OracleVerdictNormal})
+
+		rec, ok := idx.lookup(key)
+		if !ok {
+			t.Fatal("recorded key should be found")
+		}
+		if rec.SeedID != 7 || rec.Verdict != seed.OracleVerdictNormal {
+			t.Errorf("unexpected record: %+v", rec)
+		}
+	})
+
+	t.Run("should persist across restarts", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		idx := newSeedDedupIndex(tmpDir)
+
+		key := seed.DedupKey("int main(void) { return 1; }")
+		idx.record(dedupRecord{Hash: key, SeedID: 3, CompileFailed: true, CompileError: "boom"})
+
+		idx2 := newSeedDedupIndex(tmpDir)
+		rec, ok := idx2.lookup(key)
+		if !ok {
+			t.Fatal("persisted key should survive restart")
+		}
+		if !rec.CompileFailed || rec.CompileError != "boom" {
+			t.Errorf("unexpected record after reload: %+v", rec)
+		}
+	})
+
+	t.Run("should skip torn trailing record", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		idx := newSeedDedupIndex(tmpDir)
+		key := seed.DedupKey("int x;")
+		idx.record(dedupRecord{Hash: key, SeedID: 1})
+
+		f, err := os.OpenFile(filepath.Join(tmpDir, DedupIndexFileName), os.O_WRONLY|os.O_APPEND, 0644)
+		if err != nil {
+			t.Fatalf("failed to open index: %v", err)
+		}
+		if _, err := f.WriteString(`{"hash":"abc`); err != nil {
+			t.Fatalf("failed to write torn record: %v", err)
+		}
+		f.Close()
+
+		idx2 := newSeedDedupIndex(tmpDir)
+		if _, ok := idx2.lookup(key); !ok {
+			t.Error("intact records should load despite a torn trailing record")
+		}
+	})
+
+	t.Run("in-memory index should work without a state dir", func(t *testing.T) {
+		idx := newSeedDedupIndex("")
+		key := seed.DedupKey("int y;")
+		idx.record(dedupRecord{Hash: key, SeedID: 2})
+		if _, ok := idx.lookup(key); !ok {
+			t.Error("in-memory record should be found")
+		}
+	})
+}
@@ -4,6 +4,7 @@ package fuzz
 import (
 	"fmt"
 	"path/filepath"
+	"sync"
 	"time"
 
 	"github.com/zjy-dev/de-fuzz/internal/compiler"
@@ -11,6 +12,7 @@ import (
 	"github.com/zjy-dev/de-fuzz/internal/coverage"
 	"github.com/zjy-dev/de-fuzz/internal/llm"
 	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
 	"github.com/zjy-dev/de-fuzz/internal/oracle"
 	"github.com/zjy-dev/de-fuzz/internal/prompt"
 	"github.com/zjy-dev/de-fuzz/internal/seed"
@@ -41,11 +43,17 @@ type Config struct {
 	PromptService *prompt.PromptService
 
 	// Fuzzing parameters
-	MaxIterations   int           // Maximum iterations (0 = unlimited)
-	MaxRetries      int           // Max retries per target BB with divergence analysis
-	SaveInterval    time.Duration // State save interval
-	CoverageTimeout int           // Coverage measurement timeout in seconds
-	MappingPath     string        // Path to save/load coverage mapping
+	MaxIterations int // Maximum iterations (0 = unlimited)
+	MaxRetries    int // Max retries per target BB with divergence analysis
+
+	// CandidatesPerPrompt asks the LLM for K sampled candidate seeds per
+	// constraint-solving prompt (OpenAI n>1 sampling). Extra candidates are
+	// far cheaper than separate round-trips; all are compiled and the best
+	// scorer is kept. 0 or 1 keeps single-completion behavior.
+	CandidatesPerPrompt int
+	SaveInterval        time.Duration // State save interval
+	CoverageTimeout     int           // Coverage measurement timeout in seconds
+	MappingPath         string        // Path to save/load coverage mapping
 
 	// OracleType is the oracle type name (e.g. "canary", "ibt") used to select
 	// the defense-flag denylist when checking LLM-emitted CFlags.
@@ -58,6 +66,41 @@ type Config struct {
 	// Random Mutation Phase (activated when coverage is saturated)
 	EnableRandomPhase   bool // Enable random mutation phase after coverage saturation
 	MaxRandomIterations int  // Maximum iterations in random phase (0 = unlimited)
+
+	// Pipeline enables the pipelined iteration mode: while the current seed
+	// is compiling and being measured, the engine already issues the LLM
+	// request for the next target. Ignored when Workers > 1 (the worker
+	// pool already overlaps LLM latency).
+	Pipeline bool
+
+	// PipelineDepth bounds how many generations may be prefetched ahead of
+	// the execute stage (default 1).
+	PipelineDepth int
+
+	// Workers enables the parallel target-solving mode when > 1.
+	// N targets from Analyzer.SelectTarget are solved concurrently, so LLM
+	// round-trips overlap instead of serializing the whole loop.
+	Workers int
+
+	// WorkerCompilers optionally provides one compiler per worker, each with
+	// its own work directory, so concurrent compilations do not clobber each
+	// other's artifacts. Workers without a dedicated compiler fall back to
+	// the shared Compiler.
+	WorkerCompilers []compiler.Compiler
+
+	// WorkerCoverages optionally provides one coverage tracker per worker,
+	// each measuring an isolated counter set (GCOV_PREFIX isolation). When
+	// a worker has its own tracker, its compile+measure cycle no longer
+	// takes compileMu: the coverage package serializes the shared
+	// build-tree access internally, so compilations overlap. Workers
+	// without a dedicated tracker fall back to the shared Coverage.
+	WorkerCoverages []coverage.Coverage
+
+	// OnSeedQualified, when set, is called after a seed is admitted to the
+	// corpus with the admission reason ("coverage", "target" or "bug").
+	// Invoked under the merge lock, so implementations must not block —
+	// the orchestrator uses a buffered channel hand-off.
+	OnSeedQualified func(s *seed.Seed, reason string)
 }
 
 // Maximum number of debug log calls per prompt type
@@ -71,9 +114,13 @@ type Engine struct {
 	bugsFound      []*oracle.Bug
 	startTime      time.Time
 
-	// Paths for divergence analysis
-	currentBaseSeedPath    string
-	currentMutatedSeedPath string
+	// mergeMu serializes the merge step shared between workers:
+	// coverage recording, corpus admission and run counters.
+	mergeMu sync.Mutex
+
+	// compileMu serializes compile+measure cycles in parallel mode, because
+	// the instrumented compiler's .gcda counters are shared global state.
+	compileMu sync.Mutex
 
 	// Prompt debug log counters (to limit verbose output)
 	promptDebugCount map[string]int
@@ -81,6 +128,40 @@ type Engine struct {
 	// Lightweight profile aggregation for run summaries.
 	profileCoverage map[string]int
 	profileBugs     map[string]int
+
+	// dedup short-circuits tryMutatedSeed for content the campaign has
+	// already compiled and analyzed. See dedup.go.
+	dedup *seedDedupIndex
+}
+
+// workerState carries per-worker scratch state through one solve pipeline:
+// the compiler (with its own work directory in parallel mode) and the seed
+// paths used by divergence analysis.
+type workerState struct {
+	id       int
+	compiler compiler.Compiler
+
+	// coverage is the worker's tracker: the shared one by default, a
+	// dedicated isolated tracker when cfg.WorkerCoverages provides one.
+	coverage coverage.Coverage
+
+	// divergence enables uftrace-based refinement. It is disabled for
+	// parallel workers because the trace recording shares global state.
+	divergence bool
+
+	// Paths for divergence analysis
+	currentBaseSeedPath    string
+	currentMutatedSeedPath string
+}
+
+// defaultWorker returns the worker state used by the serial fuzzing loop.
+func (e *Engine) defaultWorker() *workerState {
+	return &workerState{
+		id:         0,
+		compiler:   e.cfg.Compiler,
+		coverage:   e.cfg.Coverage,
+		divergence: true,
+	}
 }
 
 // seedTryResult holds the result of trying a mutated seed.
@@ -103,23 +184,32 @@ func NewEngine(cfg Config) *Engine {
 	if cfg.MaxRetries <= 0 {
 		cfg.MaxRetries = 3
 	}
+	stateDir := ""
+	if cfg.MappingPath != "" {
+		stateDir = filepath.Dir(cfg.MappingPath)
+	}
 	return &Engine{
 		cfg:              cfg,
 		bugsFound:        make([]*oracle.Bug, 0),
 		promptDebugCount: make(map[string]int),
 		profileCoverage:  make(map[string]int),
 		profileBugs:      make(map[string]int),
+		dedup:            newSeedDedupIndex(stateDir),
 	}
 }
 
 // logPromptDebug logs prompt content with a limit per prompt type.
 // Returns true if the log was printed, false if limit exceeded.
 func (e *Engine) logPromptDebug(promptType, systemPrompt, userPrompt string) bool {
+	e.mergeMu.Lock()
 	if e.promptDebugCount[promptType] >= maxPromptDebugLogs {
+		e.mergeMu.Unlock()
 		return false
 	}
 	e.promptDebugCount[promptType]++
-	logger.Debug("=== LLM Call: %s (call %d/%d) ===", promptType, e.promptDebugCount[promptType], maxPromptDebugLogs)
+	count := e.promptDebugCount[promptType]
+	e.mergeMu.Unlock()
+	logger.Debug("=== LLM Call: %s (call %d/%d) ===", promptType, count, maxPromptDebugLogs)
 	logger.Debug("[System Prompt]:\n%s", systemPrompt)
 	logger.Debug("[User Prompt]:\n%s", userPrompt)
 	logger.Debug("=== End Prompts ===")
@@ -144,6 +234,19 @@ func (e *Engine) Run() error {
 		return nil
 	}
 
+	// Parallel mode: solve N targets concurrently via the worker pool
+	if e.cfg.Workers > 1 {
+		return e.runParallel()
+	}
+
+	// Pipeline mode: prefetch LLM generations while compiling/measuring
+	if e.cfg.Pipeline {
+		return e.runPipelined()
+	}
+
+	// Serial mode uses a single worker state across iterations
+	ws := e.defaultWorker()
+
 	// Main fuzzing loop
 	for {
 		// Check iteration limit (-1 = unlimited)
@@ -153,6 +256,7 @@ func (e *Engine) Run() error {
 		}
 
 		e.iterationCount++
+		metrics.IncCounter(metrics.CounterIterations)
 
 		// Step 1: Select target BB (one with most successors among uncovered)
 		target := e.cfg.Analyzer.SelectTarget()
@@ -174,13 +278,14 @@ func (e *Engine) Run() error {
 			e.iterationCount, target.Function, target.BBID, target.SuccessorCount, target.Lines)
 
 		// Step 2: Try to cover the target with constraint solving
-		hit, actualRetries, err := e.solveConstraint(target)
+		hit, actualRetries, err := e.solveConstraint(ws, target)
 		if err != nil {
 			logger.Error("Error solving constraint for %s:BB%d: %v", target.Function, target.BBID, err)
 		}
 
 		if hit {
 			e.targetHits++
+			metrics.IncCounter(metrics.CounterTargetHits)
 			logger.Info("Successfully covered target %s:BB%d!", target.Function, target.BBID)
 		} else {
 			logger.Warn("Failed to cover target %s:BB%d after %d retries",
@@ -213,17 +318,15 @@ func (e *Engine) processInitialSeeds() error {
 		seedCount++
 
 		logger.Debug("Processing initial seed %d...", s.Meta.ID)
-		seedStart := time.Now()
 
 		e.assignDefaultProfile(s)
 
 		// Get coverage before processing this seed
 		oldBasisPoints := e.cfg.Analyzer.GetBBCoverageBasisPoints()
 
-		// Compile and measure coverage
-		compileStart := time.Now()
+		// Compile and measure coverage (stage timings land in the metrics
+		// registry via measureSeed)
 		report, compileResult, err := e.measureSeed(s)
-		logger.Debug("[TIMING] Seed %d: compile+coverage took %v", s.Meta.ID, time.Since(compileStart))
 		if compileResult != nil {
 			e.persistCompilationRecord(s, compileResult)
 		}
@@ -234,10 +337,8 @@ func (e *Engine) processInitialSeeds() error {
 
 		// Record coverage in mapping
 		if report != nil {
-			recordStart := time.Now()
 			coveredLines := e.extractCoveredLines(report)
 			e.cfg.Analyzer.RecordCoverage(int64(s.Meta.ID), coveredLines)
-			logger.Debug("[TIMING] Seed %d: record coverage took %v", s.Meta.ID, time.Since(recordStart))
 		}
 
 		// Get coverage after processing
@@ -246,9 +347,7 @@ func (e *Engine) processInitialSeeds() error {
 		// Run oracle on initial seed if configured
 		oracleVerdict := seed.OracleVerdictSkipped
 		if e.cfg.Oracle != nil && compileResult != nil && compileResult.BinaryPath != "" {
-			oracleStart := time.Now()
 			bug := e.runOracle(s, compileResult.BinaryPath)
-			logger.Debug("[TIMING] Seed %d: oracle took %v", s.Meta.ID, time.Since(oracleStart))
 			if bug != nil {
 				oracleVerdict = seed.OracleVerdictBug
 				logger.Info("Initial seed %d triggered oracle bug: %s", s.Meta.ID, bug.Description)
@@ -264,15 +363,13 @@ func (e *Engine) processInitialSeeds() error {
 			NewCoverage:   newBasisPoints,
 			OracleVerdict: oracleVerdict,
 		})
-
-		logger.Debug("[TIMING] Seed %d: total processing took %v", s.Meta.ID, time.Since(seedStart))
 	}
 
 	// Log total timing for initial seeds
 	totalElapsed := time.Since(totalStart)
 	if seedCount > 0 {
 		avgPerSeed := totalElapsed / time.Duration(seedCount)
-		logger.Info("[TIMING] Processed %d initial seeds in %v (avg: %v/seed)", seedCount, totalElapsed, avgPerSeed)
+		logger.Info("Processed %d initial seeds in %v (avg: %v/seed)", seedCount, totalElapsed, avgPerSeed)
 	}
 
 	// Print initial coverage stats
@@ -291,7 +388,32 @@ func (e *Engine) processInitialSeeds() error {
 
 // solveConstraint tries to generate a seed that covers the target BB.
 // Returns (hit bool, actualRetries int, err error)
-func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error) {
+func (e *Engine) solveConstraint(ws *workerState, target *coverage.TargetInfo) (bool, int, error) {
+	gen, err := e.prepareGeneration(target)
+	if err != nil {
+		return false, 0, err
+	}
+	if gen.seed == nil {
+		return false, 0, nil
+	}
+	return e.solveFromFirstAttempt(ws, target, gen)
+}
+
+// generation holds the output of the generate stage for one target:
+// the prompt context and the LLM-generated candidate seeds (the first in
+// seed, any extra sampled candidates in alternates).
+type generation struct {
+	ctx          *prompt.TargetContext
+	baseSeedCode string
+	seed         *seed.Seed
+	alternates   []*seed.Seed
+}
+
+// prepareGeneration runs the generate stage for a target: it loads the base
+// seed, builds the prompt context and requests the first candidate from the
+// LLM. A nil generation.seed (with nil error) means the LLM call or response
+// parsing failed and the target should simply be skipped this iteration.
+func (e *Engine) prepareGeneration(target *coverage.TargetInfo) (*generation, error) {
 	if e.cfg.Flags != nil {
 		e.cfg.Flags.BeginTarget(target)
 	}
@@ -316,7 +438,7 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 	// Build target context for prompt
 	ctx, err := prompt.BuildTargetContextFromCFG(target, baseSeed, e.cfg.Analyzer)
 	if err != nil {
-		return false, 0, fmt.Errorf("failed to build target context: %w", err)
+		return nil, fmt.Errorf("failed to build target context: %w", err)
 	}
 	// Ensure base seed code is set in context
 	if baseSeedCode != "" && ctx.BaseSeedCode == "" {
@@ -325,14 +447,30 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 
 	// First attempt: direct constraint solving
 	e.attachPromptProfile(target, ctx, ctx.BaseSeedCode)
-	mutatedSeed, err := e.generateMutatedSeed(ctx)
+	candidates, err := e.generateCandidateSeeds(ctx)
 	if err != nil {
 		logger.Warn("Failed to generate mutated seed: %v", err)
-		return false, 0, nil
+		return &generation{ctx: ctx, baseSeedCode: baseSeedCode}, nil
 	}
 
+	return &generation{
+		ctx:          ctx,
+		baseSeedCode: baseSeedCode,
+		seed:         candidates[0],
+		alternates:   candidates[1:],
+	}, nil
+}
+
+// solveFromFirstAttempt runs the compile+cover and oracle stages for an
+// already-generated candidate, then the refinement retry loop.
+// Returns (hit bool, actualRetries int, err error)
+func (e *Engine) solveFromFirstAttempt(ws *workerState, target *coverage.TargetInfo, gen *generation) (bool, int, error) {
+	ctx := gen.ctx
+	baseSeedCode := gen.baseSeedCode
+	mutatedSeed := gen.seed
+
 	// Try the mutated seed
-	result, err := e.tryMutatedSeed(mutatedSeed, target)
+	result, err := e.tryMutatedSeed(ws, mutatedSeed, target)
 	if err != nil {
 		return false, 0, err
 	}
@@ -341,6 +479,21 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 		return true, 0, nil // Hit on first try, 0 retries needed
 	}
 
+	// Try any extra candidates sampled from the same prompt, keeping the
+	// best scorer as the base for the refinement loop.
+	for _, alt := range gen.alternates {
+		altResult, err := e.tryMutatedSeed(ws, alt, target)
+		if err != nil {
+			return false, 0, err
+		}
+		if altResult.HitTarget {
+			return true, 0, nil
+		}
+		if candidateScore(altResult) > candidateScore(result) {
+			result, mutatedSeed = altResult, alt
+		}
+	}
+
 	// If first attempt failed, try with divergence analysis
 	// Track last seed result for compile error feedback
 	var lastResult *seedTryResult
@@ -376,10 +529,12 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 			var divInfo *prompt.DivergenceInfo
 			divergentFunc := target.Function // Default to target function
 
-			if e.cfg.DivergenceAnalyzer != nil && e.cfg.CompilerPath != "" {
+			if ws.divergence && e.cfg.DivergenceAnalyzer != nil && e.cfg.CompilerPath != "" {
 				// Run uftrace divergence analysis
+				divergenceStart := time.Now()
 				divPoint, err := e.cfg.DivergenceAnalyzer.Analyze(
-					e.currentBaseSeedPath, e.currentMutatedSeedPath, e.cfg.CompilerPath)
+					ws.currentBaseSeedPath, ws.currentMutatedSeedPath, e.cfg.CompilerPath)
+				metrics.ObserveStage(metrics.StageDivergence, time.Since(divergenceStart))
 				if err != nil {
 					logger.Warn("Divergence analysis failed: %v", err)
 				} else if divPoint != nil {
@@ -436,7 +591,9 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 		}
 
 		// Call LLM with refined prompt
+		llmStart := time.Now()
 		completion, err := e.cfg.LLM.GetCompletionWithSystem(systemPrompt, refinedPrompt)
+		metrics.ObserveStage(metrics.StageLLM, time.Since(llmStart))
 		if err != nil {
 			logger.Warn("LLM call failed: %v", err)
 			continue
@@ -458,7 +615,7 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 		newSeed.FlagProfile = clonePromptProfile(ctx)
 
 		// Try the new seed with V2 to capture compile errors
-		lastResult, err = e.tryMutatedSeed(newSeed, target)
+		lastResult, err = e.tryMutatedSeed(ws, newSeed, target)
 		if err != nil {
 			return false, retry + 1, err
 		}
@@ -478,13 +635,31 @@ func (e *Engine) solveConstraint(target *coverage.TargetInfo) (bool, int, error)
 	}
 
 	// Failed to cover target after all retries - decay its weight
+	e.mergeMu.Lock()
 	e.cfg.Analyzer.DecayBBWeight(target.Function, target.BBID)
+	e.mergeMu.Unlock()
 
 	return false, e.cfg.MaxRetries, nil
 }
 
-// generateMutatedSeed generates a new seed using LLM with constraint solving prompt.
-func (e *Engine) generateMutatedSeed(ctx *prompt.TargetContext) (*seed.Seed, error) {
+// candidateScore ranks first-attempt candidates for refinement: new coverage
+// beats a clean compile, which beats a compile failure.
+func candidateScore(r *seedTryResult) int {
+	switch {
+	case r.CoveredNew:
+		return 2
+	case !r.CompileFailed:
+		return 1
+	default:
+		return 0
+	}
+}
+
+// generateCandidateSeeds generates new seeds using the LLM with the constraint
+// solving prompt. With CandidatesPerPrompt > 1 the extra candidates are
+// sampled in the same request, amortizing the LLM round-trip across several
+// compile attempts. Always returns at least one seed on success.
+func (e *Engine) generateCandidateSeeds(ctx *prompt.TargetContext) ([]*seed.Seed, error) {
 	// Build constraint solving prompt
 	systemPrompt, userPrompt, err := e.cfg.PromptService.GetConstraintPrompt(ctx)
 	if err != nil {
@@ -494,36 +669,55 @@ func (e *Engine) generateMutatedSeed(ctx *prompt.TargetContext) (*seed.Seed, err
 	// Debug: Log prompts (limited to first 3 calls)
 	e.logPromptDebug("generateMutatedSeed", systemPrompt, userPrompt)
 
+	n := e.cfg.CandidatesPerPrompt
+	if n < 1 {
+		n = 1
+	}
+
 	// Call LLM
-	completion, err := e.cfg.LLM.GetCompletionWithSystem(systemPrompt, userPrompt)
+	llmStart := time.Now()
+	completions, err := e.cfg.LLM.GetCompletionsWithSystem(systemPrompt, userPrompt, n)
+	metrics.ObserveStage(metrics.StageLLM, time.Since(llmStart))
 	if err != nil {
 		return nil, fmt.Errorf("LLM call failed: %w", err)
 	}
 
-	// Parse response
-	newSeed, err := e.cfg.PromptService.ParseLLMResponse(completion)
-	if err != nil {
-		return nil, fmt.Errorf("failed to parse response: %w", err)
-	}
+	var candidates []*seed.Seed
+	var lastParseErr error
+	for _, completion := range completions {
+		// Parse response
+		newSeed, err := e.cfg.PromptService.ParseLLMResponse(completion)
+		if err != nil {
+			lastParseErr = err
+			logger.Debug("Skipping unparseable candidate: %v", err)
+			continue
+		}
 
-	// Pre-allocate ID for the new seed before compilation
-	// This ensures the seed has a valid ID when being compiled
-	newSeed.Meta.ID = e.cfg.Corpus.AllocateID()
-	newSeed.Meta.CreatedAt = time.Now()
-	newSeed.FlagProfile = clonePromptProfile(ctx)
+		// Pre-allocate ID for the new seed before compilation
+		// This ensures the seed has a valid ID when being compiled
+		newSeed.Meta.ID = e.cfg.Corpus.AllocateID()
+		newSeed.Meta.CreatedAt = time.Now()
+		newSeed.FlagProfile = clonePromptProfile(ctx)
 
-	// Set lineage information from context
-	if ctx.BaseSeedID > 0 {
-		newSeed.Meta.ParentID = uint64(ctx.BaseSeedID)
-		// Depth will be properly set in tryMutatedSeed when we have parent info
+		// Set lineage information from context
+		if ctx.BaseSeedID > 0 {
+			newSeed.Meta.ParentID = uint64(ctx.BaseSeedID)
+			// Depth will be properly set in tryMutatedSeed when we have parent info
+		}
+
+		candidates = append(candidates, newSeed)
 	}
 
-	return newSeed, nil
+	if len(candidates) == 0 {
+		return nil, fmt.Errorf("failed to parse response: %w", lastParseErr)
+	}
+
+	return candidates, nil
 }
 
 // tryMutatedSeed compiles and runs a mutated seed, checking if it covers the target.
 // Returns detailed result including compile errors for LLM feedback.
-func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*seedTryResult, error) {
+func (e *Engine) tryMutatedSeed(ws *workerState, s *seed.Seed, target *coverage.TargetInfo) (*seedTryResult, error) {
 	result := &seedTryResult{
 		SeedCode: s.Content,
 	}
@@ -541,6 +735,37 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 		return result, nil
 	}
 
+	// Campaign-wide dedup: retry loops often re-emit content we have
+	// already processed (frequently the parent seed verbatim). Known
+	// content returns its recorded verdict without paying the
+	// compile + coverage + oracle pipeline again.
+	dedupKey := dedupKeyForSeed(s)
+	if rec, ok := e.dedup.lookup(dedupKey); ok {
+		metrics.IncCounter(metrics.CounterDedupHits)
+		logger.Debug("Seed %d duplicates already-processed content (seed %d), reusing verdict", s.Meta.ID, rec.SeedID)
+		result.CompileFailed = rec.CompileFailed
+		result.CompileError = rec.CompileError
+		result.OracleVerdict = rec.Verdict
+		return result, nil
+	}
+
+	// Host-side syntax gate: trivially malformed candidates skip the
+	// instrumented cross-compiler and go straight back into the
+	// compile-error feedback loop.
+	if ok, diag := seed.CheckSyntax(s.Content); !ok {
+		metrics.IncCounter(metrics.CounterSyntaxGateRejects)
+		result.CompileFailed = true
+		result.CompileError = diag
+		logger.Debug("Seed %d rejected by host syntax gate", s.Meta.ID)
+		e.dedup.record(dedupRecord{
+			Hash:          dedupKey,
+			SeedID:        s.Meta.ID,
+			CompileFailed: true,
+			CompileError:  diag,
+		})
+		return result, nil
+	}
+
 	// Save seed path for divergence analysis
 	stateDir := ""
 	if e.cfg.MappingPath != "" {
@@ -548,48 +773,26 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 	}
 
 	if s.Meta.ContentPath != "" {
-		e.currentMutatedSeedPath = s.Meta.ContentPath
+		ws.currentMutatedSeedPath = s.Meta.ContentPath
 	} else if stateDir != "" {
-		e.currentMutatedSeedPath = filepath.Join(stateDir, fmt.Sprintf("seed_%d.c", s.Meta.ID))
+		ws.currentMutatedSeedPath = filepath.Join(stateDir, fmt.Sprintf("seed_%d.c", s.Meta.ID))
 	}
 
-	if target.BaseSeed != "" && e.currentBaseSeedPath == "" && stateDir != "" {
-		e.currentBaseSeedPath = filepath.Join(stateDir, fmt.Sprintf("seed_%s.c", target.BaseSeed))
+	if target.BaseSeed != "" && ws.currentBaseSeedPath == "" && stateDir != "" {
+		ws.currentBaseSeedPath = filepath.Join(stateDir, fmt.Sprintf("seed_%s.c", target.BaseSeed))
 	}
 
-	// Compile first to detect compile errors
-	if preparer, ok := e.cfg.Coverage.(coverage.PreCompileCoverage); ok {
-		if err := preparer.Prepare(); err != nil {
-			return result, fmt.Errorf("coverage preparation failed: %w", err)
+	report, compileResult, err := e.compileAndMeasure(ws, s, result)
+	if err != nil || result.CompileFailed || report == nil {
+		if err == nil && result.CompileFailed {
+			e.dedup.record(dedupRecord{
+				Hash:          dedupKey,
+				SeedID:        s.Meta.ID,
+				CompileFailed: true,
+				CompileError:  result.CompileError,
+			})
 		}
-	}
-
-	compileResult, err := e.cfg.Compiler.Compile(s)
-	if err != nil {
-		result.CompileFailed = true
-		result.CompileError = fmt.Sprintf("compilation error: %v", err)
-		return result, nil
-	}
-
-	if !compileResult.Success {
-		result.CompileFailed = true
-		result.CompileError = compileResult.Stderr
-		logger.Debug("Seed failed to compile: %s", compileResult.Stderr)
-		return result, nil
-	}
-
-	// Measure coverage (generated by instrumented compiler during compilation)
-	if e.cfg.Coverage == nil {
-		return result, nil
-	}
-
-	report, err := measureCoverage(e.cfg.Coverage, s)
-	if err != nil {
-		return result, fmt.Errorf("coverage measurement failed: %w", err)
-	}
-
-	if report == nil {
-		return result, nil
+		return result, err
 	}
 
 	// Extract covered lines
@@ -610,12 +813,6 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 		}
 	}
 
-	// Get coverage before any recording
-	oldBasisPoints := e.cfg.Analyzer.GetBBCoverageBasisPoints()
-
-	// Check if this seed would cover any new lines (without recording yet)
-	hasNewCoverage := e.cfg.Analyzer.CheckNewCoverage(coveredLines)
-
 	// Run oracle for ALL mutated seeds (need to know bug status before deciding to record)
 	foundBug := false
 	if e.cfg.Oracle != nil {
@@ -635,6 +832,17 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 	// Persist oracle verdict to seed metadata
 	s.Meta.OracleVerdict = result.OracleVerdict
 
+	// Merge step: coverage recording and corpus admission are the only
+	// pieces shared between parallel workers, so they are serialized here.
+	e.mergeMu.Lock()
+	defer e.mergeMu.Unlock()
+
+	// Get coverage before any recording
+	oldBasisPoints := e.cfg.Analyzer.GetBBCoverageBasisPoints()
+
+	// Check if this seed would cover any new lines (without recording yet)
+	hasNewCoverage := e.cfg.Analyzer.CheckNewCoverage(coveredLines)
+
 	// Only record coverage for "qualified" seeds:
 	// - Seeds with new coverage
 	// - Seeds that found bugs
@@ -664,6 +872,7 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 		if err := e.cfg.Corpus.Add(s); err != nil {
 			logger.Warn("Failed to add seed to corpus: %v", err)
 		} else {
+			metrics.IncCounter(metrics.CounterCorpusAdds)
 			e.persistCompilationRecord(s, compileResult)
 			reason := "coverage"
 			if foundBug {
@@ -672,6 +881,9 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 				reason = "target"
 			}
 			logger.Info("Added seed %d to corpus (reason: %s, cov: %d -> %d bp)", s.Meta.ID, reason, oldBasisPoints, newBasisPoints)
+			if e.cfg.OnSeedQualified != nil {
+				e.cfg.OnSeedQualified(s, reason)
+			}
 		}
 
 		if e.cfg.Coverage != nil {
@@ -685,6 +897,12 @@ func (e *Engine) tryMutatedSeed(s *seed.Seed, target *coverage.TargetInfo) (*see
 		e.profileBugs[s.FlagProfile.Name]++
 	}
 
+	e.dedup.record(dedupRecord{
+		Hash:    dedupKey,
+		SeedID:  s.Meta.ID,
+		Verdict: result.OracleVerdict,
+	})
+
 	return result, nil
 }
 
@@ -747,6 +965,63 @@ func cloneProfileAxes(axes map[string]string) map[string]string {
 	return cloned
 }
 
+// compileAndMeasure compiles a seed with the worker's compiler and measures
+// coverage with the worker's tracker. Compile errors are recorded on result
+// rather than returned. When workers share the global tracker the whole
+// cycle holds compileMu, because the instrumented compiler writes shared
+// .gcda counter files; a worker with its own isolated tracker skips the
+// lock and overlaps with other compiles.
+func (e *Engine) compileAndMeasure(ws *workerState, s *seed.Seed, result *seedTryResult) (coverage.Report, *compiler.CompileResult, error) {
+	cov := ws.coverage
+	if cov == nil {
+		cov = e.cfg.Coverage
+	}
+	if e.cfg.Workers > 1 && cov == e.cfg.Coverage {
+		e.compileMu.Lock()
+		defer e.compileMu.Unlock()
+	}
+
+	// Compile first to detect compile errors
+	if preparer, ok := cov.(coverage.PreCompileCoverage); ok {
+		if err := preparer.Prepare(); err != nil {
+			return nil, nil, fmt.Errorf("coverage preparation failed: %w", err)
+		}
+	}
+
+	compileStart := time.Now()
+	compileResult, err := ws.compiler.Compile(s)
+	metrics.ObserveStage(metrics.StageCompile, time.Since(compileStart))
+	if err != nil {
+		result.CompileFailed = true
+		result.CompileError = fmt.Sprintf("compilation error: %v", err)
+		return nil, nil, nil
+	}
+	if compileResult.CacheHit {
+		metrics.IncCounter(metrics.CounterCompileCacheHits)
+	}
+
+	if !compileResult.Success {
+		result.CompileFailed = true
+		result.CompileError = compileResult.Stderr
+		logger.Debug("Seed failed to compile: %s", compileResult.Stderr)
+		return nil, compileResult, nil
+	}
+
+	// Measure coverage (generated by instrumented compiler during compilation)
+	if cov == nil {
+		return nil, compileResult, nil
+	}
+
+	coverageStart := time.Now()
+	report, err := measureCoverage(cov, s)
+	metrics.ObserveStage(metrics.StageCoverage, time.Since(coverageStart))
+	if err != nil {
+		return nil, compileResult, fmt.Errorf("coverage measurement failed: %w", err)
+	}
+
+	return report, compileResult, nil
+}
+
 // measureSeed compiles and measures coverage for a seed.
 // Returns the coverage report, compile result, and any error.
 func (e *Engine) measureSeed(s *seed.Seed) (coverage.Report, *compiler.CompileResult, error) {
@@ -757,10 +1032,15 @@ func (e *Engine) measureSeed(s *seed.Seed) (coverage.Report, *compiler.CompileRe
 	}
 
 	// Compile
+	compileStart := time.Now()
 	compileResult, err := e.cfg.Compiler.Compile(s)
+	metrics.ObserveStage(metrics.StageCompile, time.Since(compileStart))
 	if err != nil {
 		return nil, compileResult, fmt.Errorf("compilation failed: %w", err)
 	}
+	if compileResult.CacheHit {
+		metrics.IncCounter(metrics.CounterCompileCacheHits)
+	}
 
 	if !compileResult.Success {
 		logger.Debug("Seed failed to compile: %s", compileResult.Stderr)
@@ -772,7 +1052,9 @@ func (e *Engine) measureSeed(s *seed.Seed) (coverage.Report, *compiler.CompileRe
 		return nil, compileResult, nil
 	}
 
+	coverageStart := time.Now()
 	report, err := measureCoverage(e.cfg.Coverage, s)
+	metrics.ObserveStage(metrics.StageCoverage, time.Since(coverageStart))
 	if err != nil {
 		return nil, compileResult, fmt.Errorf("coverage measurement failed: %w", err)
 	}
@@ -824,6 +1106,9 @@ func (e *Engine) runOracle(s *seed.Seed, binaryPath string) *oracle.Bug {
 	if binaryPath == "" {
 		return nil
 	}
+	defer func(start time.Time) {
+		metrics.ObserveStage(metrics.StageOracle, time.Since(start))
+	}(time.Now())
 
 	ctx := &oracle.AnalyzeContext{
 		BinaryPath: binaryPath,
@@ -844,7 +1129,9 @@ func (e *Engine) runOracle(s *seed.Seed, binaryPath string) *oracle.Bug {
 
 	if bug != nil {
 		logger.Error("BUG FOUND in seed %d: %s", s.Meta.ID, bug.Description)
+		e.mergeMu.Lock()
 		e.bugsFound = append(e.bugsFound, bug)
+		e.mergeMu.Unlock()
 	}
 
 	return bug
@@ -868,6 +1155,10 @@ func (e *Engine) persistCompilationRecord(s *seed.Seed, compileResult *compiler.
 
 // saveState saves the current state.
 func (e *Engine) saveState() {
+	defer func(start time.Time) {
+		metrics.ObserveStage(metrics.StageStateSave, time.Since(start))
+	}(time.Now())
+
 	// Update total coverage in global state
 	coverageBP := e.cfg.Analyzer.GetBBCoverageBasisPoints()
 	e.cfg.Corpus.UpdateTotalCoverage(coverageBP)
@@ -883,6 +1174,13 @@ func (e *Engine) saveState() {
 	if err := e.cfg.Corpus.Save(); err != nil {
 		logger.Warn("Failed to save corpus: %v", err)
 	}
+
+	// Flush the resident total coverage to total.json
+	if flusher, ok := e.cfg.Coverage.(coverage.FlushableCoverage); ok {
+		if err := flusher.FlushTotal(); err != nil {
+			logger.Warn("Failed to flush total coverage: %v", err)
+		}
+	}
 }
 
 // finalizeState saves state and finalizes global state when fuzzing completes.
@@ -891,10 +1189,10 @@ func (e *Engine) finalizeState() {
 	coverageBP := e.cfg.Analyzer.GetBBCoverageBasisPoints()
 	e.cfg.Corpus.UpdateTotalCoverage(coverageBP)
 
-	// Save coverage mapping
+	// Save coverage mapping: compact the delta log and write the JSON snapshot
 	if e.cfg.MappingPath != "" {
-		if err := e.cfg.Analyzer.SaveMapping(e.cfg.MappingPath); err != nil {
-			logger.Warn("Failed to save mapping: %v", err)
+		if err := e.cfg.Analyzer.FinalizeMapping(e.cfg.MappingPath); err != nil {
+			logger.Warn("Failed to finalize mapping: %v", err)
 		}
 	}
 
@@ -902,6 +1200,13 @@ func (e *Engine) finalizeState() {
 	if err := e.cfg.Corpus.Finalize(); err != nil {
 		logger.Warn("Failed to finalize corpus: %v", err)
 	}
+
+	// Flush any merges accumulated since the last periodic checkpoint
+	if flusher, ok := e.cfg.Coverage.(coverage.FlushableCoverage); ok {
+		if err := flusher.FlushTotal(); err != nil {
+			logger.Warn("Failed to flush total coverage: %v", err)
+		}
+	}
 }
 
 // printSummary prints a summary of the fuzzing session.
@@ -164,6 +164,11 @@ func (m *mockLLM) GetCompletionWithSystem(system, prompt string) (string, error)
 	return m.response, nil
 }
 
+func (m *mockLLM) GetCompletionsWithSystem(system, prompt string, n int) ([]string, error) {
+	m.callCount++
+	return []string{m.response}, nil
+}
+
 func (m *mockLLM) Analyze(understanding string, query string, s *seed.Seed, diff string) (string, error) {
 	return "mock analysis", nil
 }
@@ -0,0 +1,196 @@
+// Parallel target-solving mode for the fuzzing engine.
+//
+// In this mode N workers each run the full solve pipeline (LLM call,
+// compile, coverage, oracle) for their own target BB. The expensive LLM
+// round-trips overlap across workers; only the merge step (coverage
+// recording and corpus admission, see Engine.mergeMu) and the
+// compile+measure cycle (shared .gcda counters, see Engine.compileMu)
+// are serialized. With per-worker coverage isolation (cfg.WorkerCoverages,
+// GCOV_PREFIX) the compile+measure serialization falls away too.
+package fuzz
+
+import (
+	"fmt"
+	"sync"
+
+	"github.com/zjy-dev/de-fuzz/internal/compiler"
+	"github.com/zjy-dev/de-fuzz/internal/coverage"
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
+)
+
+// targetDispatcher hands out targets to workers, making sure two workers
+// never solve the same basic block at the same time.
+type targetDispatcher struct {
+	mu       sync.Mutex
+	cond     *sync.Cond
+	engine   *Engine
+	inFlight map[string]bool
+	issued   int  // Number of iterations handed out so far
+	done     bool // Set once no more targets should be issued
+}
+
+func newTargetDispatcher(e *Engine) *targetDispatcher {
+	d := &targetDispatcher{
+		engine:   e,
+		inFlight: make(map[string]bool),
+	}
+	d.cond = sync.NewCond(&d.mu)
+	return d
+}
+
+// next selects the next target for a worker. It returns (nil, 0) when the
+// iteration limit is reached or all target BBs are covered.
+func (d *targetDispatcher) next() (*coverage.TargetInfo, int) {
+	d.mu.Lock()
+	defer d.mu.Unlock()
+
+	for {
+		if d.done {
+			return nil, 0
+		}
+		if d.engine.cfg.MaxIterations > 0 && d.issued >= d.engine.cfg.MaxIterations {
+			d.done = true
+			d.cond.Broadcast()
+			return nil, 0
+		}
+
+		// SelectTarget reads the weight tables that workers mutate under
+		// mergeMu (DecayBBWeight), so serialize against the merge step.
+		d.engine.mergeMu.Lock()
+		target := d.engine.cfg.Analyzer.SelectTarget()
+		d.engine.mergeMu.Unlock()
+		if target == nil {
+			if len(d.inFlight) == 0 {
+				d.done = true
+				d.cond.Broadcast()
+				return nil, 0
+			}
+			// Another worker may still record coverage that exposes new
+			// targets; wait for a completion and re-select.
+			d.cond.Wait()
+			continue
+		}
+
+		key := fmt.Sprintf("%s:%d", target.Function, target.BBID)
+		if d.inFlight[key] {
+			// The top-weighted BB is already being solved; wait for a
+			// completion so either it finishes or weights change.
+			d.cond.Wait()
+			continue
+		}
+
+		d.inFlight[key] = true
+		d.issued++
+		return target, d.issued
+	}
+}
+
+// finish releases a target after its worker is done with it.
+func (d *targetDispatcher) finish(target *coverage.TargetInfo) {
+	d.mu.Lock()
+	delete(d.inFlight, fmt.Sprintf("%s:%d", target.Function, target.BBID))
+	d.cond.Broadcast()
+	d.mu.Unlock()
+}
+
+// workerCompiler returns the dedicated compiler for a worker, falling back
+// to the shared compiler when no per-worker compiler was configured.
+func (e *Engine) workerCompiler(workerID int) compiler.Compiler {
+	if workerID < len(e.cfg.WorkerCompilers) && e.cfg.WorkerCompilers[workerID] != nil {
+		return e.cfg.WorkerCompilers[workerID]
+	}
+	return e.cfg.Compiler
+}
+
+// workerCoverage returns the dedicated coverage tracker for a worker,
+// falling back to the shared tracker when no isolated one was configured.
+func (e *Engine) workerCoverage(workerID int) coverage.Coverage {
+	if workerID < len(e.cfg.WorkerCoverages) && e.cfg.WorkerCoverages[workerID] != nil {
+		return e.cfg.WorkerCoverages[workerID]
+	}
+	return e.cfg.Coverage
+}
+
+// runParallel runs the constraint solving loop with cfg.Workers concurrent
+// workers. Divergence analysis is disabled for workers because uftrace
+// trace recording shares global state; refinement falls back to
+// compile-error feedback.
+func (e *Engine) runParallel() error {
+	workers := e.cfg.Workers
+	logger.Info("Parallel mode: solving targets with %d workers", workers)
+
+	dispatcher := newTargetDispatcher(e)
+	var wg sync.WaitGroup
+
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func(workerID int) {
+			defer wg.Done()
+			e.parallelWorkerLoop(workerID, dispatcher)
+		}(i)
+	}
+	wg.Wait()
+
+	// Enter random mutation phase if enabled and all targets are covered
+	if e.cfg.EnableRandomPhase && e.cfg.Analyzer.SelectTarget() == nil {
+		logger.Info("Entering random mutation phase...")
+		randomPhase := NewRandomMutationPhase(e, e.cfg.MaxRandomIterations)
+		if err := randomPhase.Run(); err != nil {
+			logger.Error("Random phase error: %v", err)
+		}
+	}
+
+	e.finalizeState()
+	e.printSummary()
+	return nil
+}
+
+// parallelWorkerLoop pulls targets from the dispatcher until exhaustion.
+func (e *Engine) parallelWorkerLoop(workerID int, dispatcher *targetDispatcher) {
+	ws := &workerState{
+		id:         workerID,
+		compiler:   e.workerCompiler(workerID),
+		coverage:   e.workerCoverage(workerID),
+		divergence: false,
+	}
+
+	for {
+		target, iteration := dispatcher.next()
+		if target == nil {
+			return
+		}
+
+		logger.Info("Iteration %d (worker %d): Targeting %s:BB%d (succs=%d, lines=%v)",
+			iteration, workerID, target.Function, target.BBID, target.SuccessorCount, target.Lines)
+
+		hit, actualRetries, err := e.solveConstraint(ws, target)
+		if err != nil {
+			logger.Error("Error solving constraint for %s:BB%d: %v", target.Function, target.BBID, err)
+		}
+
+		e.mergeMu.Lock()
+		e.iterationCount++
+		metrics.IncCounter(metrics.CounterIterations)
+		if hit {
+			e.targetHits++
+			metrics.IncCounter(metrics.CounterTargetHits)
+		}
+		saveDue := e.iterationCount%10 == 0
+		e.mergeMu.Unlock()
+
+		if hit {
+			logger.Info("Successfully covered target %s:BB%d!", target.Function, target.BBID)
+		} else {
+			logger.Warn("Failed to cover target %s:BB%d after %d retries",
+				target.Function, target.BBID, actualRetries)
+		}
+
+		dispatcher.finish(target)
+
+		// Save state periodically (same cadence as the serial loop)
+		if saveDue {
+			e.saveState()
+		}
+	}
+}
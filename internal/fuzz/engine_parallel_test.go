@@ -0,0 +1,81 @@
+package fuzz
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/zjy-dev/de-fuzz/internal/compiler"
+	"github.com/zjy-dev/de-fuzz/internal/coverage"
+)
+
+func TestEngine_WorkerCompilerFallback(t *testing.T) {
+	shared := compiler.NewGCCCompiler(compiler.GCCCompilerConfig{WorkDir: "shared"})
+	dedicated := compiler.NewGCCCompiler(compiler.GCCCompilerConfig{WorkDir: "worker-0"})
+
+	engine := NewEngine(Config{
+		Compiler:        shared,
+		Workers:         2,
+		WorkerCompilers: []compiler.Compiler{dedicated},
+	})
+
+	if got := engine.workerCompiler(0); got != compiler.Compiler(dedicated) {
+		t.Error("Worker 0 should get its dedicated compiler")
+	}
+	// Worker 1 has no dedicated compiler and must fall back to the shared one
+	if got := engine.workerCompiler(1); got != compiler.Compiler(shared) {
+		t.Error("Worker 1 should fall back to the shared compiler")
+	}
+}
+
+func TestTargetDispatcher_IterationLimit(t *testing.T) {
+	tmpDir := t.TempDir()
+
+	cfgContent := `;; Function test_func (_Z9test_funcii, funcdef_no=1, decl_uid=100, cgraph_uid=1, symbol_order=1)
+;; 2 succs { 3 4 }
+;; 3 succs { 4 }
+;; 4 succs { 1 }
+int test_func (int a, int b)
+{
+  <bb 2> :
+  [/path/to/test.cc:10:3] if (a > b)
+
+  <bb 3> :
+  [/path/to/test.cc:11:5] result = a;
+
+  <bb 4> :
+  [/path/to/test.cc:13:3] return result;
+}
+`
+	cfgPath := filepath.Join(tmpDir, "test.cc.015t.cfg")
+	if err := os.WriteFile(cfgPath, []byte(cfgContent), 0644); err != nil {
+		t.Fatalf("Failed to write CFG file: %v", err)
+	}
+
+	analyzer, err := coverage.NewAnalyzer([]string{cfgPath}, []string{"test_func"}, "", filepath.Join(tmpDir, "mapping.json"), 0.8)
+	if err != nil {
+		t.Fatalf("Failed to create analyzer: %v", err)
+	}
+
+	engine := NewEngine(Config{
+		Analyzer:      analyzer,
+		Workers:       2,
+		MaxIterations: 1,
+	})
+
+	dispatcher := newTargetDispatcher(engine)
+
+	target, iteration := dispatcher.next()
+	if target == nil {
+		t.Fatal("First call should hand out a target")
+	}
+	if iteration != 1 {
+		t.Errorf("Expected iteration 1, got %d", iteration)
+	}
+	dispatcher.finish(target)
+
+	// Limit is 1, so the dispatcher must refuse further targets
+	if target, _ := dispatcher.next(); target != nil {
+		t.Errorf("Expected no target after iteration limit, got %s:BB%d", target.Function, target.BBID)
+	}
+}
@@ -0,0 +1,161 @@
+// Pipelined iteration mode for the fuzzing engine.
+//
+// The generate stage (target selection + constraint prompt + LLM call) runs
+// in its own goroutine and feeds a small bounded channel, so the 5-20s LLM
+// round-trip for target N+1 overlaps the compile+cover and oracle stages of
+// target N. The execute stages stay sequential per seed because corpus
+// admission needs the oracle verdict, and refinement retries keep their
+// inline LLM calls (they depend on the previous attempt's outcome).
+package fuzz
+
+import (
+	"fmt"
+
+	"github.com/zjy-dev/de-fuzz/internal/coverage"
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
+)
+
+// pipelinedGeneration is one unit of work handed from the generate stage to
+// the execute stage.
+type pipelinedGeneration struct {
+	target *coverage.TargetInfo
+	gen    *generation
+	err    error
+}
+
+// runPipelined runs the constraint solving loop with a prefetching generate
+// stage. Target selection happens in the generator, so a prefetched target
+// may occasionally be covered by the seed currently executing; the execute
+// stage re-checks and skips such stale targets cheaply.
+func (e *Engine) runPipelined() error {
+	depth := e.cfg.PipelineDepth
+	if depth <= 0 {
+		depth = 1
+	}
+	logger.Info("Pipeline mode: prefetching up to %d LLM generation(s)", depth)
+
+	generations := make(chan *pipelinedGeneration, depth)
+	stop := make(chan struct{})
+	defer close(stop)
+
+	go e.generateStage(generations, stop)
+
+	ws := e.defaultWorker()
+	for pg := range generations {
+		e.iterationCount++
+		metrics.IncCounter(metrics.CounterIterations)
+
+		if pg.err != nil {
+			logger.Error("Error generating for %s:BB%d: %v", pg.target.Function, pg.target.BBID, pg.err)
+			continue
+		}
+
+		// The generator selected this target before the previous seed's
+		// coverage was recorded; skip it if it has been covered meanwhile.
+		if e.targetCovered(pg.target) {
+			logger.Debug("Prefetched target %s:BB%d already covered, skipping", pg.target.Function, pg.target.BBID)
+			continue
+		}
+
+		logger.Info("Iteration %d: Targeting %s:BB%d (succs=%d, lines=%v)",
+			e.iterationCount, pg.target.Function, pg.target.BBID, pg.target.SuccessorCount, pg.target.Lines)
+
+		if pg.gen.seed == nil {
+			// LLM call or response parsing failed during prefetch
+			continue
+		}
+
+		hit, actualRetries, err := e.solveFromFirstAttempt(ws, pg.target, pg.gen)
+		if err != nil {
+			logger.Error("Error solving constraint for %s:BB%d: %v", pg.target.Function, pg.target.BBID, err)
+		}
+
+		if hit {
+			e.targetHits++
+			metrics.IncCounter(metrics.CounterTargetHits)
+			logger.Info("Successfully covered target %s:BB%d!", pg.target.Function, pg.target.BBID)
+		} else {
+			logger.Warn("Failed to cover target %s:BB%d after %d retries",
+				pg.target.Function, pg.target.BBID, actualRetries)
+		}
+
+		// Save state periodically
+		if e.iterationCount%10 == 0 {
+			e.saveState()
+		}
+	}
+
+	// Enter random mutation phase if enabled and all targets are covered
+	if e.cfg.EnableRandomPhase && e.cfg.Analyzer.SelectTarget() == nil {
+		logger.Info("Entering random mutation phase...")
+		randomPhase := NewRandomMutationPhase(e, e.cfg.MaxRandomIterations)
+		if err := randomPhase.Run(); err != nil {
+			logger.Error("Random phase error: %v", err)
+		}
+	}
+
+	e.finalizeState()
+	e.printSummary()
+	return nil
+}
+
+// generateStage selects targets and issues LLM generations ahead of the
+// execute stage, writing into the bounded channel until the iteration limit
+// is reached or no uncovered target remains.
+func (e *Engine) generateStage(generations chan<- *pipelinedGeneration, stop <-chan struct{}) {
+	defer close(generations)
+
+	issued := 0
+	inFlight := make(map[string]bool)
+
+	for {
+		if e.cfg.MaxIterations > 0 && issued >= e.cfg.MaxIterations {
+			logger.Info("Reached max iterations (%d), stopping", e.cfg.MaxIterations)
+			return
+		}
+
+		// Selection reads the weight tables that the execute stage mutates
+		// (DecayBBWeight under mergeMu), so serialize against the merge step.
+		e.mergeMu.Lock()
+		target := e.cfg.Analyzer.SelectTarget()
+		e.mergeMu.Unlock()
+		if target == nil {
+			logger.Info("All target basic blocks covered! Fuzzing complete.")
+			return
+		}
+
+		// Avoid prefetching the same BB twice in a row: the weights only
+		// change once the execute stage finishes the previous attempt.
+		key := fmt.Sprintf("%s:%d", target.Function, target.BBID)
+		if inFlight[key] {
+			// Single generator, so the only way forward is a different
+			// candidate; SelectTarget randomizes among top-weight BBs.
+			inFlight = make(map[string]bool)
+		}
+		inFlight[key] = true
+
+		gen, err := e.prepareGeneration(target)
+		issued++
+
+		select {
+		case generations <- &pipelinedGeneration{target: target, gen: gen, err: err}:
+		case <-stop:
+			return
+		}
+	}
+}
+
+// targetCovered reports whether every line of the target BB is already in
+// the coverage mapping.
+func (e *Engine) targetCovered(target *coverage.TargetInfo) bool {
+	if target == nil || len(target.Lines) == 0 {
+		return false
+	}
+	for _, lineNum := range target.Lines {
+		if !e.cfg.Analyzer.IsLineCovered(target.File, lineNum) {
+			return false
+		}
+	}
+	return true
+}
@@ -0,0 +1,54 @@
+package fuzz
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/zjy-dev/de-fuzz/internal/coverage"
+)
+
+func TestEngine_TargetCovered(t *testing.T) {
+	tmpDir := t.TempDir()
+
+	cfgContent := `;; Function test_func (_Z9test_funcii, funcdef_no=1, decl_uid=100, cgraph_uid=1, symbol_order=1)
+;; 2 succs { 3 }
+;; 3 succs { 1 }
+int test_func (int a, int b)
+{
+  <bb 2> :
+  [/path/to/test.cc:10:3] if (a > b)
+
+  <bb 3> :
+  [/path/to/test.cc:11:5] result = a;
+}
+`
+	cfgPath := filepath.Join(tmpDir, "test.cc.015t.cfg")
+	if err := os.WriteFile(cfgPath, []byte(cfgContent), 0644); err != nil {
+		t.Fatalf("Failed to write CFG file: %v", err)
+	}
+
+	analyzer, err := coverage.NewAnalyzer([]string{cfgPath}, []string{"test_func"}, "", filepath.Join(tmpDir, "mapping.json"), 0.8)
+	if err != nil {
+		t.Fatalf("Failed to create analyzer: %v", err)
+	}
+
+	engine := NewEngine(Config{Analyzer: analyzer, Pipeline: true})
+
+	target := &coverage.TargetInfo{
+		Function: "test_func",
+		BBID:     3,
+		Lines:    []int{11},
+		File:     "/path/to/test.cc",
+	}
+
+	if engine.targetCovered(target) {
+		t.Error("Target should not be covered before any coverage is recorded")
+	}
+
+	analyzer.RecordCoverage(1, []string{"/path/to/test.cc:11"})
+
+	if !engine.targetCovered(target) {
+		t.Error("Target should be covered after its line was recorded")
+	}
+}
@@ -5,6 +5,7 @@ import (
 	"sort"
 	"strconv"
 	"strings"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/config"
 	"github.com/zjy-dev/de-fuzz/internal/coverage"
@@ -21,11 +22,14 @@ var canaryLLMBlockedFlagFamilies = []string{
 }
 
 // FlagScheduler deterministically rotates compiler flag profiles during fuzzing.
+// It is safe for concurrent use by parallel workers.
 type FlagScheduler struct {
 	allowLLMCFlags bool
 	mainProfiles   []*seed.FlagProfile
 	defaultProfile *seed.FlagProfile
-	targetCursor   map[string]int
+
+	mu           sync.Mutex
+	targetCursor map[string]int
 }
 
 // NewFlagScheduler builds a canary-specific flag scheduler from configuration.
@@ -99,6 +103,8 @@ func (s *FlagScheduler) NextProfileForTarget(target *coverage.TargetInfo, source
 	}
 
 	key := targetKey(target)
+	s.mu.Lock()
+	defer s.mu.Unlock()
 	start := s.targetCursor[key]
 	for offset := 0; offset < len(s.mainProfiles); offset++ {
 		idx := (start + offset) % len(s.mainProfiles)
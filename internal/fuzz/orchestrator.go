@@ -0,0 +1,144 @@
+package fuzz
+
+import (
+	"errors"
+	"fmt"
+	"sync"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// orchestrator.go runs several architecture campaigns in one process.
+//
+// Separate per-ISA defuzz processes never shared anything, although a
+// seed that penetrates a defense on one ISA is an excellent candidate
+// for the others — the initial seed layouts are already arch-parallel.
+// The Orchestrator keeps each campaign's own compile/coverage/oracle
+// pipeline and corpus (their state directories stay resumable), and
+// cross-pollinates bug-finding and target-hitting seeds between the
+// campaigns' corpora; the command layer additionally hands every engine
+// the same rate-limited LLM client so the campaigns share one request
+// budget instead of four idle ones.
+
+// pollination is one qualified seed traveling from its home campaign to
+// the siblings.
+type pollination struct {
+	from   int
+	s      *seed.Seed
+	reason string
+}
+
+// Orchestrator owns the registered campaign engines and the
+// cross-pollination dispatcher.
+type Orchestrator struct {
+	labels  []string
+	engines []*Engine
+	inbox   chan pollination
+}
+
+// NewOrchestrator creates an empty orchestrator.
+func NewOrchestrator() *Orchestrator {
+	return &Orchestrator{
+		// Buffered so the hook (invoked under an engine's merge lock)
+		// never blocks; overflow is dropped, not queued.
+		inbox: make(chan pollination, 64),
+	}
+}
+
+// Register adds one campaign and hooks its corpus admissions into the
+// cross-pollination channel. Only bug-finding and target-hitting seeds
+// travel: plain coverage gains are arch-specific almost by definition.
+func (o *Orchestrator) Register(label string, e *Engine) {
+	idx := len(o.engines)
+	o.labels = append(o.labels, label)
+	o.engines = append(o.engines, e)
+
+	e.cfg.OnSeedQualified = func(s *seed.Seed, reason string) {
+		if reason == "coverage" {
+			return
+		}
+		select {
+		case o.inbox <- pollination{from: idx, s: s, reason: reason}:
+		default:
+			logger.Debug("[Orchestrator] Pollination queue full, dropping seed %d from %s", s.Meta.ID, label)
+		}
+	}
+}
+
+// Run starts every campaign and the dispatcher, blocking until all
+// campaigns finish. Errors are joined so one failed campaign does not
+// hide another's.
+func (o *Orchestrator) Run() error {
+	if len(o.engines) == 0 {
+		return fmt.Errorf("no campaigns registered")
+	}
+
+	done := make(chan struct{})
+	go o.dispatch(done)
+
+	var wg sync.WaitGroup
+	errs := make([]error, len(o.engines))
+	for i := range o.engines {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			logger.Info("[Orchestrator] Campaign %s starting", o.labels[i])
+			errs[i] = o.engines[i].Run()
+			if errs[i] != nil {
+				errs[i] = fmt.Errorf("campaign %s: %w", o.labels[i], errs[i])
+			}
+			logger.Info("[Orchestrator] Campaign %s finished", o.labels[i])
+		}(i)
+	}
+	wg.Wait()
+	close(done)
+
+	return errors.Join(errs...)
+}
+
+// dispatch forwards pollinations to sibling campaigns until stopped.
+func (o *Orchestrator) dispatch(done <-chan struct{}) {
+	for {
+		select {
+		case p := <-o.inbox:
+			o.pollinate(p)
+		case <-done:
+			return
+		}
+	}
+}
+
+// pollinate injects a qualified seed into every campaign except its
+// origin.
+func (o *Orchestrator) pollinate(p pollination) {
+	for i, e := range o.engines {
+		if i == p.from {
+			continue
+		}
+		if err := e.InjectSeed(crossSeed(p.s)); err != nil {
+			logger.Warn("[Orchestrator] Failed to inject seed into %s: %v", o.labels[i], err)
+			continue
+		}
+		logger.Info("[Orchestrator] Cross-pollinated %s seed from %s to %s", p.reason, o.labels[p.from], o.labels[i])
+	}
+}
+
+// crossSeed clones the portable part of a seed for a sibling campaign.
+// IDs, flags and flag profiles are arch- and campaign-specific, so the
+// receiving corpus assigns a fresh ID and its own scheduler picks flags.
+func crossSeed(s *seed.Seed) *seed.Seed {
+	return &seed.Seed{
+		Content:   s.Content,
+		TestCases: append([]seed.TestCase(nil), s.TestCases...),
+	}
+}
+
+// InjectSeed admits an externally sourced seed (cross-pollination from a
+// sibling campaign) through the same serialized merge step the engine's
+// own workers use.
+func (e *Engine) InjectSeed(s *seed.Seed) error {
+	e.mergeMu.Lock()
+	defer e.mergeMu.Unlock()
+	return e.cfg.Corpus.Add(s)
+}
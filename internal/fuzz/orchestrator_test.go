@@ -0,0 +1,89 @@
+package fuzz
+
+import (
+	"testing"
+
+	"github.com/zjy-dev/de-fuzz/internal/corpus"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+func newTestCampaign(t *testing.T) *Engine {
+	t.Helper()
+	cm := corpus.NewFileManager(t.TempDir())
+	if err := cm.Initialize(); err != nil {
+		t.Fatalf("failed to initialize corpus: %v", err)
+	}
+	return NewEngine(Config{Corpus: cm})
+}
+
+func TestOrchestrator_RunWithoutCampaigns(t *testing.T) {
+	orch := NewOrchestrator()
+	if err := orch.Run(); err == nil {
+		t.Error("Run with no registered campaigns should fail")
+	}
+}
+
+func TestOrchestrator_QualifiedSeedQueueing(t *testing.T) {
+	orch := NewOrchestrator()
+	ea := newTestCampaign(t)
+	eb := newTestCampaign(t)
+	orch.Register("a", ea)
+	orch.Register("b", eb)
+
+	s := &seed.Seed{Content: "int main(void) { return 0; }"}
+
+	// Coverage-only seeds stay local.
+	ea.cfg.OnSeedQualified(s, "coverage")
+	if len(orch.inbox) != 0 {
+		t.Errorf("coverage seed should not be queued, inbox has %d", len(orch.inbox))
+	}
+
+	// Bug and target seeds travel.
+	ea.cfg.OnSeedQualified(s, "bug")
+	eb.cfg.OnSeedQualified(s, "target")
+	if len(orch.inbox) != 2 {
+		t.Fatalf("expected 2 queued pollinations, got %d", len(orch.inbox))
+	}
+	p := <-orch.inbox
+	if p.from != 0 || p.reason != "bug" {
+		t.Errorf("unexpected pollination: from=%d reason=%q", p.from, p.reason)
+	}
+}
+
+func TestOrchestrator_PollinateSkipsOrigin(t *testing.T) {
+	orch := NewOrchestrator()
+	ea := newTestCampaign(t)
+	eb := newTestCampaign(t)
+	orch.Register("a", ea)
+	orch.Register("b", eb)
+
+	s := &seed.Seed{Content: "int main(void) { return 1; }"}
+	orch.pollinate(pollination{from: 0, s: s, reason: "bug"})
+
+	if got := ea.cfg.Corpus.Len(); got != 0 {
+		t.Errorf("origin corpus should be untouched, has %d seeds", got)
+	}
+	if got := eb.cfg.Corpus.Len(); got != 1 {
+		t.Errorf("sibling corpus should have 1 seed, has %d", got)
+	}
+}
+
+func TestOrchestrator_CrossSeedDropsCampaignSpecifics(t *testing.T) {
+	s := &seed.Seed{
+		Content:   "int main(void) { return 2; }",
+		CFlags:    []string{"-O2"},
+		TestCases: []seed.TestCase{{RunningCommand: "./a.out", ExpectedResult: "2"}},
+	}
+	s.Meta.ID = 42
+
+	clone := crossSeed(s)
+	if clone.Content != s.Content {
+		t.Error("content should be preserved")
+	}
+	if len(clone.TestCases) != 1 {
+		t.Errorf("test cases should be preserved, got %d", len(clone.TestCases))
+	}
+	if clone.Meta.ID != 0 || len(clone.CFlags) != 0 {
+		t.Error("ID and CFlags are campaign-specific and should be dropped")
+	}
+}
@@ -5,11 +5,13 @@ import (
 	"math/rand"
 	"time"
 
-	"github.com/zjy-dev/de-fuzz/internal/corpus"
+	"github.com/zjy-dev/de-fuzz/internal/compiler"
 	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
 	"github.com/zjy-dev/de-fuzz/internal/oracle"
 	"github.com/zjy-dev/de-fuzz/internal/prompt"
 	"github.com/zjy-dev/de-fuzz/internal/seed"
+	"github.com/zjy-dev/de-fuzz/internal/state"
 )
 
 // RandomMutationPhase manages the random mutation phase after coverage saturation.
@@ -45,6 +47,12 @@ func (p *RandomMutationPhase) Run() error {
 		return nil
 	}
 
+	// Every random-phase iteration is independent, so with a worker pool
+	// configured the phase runs its own concurrent executor.
+	if p.engine.cfg.Workers > 1 {
+		return p.runParallel(processedSeeds)
+	}
+
 	for {
 		// Check iteration limit
 		if p.maxIterations > 0 && p.iterationCount >= p.maxIterations {
@@ -53,6 +61,7 @@ func (p *RandomMutationPhase) Run() error {
 		}
 
 		p.iterationCount++
+		metrics.IncCounter(metrics.CounterIterations)
 
 		// Select a random seed from processed seeds
 		baseSeed := processedSeeds[p.rng.Intn(len(processedSeeds))]
@@ -82,8 +91,13 @@ func (p *RandomMutationPhase) Run() error {
 func (p *RandomMutationPhase) getProcessedSeeds() []*seed.Seed {
 	var seeds []*seed.Seed
 
-	// Get seeds from corpus - try to get recent seeds
-	fm, ok := p.engine.cfg.Corpus.(*corpus.FileManager)
+	// Get seeds from corpus - try to get recent seeds. Both FileManager
+	// and PackedManager expose their state manager; anything else cannot
+	// feed the random phase.
+	fm, ok := p.engine.cfg.Corpus.(interface {
+		GetStateManager() *state.FileManager
+		Get(id uint64) (*seed.Seed, error)
+	})
 	if !ok {
 		logger.Warn("Cannot access corpus for random phase")
 		return seeds
@@ -109,15 +123,54 @@ func (p *RandomMutationPhase) getProcessedSeeds() []*seed.Seed {
 	return seeds
 }
 
-// mutateAndCheck mutates a seed and checks if it triggers a bug.
-// Returns the bug if found, nil otherwise.
-func (p *RandomMutationPhase) mutateAndCheck(baseSeed *seed.Seed) (*oracle.Bug, error) {
-	// Build mutation prompt using the standard mutation prompt
+// mutationPrompt builds the standard mutation prompt for this phase.
+func (p *RandomMutationPhase) mutationPrompt() (systemPrompt, userPrompt string, err error) {
 	mutationCtx := &prompt.MutationContext{
 		TotalCoveragePercentage: float64(p.engine.cfg.Analyzer.GetBBCoverageBasisPoints()) / 100.0,
 	}
+	return p.engine.cfg.PromptService.GetMutatePrompt("", mutationCtx)
+}
 
-	systemPrompt, userPrompt, err := p.engine.cfg.PromptService.GetMutatePrompt("", mutationCtx)
+// adoptMutation parses one LLM completion into a mutated child of baseSeed,
+// allocating its ID and lineage metadata.
+func (p *RandomMutationPhase) adoptMutation(baseSeed *seed.Seed, completion string) (*seed.Seed, error) {
+	mutatedSeed, err := p.engine.cfg.PromptService.ParseLLMResponse(completion)
+	if err != nil {
+		return nil, err
+	}
+
+	mutatedSeed.Meta.ID = p.engine.cfg.Corpus.AllocateID()
+	mutatedSeed.Meta.ParentID = baseSeed.Meta.ID
+	mutatedSeed.Meta.Depth = baseSeed.Meta.Depth + 1
+	mutatedSeed.Meta.CreatedAt = time.Now()
+	p.engine.assignDefaultProfile(mutatedSeed)
+	return mutatedSeed, nil
+}
+
+// persistBug persists a bug-triggering seed to the corpus. Corpus admission
+// is serialized under the engine's merge lock, the same discipline the
+// solving loop uses, so the parallel executor can call this too.
+func (p *RandomMutationPhase) persistBug(s *seed.Seed, compileResult *compiler.CompileResult, bug *oracle.Bug) {
+	s.Meta.OracleVerdict = seed.OracleVerdictBug
+	s.Meta.BugDescription = bug.Description
+
+	p.engine.mergeMu.Lock()
+	err := p.engine.cfg.Corpus.Add(s)
+	p.engine.mergeMu.Unlock()
+
+	if err != nil {
+		logger.Warn("Failed to persist bug-triggering seed: %v", err)
+		return
+	}
+	metrics.IncCounter(metrics.CounterCorpusAdds)
+	p.engine.persistCompilationRecord(s, compileResult)
+}
+
+// mutateAndCheck mutates a seed and checks if it triggers a bug.
+// Returns the bug if found, nil otherwise.
+func (p *RandomMutationPhase) mutateAndCheck(baseSeed *seed.Seed) (*oracle.Bug, error) {
+	// Build mutation prompt using the standard mutation prompt
+	systemPrompt, userPrompt, err := p.mutationPrompt()
 	if err != nil {
 		return nil, err
 	}
@@ -129,26 +182,23 @@ func (p *RandomMutationPhase) mutateAndCheck(baseSeed *seed.Seed) (*oracle.Bug,
 	// logger.Debug("=== End Prompts ===")
 
 	// Call LLM
+	llmStart := time.Now()
 	completion, err := p.engine.cfg.LLM.GetCompletionWithSystem(systemPrompt, userPrompt)
+	metrics.ObserveStage(metrics.StageLLM, time.Since(llmStart))
 	if err != nil {
 		return nil, err
 	}
 
-	// Parse response
-	mutatedSeed, err := p.engine.cfg.PromptService.ParseLLMResponse(completion)
+	// Parse response and allocate ID
+	mutatedSeed, err := p.adoptMutation(baseSeed, completion)
 	if err != nil {
 		return nil, err
 	}
 
-	// Allocate ID
-	mutatedSeed.Meta.ID = p.engine.cfg.Corpus.AllocateID()
-	mutatedSeed.Meta.ParentID = baseSeed.Meta.ID
-	mutatedSeed.Meta.Depth = baseSeed.Meta.Depth + 1
-	mutatedSeed.Meta.CreatedAt = time.Now()
-	p.engine.assignDefaultProfile(mutatedSeed)
-
 	// Compile the seed
+	compileStart := time.Now()
 	compileResult, err := p.engine.cfg.Compiler.Compile(mutatedSeed)
+	metrics.ObserveStage(metrics.StageCompile, time.Since(compileStart))
 	if err != nil || !compileResult.Success {
 		logger.Debug("Random phase: seed %d failed to compile", mutatedSeed.Meta.ID)
 		return nil, nil
@@ -162,13 +212,7 @@ func (p *RandomMutationPhase) mutateAndCheck(baseSeed *seed.Seed) (*oracle.Bug,
 	bug := p.engine.runOracle(mutatedSeed, compileResult.BinaryPath)
 	if bug != nil {
 		// Persist the seed that found a bug
-		mutatedSeed.Meta.OracleVerdict = seed.OracleVerdictBug
-		mutatedSeed.Meta.BugDescription = bug.Description
-		if err := p.engine.cfg.Corpus.Add(mutatedSeed); err != nil {
-			logger.Warn("Failed to persist bug-triggering seed: %v", err)
-		} else {
-			p.engine.persistCompilationRecord(mutatedSeed, compileResult)
-		}
+		p.persistBug(mutatedSeed, compileResult, bug)
 	}
 
 	return bug, nil
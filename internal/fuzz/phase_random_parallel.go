@@ -0,0 +1,166 @@
+// Parallel executor for the random mutation phase.
+//
+// Unlike the target-solving loop there is no ordering constraint here at
+// all — every mutation is independent — so nothing needs dispatching: a
+// generator goroutine batches M mutations per LLM request
+// (cfg.CandidatesPerPrompt), a worker pool compiles and oracle-checks
+// them on per-worker compilers (which carry GCOV_PREFIX isolation when
+// configured), and results funnel back through a single merge step.
+// Saturation-phase fuzzing is where campaigns run for days, so this is
+// where the worker pool pays off most.
+package fuzz
+
+import (
+	"sync"
+	"time"
+
+	"github.com/zjy-dev/de-fuzz/internal/compiler"
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+	"github.com/zjy-dev/de-fuzz/internal/metrics"
+	"github.com/zjy-dev/de-fuzz/internal/oracle"
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// randomResult is one compiled-and-checked mutation funneled to the
+// merge step. compileResult and bug are nil when the stage did not run
+// or did not trigger.
+type randomResult struct {
+	s             *seed.Seed
+	compileResult *compiler.CompileResult
+	bug           *oracle.Bug
+}
+
+// runParallel executes the random mutation phase with cfg.Workers
+// concurrent compile/oracle workers fed by a single generator.
+func (p *RandomMutationPhase) runParallel(processedSeeds []*seed.Seed) error {
+	workers := p.engine.cfg.Workers
+	batch := p.engine.cfg.CandidatesPerPrompt
+	if batch < 1 {
+		batch = 1
+	}
+	logger.Info("Random phase: parallel mode (%d workers, %d mutations per LLM batch)", workers, batch)
+
+	jobs := make(chan *seed.Seed, workers)
+	results := make(chan randomResult, workers)
+
+	go p.generatorLoop(processedSeeds, batch, jobs)
+
+	var wg sync.WaitGroup
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func(workerID int) {
+			defer wg.Done()
+			p.checkWorker(workerID, jobs, results)
+		}(i)
+	}
+	go func() {
+		wg.Wait()
+		close(results)
+	}()
+
+	// Single merge step: bug accounting and corpus persistence stay
+	// serialized here, mirroring the engine's merge discipline.
+	for res := range results {
+		if res.bug == nil {
+			continue
+		}
+		p.bugsFoundInPhase++
+		logger.Info("Random phase: BUG FOUND (total: %d)", p.bugsFoundInPhase)
+		p.persistBug(res.s, res.compileResult, res.bug)
+	}
+
+	logger.Info("Random mutation phase complete: %d iterations, %d bugs found",
+		p.iterationCount, p.bugsFoundInPhase)
+	return nil
+}
+
+// generatorLoop feeds mutated seeds to the workers, batch per LLM
+// request, and closes jobs once the iteration budget is spent. It is the
+// only writer of p.iterationCount and the only user of p.rng, so neither
+// needs locking; the merge loop reads the count only after the channels
+// have drained.
+func (p *RandomMutationPhase) generatorLoop(processedSeeds []*seed.Seed, batch int, jobs chan<- *seed.Seed) {
+	defer close(jobs)
+
+	for {
+		n := batch
+		if p.maxIterations > 0 {
+			remaining := p.maxIterations - p.iterationCount
+			if remaining <= 0 {
+				logger.Info("Random phase: reached max iterations (%d)", p.maxIterations)
+				return
+			}
+			if n > remaining {
+				n = remaining
+			}
+		}
+
+		baseSeed := processedSeeds[p.rng.Intn(len(processedSeeds))]
+
+		systemPrompt, userPrompt, err := p.mutationPrompt()
+		if err != nil {
+			logger.Warn("Random phase: failed to build mutation prompt: %v", err)
+			return
+		}
+
+		llmStart := time.Now()
+		completions, err := p.engine.cfg.LLM.GetCompletionsWithSystem(systemPrompt, userPrompt, n)
+		metrics.ObserveStage(metrics.StageLLM, time.Since(llmStart))
+
+		// A failed batch still consumes its iterations, matching the
+		// serial loop where an LLM error burns the iteration.
+		p.iterationCount += n
+		for i := 0; i < n; i++ {
+			metrics.IncCounter(metrics.CounterIterations)
+		}
+		if err != nil {
+			logger.Warn("Random mutation failed: %v", err)
+			continue
+		}
+
+		for _, completion := range completions {
+			mutatedSeed, err := p.adoptMutation(baseSeed, completion)
+			if err != nil {
+				logger.Debug("Random phase: skipping unparseable mutation: %v", err)
+				continue
+			}
+			logger.Debug("Random phase: mutating seed %d -> %d", baseSeed.Meta.ID, mutatedSeed.Meta.ID)
+			jobs <- mutatedSeed
+		}
+	}
+}
+
+// checkWorker compiles and oracle-checks mutations on its own compiler.
+// A worker without a dedicated compiler shares the engine's and must
+// hold compileMu, because concurrent compiles would clobber the shared
+// work directory and .gcda counters.
+func (p *RandomMutationPhase) checkWorker(workerID int, jobs <-chan *seed.Seed, results chan<- randomResult) {
+	comp := p.engine.workerCompiler(workerID)
+	shared := comp == p.engine.cfg.Compiler
+
+	for s := range jobs {
+		res := randomResult{s: s}
+
+		compileStart := time.Now()
+		if shared {
+			p.engine.compileMu.Lock()
+		}
+		compileResult, err := comp.Compile(s)
+		if shared {
+			p.engine.compileMu.Unlock()
+		}
+		metrics.ObserveStage(metrics.StageCompile, time.Since(compileStart))
+
+		if err != nil || !compileResult.Success {
+			logger.Debug("Random phase: seed %d failed to compile", s.Meta.ID)
+			results <- res
+			continue
+		}
+		res.compileResult = compileResult
+
+		if p.engine.cfg.Oracle != nil {
+			res.bug = p.engine.runOracle(s, compileResult.BinaryPath)
+		}
+		results <- res
+	}
+}
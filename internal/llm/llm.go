@@ -12,6 +12,11 @@ type LLM interface {
 	// GetCompletionWithSystem sends a prompt with system context to the LLM.
 	GetCompletionWithSystem(systemPrompt, userPrompt string) (string, error)
 
+	// GetCompletionsWithSystem samples up to n completions for one prompt in
+	// a single request where the backend supports it (OpenAI n>1 sampling).
+	// Backends without multi-choice support may return fewer candidates.
+	GetCompletionsWithSystem(systemPrompt, userPrompt string, n int) ([]string, error)
+
 	// Understand processes the initial prompt and returns the LLM's summary.
 	Understand(prompt string) (string, error)
 
@@ -0,0 +1,67 @@
+package llm
+
+import (
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// RateLimited wraps an LLM client and bounds the number of in-flight
+// requests, so several campaigns sharing one client (orchestrator mode)
+// draw from a single request budget instead of oversubscribing the
+// backend.
+type RateLimited struct {
+	inner LLM
+	sem   chan struct{}
+}
+
+// NewRateLimited wraps inner with a concurrency bound. maxConcurrent
+// values below 1 are treated as 1.
+func NewRateLimited(inner LLM, maxConcurrent int) *RateLimited {
+	if maxConcurrent < 1 {
+		maxConcurrent = 1
+	}
+	return &RateLimited{
+		inner: inner,
+		sem:   make(chan struct{}, maxConcurrent),
+	}
+}
+
+// acquire blocks until a request slot is free and returns its release.
+func (r *RateLimited) acquire() func() {
+	r.sem <- struct{}{}
+	return func() { <-r.sem }
+}
+
+func (r *RateLimited) GetCompletion(prompt string) (string, error) {
+	defer r.acquire()()
+	return r.inner.GetCompletion(prompt)
+}
+
+func (r *RateLimited) GetCompletionWithSystem(systemPrompt, userPrompt string) (string, error) {
+	defer r.acquire()()
+	return r.inner.GetCompletionWithSystem(systemPrompt, userPrompt)
+}
+
+func (r *RateLimited) GetCompletionsWithSystem(systemPrompt, userPrompt string, n int) ([]string, error) {
+	defer r.acquire()()
+	return r.inner.GetCompletionsWithSystem(systemPrompt, userPrompt, n)
+}
+
+func (r *RateLimited) Understand(prompt string) (string, error) {
+	defer r.acquire()()
+	return r.inner.Understand(prompt)
+}
+
+func (r *RateLimited) Generate(understanding, prompt string) (*seed.Seed, error) {
+	defer r.acquire()()
+	return r.inner.Generate(understanding, prompt)
+}
+
+func (r *RateLimited) Analyze(understanding, prompt string, s *seed.Seed, feedback string) (string, error) {
+	defer r.acquire()()
+	return r.inner.Analyze(understanding, prompt, s, feedback)
+}
+
+func (r *RateLimited) Mutate(understanding, prompt string, s *seed.Seed) (*seed.Seed, error) {
+	defer r.acquire()()
+	return r.inner.Mutate(understanding, prompt, s)
+}
@@ -63,6 +63,57 @@ func (c *RemixerClient) GetCompletionWithSystem(systemPrompt, userPrompt string)
 	return strings.TrimSpace(result.Content), nil
 }
 
+// GetCompletionsWithSystem samples up to n completions for one prompt in a
+// single request. Providers without multi-choice support (and the Responses
+// protocol) return a single candidate, which callers must tolerate.
+func (c *RemixerClient) GetCompletionsWithSystem(systemPrompt, userPrompt string, n int) ([]string, error) {
+	if n <= 1 {
+		completion, err := c.GetCompletionWithSystem(systemPrompt, userPrompt)
+		if err != nil {
+			return nil, err
+		}
+		return []string{completion}, nil
+	}
+
+	var messages []remixerMessage
+	if systemPrompt != "" {
+		messages = append(messages, remixerMessage{
+			Role:    "system",
+			Content: systemPrompt,
+		})
+	}
+	messages = append(messages, remixerMessage{
+		Role:    "user",
+		Content: userPrompt,
+	})
+
+	temp := c.temperature
+	result, err := c.remixer.Chat(context.Background(), remixerChatRequest{
+		Messages:    messages,
+		Temperature: &temp,
+		N:           n,
+	})
+	if err != nil {
+		return nil, fmt.Errorf("remixer chat failed: %w", err)
+	}
+
+	raw := result.Contents
+	if len(raw) == 0 {
+		raw = []string{result.Content}
+	}
+
+	completions := make([]string, 0, len(raw))
+	for _, content := range raw {
+		if trimmed := strings.TrimSpace(content); trimmed != "" {
+			completions = append(completions, trimmed)
+		}
+	}
+	if len(completions) == 0 {
+		return nil, fmt.Errorf("remixer chat returned no usable completions")
+	}
+	return completions, nil
+}
+
 // Understand processes the initial prompt and returns the LLM's summary.
 func (c *RemixerClient) Understand(prompt string) (string, error) {
 	return c.GetCompletion(prompt)
@@ -23,6 +23,11 @@ type remixerModelConfig struct {
 	Name      string                  `yaml:"name"`
 	Weight    int                     `yaml:"weight"`
 	Providers []remixerProviderConfig `yaml:"providers"`
+
+	// Adaptive opts this model into latency/error-aware routing: its weight
+	// is scaled by a health factor from a moving window of recent requests,
+	// so a degraded endpoint sheds traffic instead of stalling the loop.
+	Adaptive bool `yaml:"adaptive,omitempty"`
 }
 
 type remixerProviderConfig struct {
@@ -4,6 +4,7 @@ import (
 	"context"
 	"fmt"
 	"math/rand/v2"
+	"time"
 )
 
 type remixerMessage struct {
@@ -15,11 +16,20 @@ type remixerChatRequest struct {
 	Messages    []remixerMessage `json:"messages"`
 	Temperature *float64         `json:"temperature,omitempty"`
 	MaxTokens   *int             `json:"max_tokens,omitempty"`
+
+	// N requests multiple sampled completions in one round-trip where the
+	// provider protocol supports it; providers that cannot honor it return
+	// a single choice.
+	N int `json:"n,omitempty"`
 }
 
 type remixerChatResponse struct {
 	Content string `json:"content"`
 	Model   string `json:"model"`
+
+	// Contents holds every returned choice when N > 1 was requested and
+	// honored; Content always mirrors the first choice.
+	Contents []string `json:"contents,omitempty"`
 }
 
 type remixerChatResult struct {
@@ -34,11 +44,18 @@ type remixerProvider interface {
 type weightedSelector struct {
 	entries     []selectorEntry
 	totalWeight int
+
+	// health drives adaptive routing for entries that opted in; nil or no
+	// opted-in entries means pure static-weight selection.
+	health      *healthTracker
+	hasAdaptive bool
 }
 
 type selectorEntry struct {
 	name      string
 	providers []remixerProvider
+	weight    int
+	adaptive  bool
 	upper     int
 }
 
@@ -68,7 +85,10 @@ func newRemixerEngine(configPath string) (*remixerEngine, error) {
 func (r *remixerEngine) Chat(ctx context.Context, req remixerChatRequest) (remixerChatResult, error) {
 	selected := r.selector.Select()
 
+	start := time.Now()
 	resp, err := selected.Provider.Chat(ctx, req)
+	r.selector.health.record(selected.ModelName, time.Since(start), err != nil)
+
 	if err != nil {
 		return remixerChatResult{}, fmt.Errorf("model %q: %w", selected.ModelName, err)
 	}
@@ -82,6 +102,7 @@ func (r *remixerEngine) Chat(ctx context.Context, req remixerChatRequest) (remix
 func newWeightedSelector(models []remixerModelConfig) (*weightedSelector, error) {
 	entries := make([]selectorEntry, 0, len(models))
 	cumulative := 0
+	hasAdaptive := false
 
 	for _, model := range models {
 		providers := make([]remixerProvider, 0, len(model.Providers))
@@ -94,9 +115,14 @@ func newWeightedSelector(models []remixerModelConfig) (*weightedSelector, error)
 		}
 
 		cumulative += model.Weight
+		if model.Adaptive {
+			hasAdaptive = true
+		}
 		entries = append(entries, selectorEntry{
 			name:      model.Name,
 			providers: providers,
+			weight:    model.Weight,
+			adaptive:  model.Adaptive,
 			upper:     cumulative,
 		})
 	}
@@ -104,10 +130,16 @@ func newWeightedSelector(models []remixerModelConfig) (*weightedSelector, error)
 	return &weightedSelector{
 		entries:     entries,
 		totalWeight: cumulative,
+		health:      newHealthTracker(),
+		hasAdaptive: hasAdaptive,
 	}, nil
 }
 
 func (ws *weightedSelector) Select() selectorResult {
+	if ws.hasAdaptive {
+		return ws.selectAdaptive()
+	}
+
 	r := rand.IntN(ws.totalWeight)
 	for _, entry := range ws.entries {
 		if r < entry.upper {
@@ -124,3 +156,44 @@ func (ws *weightedSelector) Select() selectorResult {
 		Provider:  last.providers[0],
 	}
 }
+
+// selectAdaptive scales opted-in entries' static weights by their current
+// health factor and draws from the resulting distribution, so traffic shifts
+// away from slow or erroring endpoints while they still get a probe share.
+func (ws *weightedSelector) selectAdaptive() selectorResult {
+	names := make([]string, 0, len(ws.entries))
+	for _, entry := range ws.entries {
+		if entry.adaptive {
+			names = append(names, entry.name)
+		}
+	}
+	factors := ws.health.factors(names)
+
+	effective := make([]float64, len(ws.entries))
+	total := 0.0
+	for i, entry := range ws.entries {
+		w := float64(entry.weight)
+		if entry.adaptive {
+			w *= factors[entry.name]
+		}
+		effective[i] = w
+		total += w
+	}
+
+	r := rand.Float64() * total
+	for i, entry := range ws.entries {
+		r -= effective[i]
+		if r < 0 {
+			return selectorResult{
+				ModelName: entry.name,
+				Provider:  entry.providers[0],
+			}
+		}
+	}
+
+	last := ws.entries[len(ws.entries)-1]
+	return selectorResult{
+		ModelName: last.name,
+		Provider:  last.providers[0],
+	}
+}
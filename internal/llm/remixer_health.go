@@ -0,0 +1,140 @@
+package llm
+
+import (
+	"sync"
+	"time"
+)
+
+// Adaptive routing health tracking.
+//
+// A degraded endpoint (60s+ latencies, rate limits) used to keep receiving
+// its full static weight share and stall the fuzzing loop. Every Chat call
+// records its outcome here; models that opt in via `adaptive: true` have
+// their configured weight scaled by a health factor derived from a moving
+// window of latency and error rate. Degraded models keep a small floor share
+// (slow-start re-probing), so the window refreshes and a recovered endpoint
+// earns its weight back without operator intervention.
+
+const (
+	// healthWindowSize is the number of recent requests per model the
+	// factor is computed over.
+	healthWindowSize = 16
+
+	// minHealthFactor is the slow-start floor: even a fully degraded model
+	// keeps this fraction of its weight so it is periodically re-probed.
+	minHealthFactor = 0.05
+)
+
+// healthSample is one completed request against a model.
+type healthSample struct {
+	latency time.Duration
+	failed  bool
+}
+
+// modelHealth is a fixed-size ring of the most recent samples for one model.
+type modelHealth struct {
+	samples [healthWindowSize]healthSample
+	count   int
+	next    int
+}
+
+func (h *modelHealth) record(latency time.Duration, failed bool) {
+	h.samples[h.next] = healthSample{latency: latency, failed: failed}
+	h.next = (h.next + 1) % healthWindowSize
+	if h.count < healthWindowSize {
+		h.count++
+	}
+}
+
+// stats returns the window's average latency and error rate.
+// ok is false when there are no samples yet.
+func (h *modelHealth) stats() (avgLatency time.Duration, errorRate float64, ok bool) {
+	if h.count == 0 {
+		return 0, 0, false
+	}
+
+	var total time.Duration
+	failures := 0
+	for i := 0; i < h.count; i++ {
+		total += h.samples[i].latency
+		if h.samples[i].failed {
+			failures++
+		}
+	}
+	return total / time.Duration(h.count), float64(failures) / float64(h.count), true
+}
+
+// healthTracker aggregates per-model health across concurrent Chat calls.
+type healthTracker struct {
+	mu     sync.Mutex
+	models map[string]*modelHealth
+}
+
+func newHealthTracker() *healthTracker {
+	return &healthTracker{models: make(map[string]*modelHealth)}
+}
+
+func (t *healthTracker) record(model string, latency time.Duration, failed bool) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	h, ok := t.models[model]
+	if !ok {
+		h = &modelHealth{}
+		t.models[model] = h
+	}
+	h.record(latency, failed)
+}
+
+// factors returns a weight multiplier in [minHealthFactor, 1] for each of the
+// given models. A model without samples gets 1 (nothing known against it).
+// For the rest the factor is (1 - errorRate) scaled by how the model's
+// average latency compares to the fastest model in the set, so a healthy but
+// slow endpoint is demoted proportionally rather than cut off.
+func (t *healthTracker) factors(names []string) map[string]float64 {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	type stat struct {
+		avg     time.Duration
+		errRate float64
+	}
+	stats := make(map[string]stat, len(names))
+	var fastest time.Duration
+	for _, name := range names {
+		h, ok := t.models[name]
+		if !ok {
+			continue
+		}
+		avg, errRate, ok := h.stats()
+		if !ok {
+			continue
+		}
+		stats[name] = stat{avg: avg, errRate: errRate}
+		if fastest == 0 || avg < fastest {
+			fastest = avg
+		}
+	}
+
+	result := make(map[string]float64, len(names))
+	for _, name := range names {
+		s, ok := stats[name]
+		if !ok {
+			result[name] = 1
+			continue
+		}
+
+		factor := 1 - s.errRate
+		if s.avg > 0 && fastest > 0 {
+			factor *= float64(fastest) / float64(s.avg)
+		}
+		if factor < minHealthFactor {
+			factor = minHealthFactor
+		}
+		if factor > 1 {
+			factor = 1
+		}
+		result[name] = factor
+	}
+	return result
+}
@@ -0,0 +1,98 @@
+package llm
+
+import (
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+)
+
+func TestModelHealthWindow(t *testing.T) {
+	h := &modelHealth{}
+
+	_, _, ok := h.stats()
+	assert.False(t, ok, "no samples yet")
+
+	// Fill the window with failures, then overwrite it with successes: the
+	// ring must forget the old outcomes.
+	for i := 0; i < healthWindowSize; i++ {
+		h.record(time.Second, true)
+	}
+	_, errRate, ok := h.stats()
+	assert.True(t, ok)
+	assert.Equal(t, 1.0, errRate)
+
+	for i := 0; i < healthWindowSize; i++ {
+		h.record(100*time.Millisecond, false)
+	}
+	avg, errRate, ok := h.stats()
+	assert.True(t, ok)
+	assert.Equal(t, 0.0, errRate)
+	assert.Equal(t, 100*time.Millisecond, avg)
+}
+
+func TestHealthTrackerFactors(t *testing.T) {
+	tracker := newHealthTracker()
+
+	// fast: healthy and quick. slow: healthy but 10x latency.
+	// broken: fast but always erroring.
+	for i := 0; i < healthWindowSize; i++ {
+		tracker.record("fast", 1*time.Second, false)
+		tracker.record("slow", 10*time.Second, false)
+		tracker.record("broken", 1*time.Second, true)
+	}
+
+	factors := tracker.factors([]string{"fast", "slow", "broken", "unseen"})
+
+	assert.Equal(t, 1.0, factors["fast"])
+	assert.InDelta(t, 0.1, factors["slow"], 0.01, "latency ratio demotion")
+	assert.Equal(t, minHealthFactor, factors["broken"], "floor keeps re-probing")
+	assert.Equal(t, 1.0, factors["unseen"], "no data means no demotion")
+}
+
+func TestSelectAdaptiveShiftsTraffic(t *testing.T) {
+	ws := &weightedSelector{
+		entries: []selectorEntry{
+			{name: "healthy", providers: []remixerProvider{nil}, weight: 1, adaptive: true, upper: 1},
+			{name: "degraded", providers: []remixerProvider{nil}, weight: 1, adaptive: true, upper: 2},
+		},
+		totalWeight: 2,
+		health:      newHealthTracker(),
+		hasAdaptive: true,
+	}
+
+	// Equal static weights and no samples: roughly even split.
+	counts := map[string]int{}
+	for i := 0; i < 2000; i++ {
+		counts[ws.Select().ModelName]++
+	}
+	assert.InDelta(t, 1000, counts["degraded"], 200)
+
+	// Degrade one endpoint: it should drop to the probe floor share.
+	for i := 0; i < healthWindowSize; i++ {
+		ws.health.record("healthy", time.Second, false)
+		ws.health.record("degraded", time.Second, true)
+	}
+	counts = map[string]int{}
+	for i := 0; i < 2000; i++ {
+		counts[ws.Select().ModelName]++
+	}
+	assert.Less(t, counts["degraded"], 300, "degraded model sheds traffic")
+	assert.Greater(t, counts["degraded"], 0, "but keeps a probe share")
+}
+
+func TestSelectStaticWhenNoAdaptiveModels(t *testing.T) {
+	ws := &weightedSelector{
+		entries: []selectorEntry{
+			{name: "only", providers: []remixerProvider{nil}, weight: 1, upper: 1},
+		},
+		totalWeight: 1,
+		health:      newHealthTracker(),
+	}
+
+	// Static path must not consult health at all.
+	for i := 0; i < healthWindowSize; i++ {
+		ws.health.record("only", time.Second, true)
+	}
+	assert.Equal(t, "only", ws.Select().ModelName)
+}
@@ -122,6 +122,9 @@ func (p *openAIProvider) chatCompletions(ctx context.Context, req remixerChatReq
 	if req.MaxTokens != nil {
 		openAIRequest.MaxTokens = *req.MaxTokens
 	}
+	if req.N > 1 {
+		openAIRequest.N = req.N
+	}
 
 	resp, err := p.client.CreateChatCompletion(ctx, openAIRequest)
 	if err != nil {
@@ -131,9 +134,15 @@ func (p *openAIProvider) chatCompletions(ctx context.Context, req remixerChatReq
 		return remixerChatResponse{}, fmt.Errorf("openai chat completion: no choices returned")
 	}
 
+	contents := make([]string, 0, len(resp.Choices))
+	for _, choice := range resp.Choices {
+		contents = append(contents, choice.Message.Content)
+	}
+
 	return remixerChatResponse{
-		Content: resp.Choices[0].Message.Content,
-		Model:   resp.Model,
+		Content:  contents[0],
+		Contents: contents,
+		Model:    resp.Model,
 	}, nil
 }
 
@@ -132,6 +132,61 @@ func TestOpenAIProviderChat(t *testing.T) {
 	}
 }
 
+func TestOpenAIProviderChatMultipleChoices(t *testing.T) {
+	p := testOpenAIProvider(
+		t,
+		"https://openai.example",
+		"test-model",
+		"test-key",
+		"",
+		func(r *http.Request) (*http.Response, error) {
+			var body map[string]any
+			if err := json.NewDecoder(r.Body).Decode(&body); err != nil {
+				t.Fatalf("decoding request body: %v", err)
+			}
+			if body["n"] != float64(3) {
+				t.Errorf("expected n=3, got %v", body["n"])
+			}
+
+			return newJSONResponse(t, http.StatusOK, map[string]any{
+				"id":    "test-id",
+				"model": "test-model",
+				"choices": []map[string]any{
+					{
+						"index":         0,
+						"message":       map[string]any{"role": "assistant", "content": "first"},
+						"finish_reason": "stop",
+					},
+					{
+						"index":         1,
+						"message":       map[string]any{"role": "assistant", "content": "second"},
+						"finish_reason": "stop",
+					},
+					{
+						"index":         2,
+						"message":       map[string]any{"role": "assistant", "content": "third"},
+						"finish_reason": "stop",
+					},
+				},
+			}), nil
+		},
+	)
+
+	resp, err := p.Chat(context.Background(), remixerChatRequest{
+		Messages: []remixerMessage{{Role: "user", Content: "Hello"}},
+		N:        3,
+	})
+	if err != nil {
+		t.Fatalf("chat error: %v", err)
+	}
+	if resp.Content != "first" {
+		t.Errorf("expected Content to mirror the first choice, got %q", resp.Content)
+	}
+	if len(resp.Contents) != 3 || resp.Contents[2] != "third" {
+		t.Errorf("expected all three choices, got %v", resp.Contents)
+	}
+}
+
 func TestOpenAIProviderNormalizesLegacyEndpoint(t *testing.T) {
 	p := testOpenAIProvider(
 		t,
@@ -0,0 +1,204 @@
+package llm
+
+import (
+	"bufio"
+	"encoding/json"
+	"fmt"
+	"os"
+	"sync"
+
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// Record/replay client pair for the benchmark harness.
+//
+// A Recorder wraps a live client and journals every completion it
+// returns to a JSON-lines file; a Replayer serves such a recording back
+// without any network dependency, so a checked-in campaign recording can
+// drive a deterministic end-to-end throughput benchmark (see
+// internal/fuzz/bench_replay_test.go).
+
+// replayEntry is one recorded LLM exchange. The method name is kept for
+// debugging recordings; replay is strictly sequential.
+type replayEntry struct {
+	Method    string   `json:"method"`
+	Responses []string `json:"responses"`
+}
+
+// Recorder wraps an LLM client and appends every successful completion
+// to a JSON-lines recording at path.
+type Recorder struct {
+	inner LLM
+	mu    sync.Mutex
+	file  *os.File
+}
+
+// NewRecorder creates a recorder writing to path, truncating any
+// existing recording.
+func NewRecorder(inner LLM, path string) (*Recorder, error) {
+	f, err := os.OpenFile(path, os.O_WRONLY|os.O_CREATE|os.O_TRUNC, 0644)
+	if err != nil {
+		return nil, fmt.Errorf("failed to create recording file: %w", err)
+	}
+	return &Recorder{inner: inner, file: f}, nil
+}
+
+// Close flushes and closes the recording file.
+func (r *Recorder) Close() error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	return r.file.Close()
+}
+
+func (r *Recorder) record(method string, responses []string) {
+	data, err := json.Marshal(replayEntry{Method: method, Responses: responses})
+	if err != nil {
+		return
+	}
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	r.file.Write(append(data, '\n'))
+}
+
+func (r *Recorder) GetCompletion(prompt string) (string, error) {
+	resp, err := r.inner.GetCompletion(prompt)
+	if err == nil {
+		r.record("GetCompletion", []string{resp})
+	}
+	return resp, err
+}
+
+func (r *Recorder) GetCompletionWithSystem(systemPrompt, userPrompt string) (string, error) {
+	resp, err := r.inner.GetCompletionWithSystem(systemPrompt, userPrompt)
+	if err == nil {
+		r.record("GetCompletionWithSystem", []string{resp})
+	}
+	return resp, err
+}
+
+func (r *Recorder) GetCompletionsWithSystem(systemPrompt, userPrompt string, n int) ([]string, error) {
+	resps, err := r.inner.GetCompletionsWithSystem(systemPrompt, userPrompt, n)
+	if err == nil {
+		r.record("GetCompletionsWithSystem", resps)
+	}
+	return resps, err
+}
+
+func (r *Recorder) Understand(prompt string) (string, error) {
+	resp, err := r.inner.Understand(prompt)
+	if err == nil {
+		r.record("Understand", []string{resp})
+	}
+	return resp, err
+}
+
+func (r *Recorder) Analyze(understanding, prompt string, s *seed.Seed, feedback string) (string, error) {
+	resp, err := r.inner.Analyze(understanding, prompt, s, feedback)
+	if err == nil {
+		r.record("Analyze", []string{resp})
+	}
+	return resp, err
+}
+
+// Generate and Mutate return structured seeds rather than raw
+// completions; the fuzzing loop only uses the completion methods, so
+// these pass through unrecorded.
+
+func (r *Recorder) Generate(understanding, prompt string) (*seed.Seed, error) {
+	return r.inner.Generate(understanding, prompt)
+}
+
+func (r *Recorder) Mutate(understanding, prompt string, s *seed.Seed) (*seed.Seed, error) {
+	return r.inner.Mutate(understanding, prompt, s)
+}
+
+// Replayer serves a recorded campaign's completions in order. When the
+// recording is exhausted it cycles back to the beginning, so a benchmark
+// can run more iterations than were recorded (repeats are then handled
+// by the engine's dedup index, same as a live campaign whose LLM repeats
+// itself).
+type Replayer struct {
+	mu      sync.Mutex
+	entries []replayEntry
+	pos     int
+}
+
+// NewReplayer loads a JSON-lines recording written by a Recorder.
+func NewReplayer(path string) (*Replayer, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open recording: %w", err)
+	}
+	defer f.Close()
+
+	var entries []replayEntry
+	scanner := bufio.NewScanner(f)
+	scanner.Buffer(make([]byte, 0, 64*1024), 4*1024*1024)
+	for scanner.Scan() {
+		line := scanner.Bytes()
+		if len(line) == 0 {
+			continue
+		}
+		var entry replayEntry
+		if err := json.Unmarshal(line, &entry); err != nil {
+			return nil, fmt.Errorf("malformed recording entry: %w", err)
+		}
+		entries = append(entries, entry)
+	}
+	if err := scanner.Err(); err != nil {
+		return nil, fmt.Errorf("failed to read recording: %w", err)
+	}
+	if len(entries) == 0 {
+		return nil, fmt.Errorf("recording %s contains no entries", path)
+	}
+	return &Replayer{entries: entries}, nil
+}
+
+// next serves the following entry's responses, padded or truncated to n.
+func (r *Replayer) next(n int) []string {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	entry := r.entries[r.pos%len(r.entries)]
+	r.pos++
+
+	out := append([]string(nil), entry.Responses...)
+	if len(out) == 0 {
+		out = []string{""}
+	}
+	for len(out) < n {
+		out = append(out, out[len(out)-1])
+	}
+	return out[:n]
+}
+
+func (r *Replayer) GetCompletion(prompt string) (string, error) {
+	return r.next(1)[0], nil
+}
+
+func (r *Replayer) GetCompletionWithSystem(systemPrompt, userPrompt string) (string, error) {
+	return r.next(1)[0], nil
+}
+
+func (r *Replayer) GetCompletionsWithSystem(systemPrompt, userPrompt string, n int) ([]string, error) {
+	if n < 1 {
+		n = 1
+	}
+	return r.next(n), nil
+}
+
+func (r *Replayer) Understand(prompt string) (string, error) {
+	return r.next(1)[0], nil
+}
+
+func (r *Replayer) Analyze(understanding, prompt string, s *seed.Seed, feedback string) (string, error) {
+	return r.next(1)[0], nil
+}
+
+func (r *Replayer) Generate(understanding, prompt string) (*seed.Seed, error) {
+	return nil, fmt.Errorf("replayer does not support Generate; recordings only cover completion calls")
+}
+
+func (r *Replayer) Mutate(understanding, prompt string, s *seed.Seed) (*seed.Seed, error) {
+	return nil, fmt.Errorf("replayer does not support Mutate; recordings only cover completion calls")
+}
@@ -0,0 +1,98 @@
+package llm
+
+import (
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+
+	"github.com/zjy-dev/de-fuzz/internal/seed"
+)
+
+// scriptedLLM returns canned completions for recording tests.
+type scriptedLLM struct {
+	calls int
+}
+
+func (s *scriptedLLM) response() string {
+	s.calls++
+	return "response-" + string(rune('0'+s.calls))
+}
+
+func (s *scriptedLLM) GetCompletion(prompt string) (string, error) { return s.response(), nil }
+func (s *scriptedLLM) GetCompletionWithSystem(sys, user string) (string, error) {
+	return s.response(), nil
+}
+func (s *scriptedLLM) GetCompletionsWithSystem(sys, user string, n int) ([]string, error) {
+	out := make([]string, n)
+	for i := range out {
+		out[i] = s.response()
+	}
+	return out, nil
+}
+func (s *scriptedLLM) Understand(prompt string) (string, error) { return s.response(), nil }
+func (s *scriptedLLM) Analyze(u, p string, sd *seed.Seed, f string) (string, error) {
+	return s.response(), nil
+}
+func (s *scriptedLLM) Generate(u, p string) (*seed.Seed, error)              { return nil, nil }
+func (s *scriptedLLM) Mutate(u, p string, sd *seed.Seed) (*seed.Seed, error) { return nil, nil }
+
+func TestRecorderReplayer_RoundTrip(t *testing.T) {
+	var _ LLM = &Recorder{}
+	var _ LLM = &Replayer{}
+
+	path := filepath.Join(t.TempDir(), "campaign.jsonl")
+	recorder, err := NewRecorder(&scriptedLLM{}, path)
+	require.NoError(t, err)
+
+	_, err = recorder.GetCompletionWithSystem("sys", "user")
+	require.NoError(t, err)
+	batch, err := recorder.GetCompletionsWithSystem("sys", "user", 2)
+	require.NoError(t, err)
+	require.Len(t, batch, 2)
+	require.NoError(t, recorder.Close())
+
+	replayer, err := NewReplayer(path)
+	require.NoError(t, err)
+
+	first, err := replayer.GetCompletionWithSystem("ignored", "ignored")
+	require.NoError(t, err)
+	assert.Equal(t, "response-1", first)
+
+	second, err := replayer.GetCompletionsWithSystem("ignored", "ignored", 2)
+	require.NoError(t, err)
+	assert.Equal(t, []string{"response-2", "response-3"}, second)
+
+	// The recording cycles once exhausted.
+	again, err := replayer.GetCompletion("ignored")
+	require.NoError(t, err)
+	assert.Equal(t, "response-1", again)
+}
+
+func TestReplayer_PadsShortEntries(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "campaign.jsonl")
+	recorder, err := NewRecorder(&scriptedLLM{}, path)
+	require.NoError(t, err)
+	_, err = recorder.GetCompletion("p")
+	require.NoError(t, err)
+	require.NoError(t, recorder.Close())
+
+	replayer, err := NewReplayer(path)
+	require.NoError(t, err)
+
+	// Asking for more samples than were recorded repeats the last one.
+	out, err := replayer.GetCompletionsWithSystem("s", "u", 3)
+	require.NoError(t, err)
+	assert.Equal(t, []string{"response-1", "response-1", "response-1"}, out)
+}
+
+func TestNewReplayer_EmptyRecording(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "empty.jsonl")
+	recorder, err := NewRecorder(&scriptedLLM{}, path)
+	require.NoError(t, err)
+	require.NoError(t, recorder.Close())
+
+	_, err = NewReplayer(path)
+	assert.Error(t, err)
+}
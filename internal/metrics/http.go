@@ -0,0 +1,21 @@
+package metrics
+
+import (
+	"net/http"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+// Serve exposes the default registry at /metrics on addr (e.g.
+// "127.0.0.1:9920") in the Prometheus text format. It blocks like
+// http.ListenAndServe; run it in a goroutine.
+func Serve(addr string) error {
+	mux := http.NewServeMux()
+	mux.HandleFunc("/metrics", func(w http.ResponseWriter, _ *http.Request) {
+		w.Header().Set("Content-Type", "text/plain; version=0.0.4; charset=utf-8")
+		if err := defaultRegistry.WriteText(w); err != nil {
+			logger.Warn("Metrics endpoint: failed to write exposition: %v", err)
+		}
+	})
+	return http.ListenAndServe(addr, mux)
+}
@@ -0,0 +1,248 @@
+// Package metrics aggregates hot-path instrumentation for the fuzzing
+// loop: per-stage duration histograms (LLM latency, compile, coverage,
+// oracle, divergence, state save) and monotonic counters (iterations,
+// target hits, compile-cache hits, corpus adds).
+//
+// It replaces the old "[TIMING] ..." debug log lines, which required
+// running at debug level and grep-based post-processing to answer "which
+// stage regressed". Metrics are aggregated in-process and exposed in two
+// ways: an optional HTTP endpoint in Prometheus text format (see Serve)
+// and a periodic one-line summary through the logger (see
+// StartSummaryLogger) for week-long campaigns watched via the log file.
+package metrics
+
+import (
+	"fmt"
+	"io"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+)
+
+// Stage names used by the engine. Centralized so the summary line and
+// dashboards agree on spelling.
+const (
+	StageLLM        = "llm"
+	StageCompile    = "compile"
+	StageCoverage   = "coverage"
+	StageOracle     = "oracle"
+	StageDivergence = "divergence"
+	StageStateSave  = "state_save"
+)
+
+// Counter names used by the engine.
+const (
+	CounterIterations        = "iterations"
+	CounterTargetHits        = "target_hits"
+	CounterCompileCacheHits  = "compile_cache_hits"
+	CounterCorpusAdds        = "corpus_adds"
+	CounterDedupHits         = "dedup_hits"
+	CounterSyntaxGateRejects = "syntax_gate_rejects"
+)
+
+// histogramBuckets are the upper bounds (in seconds) of the duration
+// histogram, spanning millisecond compiles to multi-minute LLM calls.
+var histogramBuckets = []float64{0.001, 0.005, 0.025, 0.1, 0.5, 1, 5, 25, 100, 600}
+
+// histogram is a fixed-bucket duration histogram.
+type histogram struct {
+	buckets []uint64 // one slot per bound plus a final +Inf slot
+	count   uint64
+	sum     float64 // seconds
+}
+
+func newHistogram() *histogram {
+	return &histogram{buckets: make([]uint64, len(histogramBuckets)+1)}
+}
+
+func (h *histogram) observe(seconds float64) {
+	idx := len(histogramBuckets)
+	for i, bound := range histogramBuckets {
+		if seconds <= bound {
+			idx = i
+			break
+		}
+	}
+	h.buckets[idx]++
+	h.count++
+	h.sum += seconds
+}
+
+// Registry aggregates stage histograms and counters. All methods are safe
+// for concurrent use; observation rates are per-iteration, so a single
+// mutex is cheap.
+type Registry struct {
+	mu       sync.Mutex
+	stages   map[string]*histogram
+	counters map[string]uint64
+}
+
+// NewRegistry creates an empty registry.
+func NewRegistry() *Registry {
+	return &Registry{
+		stages:   make(map[string]*histogram),
+		counters: make(map[string]uint64),
+	}
+}
+
+// ObserveStage records one duration sample for a pipeline stage.
+func (r *Registry) ObserveStage(stage string, d time.Duration) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	h, ok := r.stages[stage]
+	if !ok {
+		h = newHistogram()
+		r.stages[stage] = h
+	}
+	h.observe(d.Seconds())
+}
+
+// IncCounter increments a counter by one.
+func (r *Registry) IncCounter(name string) {
+	r.AddCounter(name, 1)
+}
+
+// AddCounter increments a counter by n.
+func (r *Registry) AddCounter(name string, n uint64) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	r.counters[name] += n
+}
+
+// WriteText renders the registry in the Prometheus text exposition format.
+func (r *Registry) WriteText(w io.Writer) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	if len(r.stages) > 0 {
+		fmt.Fprintln(w, "# HELP defuzz_stage_duration_seconds Time spent per fuzzing pipeline stage.")
+		fmt.Fprintln(w, "# TYPE defuzz_stage_duration_seconds histogram")
+		for _, stage := range sortedKeys(r.stages) {
+			h := r.stages[stage]
+			cumulative := uint64(0)
+			for i, bound := range histogramBuckets {
+				cumulative += h.buckets[i]
+				fmt.Fprintf(w, "defuzz_stage_duration_seconds_bucket{stage=%q,le=%q} %d\n",
+					stage, formatBound(bound), cumulative)
+			}
+			fmt.Fprintf(w, "defuzz_stage_duration_seconds_bucket{stage=%q,le=\"+Inf\"} %d\n", stage, h.count)
+			fmt.Fprintf(w, "defuzz_stage_duration_seconds_sum{stage=%q} %g\n", stage, h.sum)
+			fmt.Fprintf(w, "defuzz_stage_duration_seconds_count{stage=%q} %d\n", stage, h.count)
+		}
+	}
+
+	if len(r.counters) > 0 {
+		fmt.Fprintln(w, "# HELP defuzz_events_total Monotonic fuzzing event counters.")
+		fmt.Fprintln(w, "# TYPE defuzz_events_total counter")
+		for _, name := range sortedCounterKeys(r.counters) {
+			fmt.Fprintf(w, "defuzz_events_total{event=%q} %d\n", name, r.counters[name])
+		}
+	}
+
+	return nil
+}
+
+// Summary returns a one-line digest: every counter, then count and mean
+// duration per stage.
+func (r *Registry) Summary() string {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	var parts []string
+	for _, name := range sortedCounterKeys(r.counters) {
+		parts = append(parts, fmt.Sprintf("%s=%d", name, r.counters[name]))
+	}
+	for _, stage := range sortedKeys(r.stages) {
+		h := r.stages[stage]
+		mean := time.Duration(0)
+		if h.count > 0 {
+			mean = time.Duration(h.sum / float64(h.count) * float64(time.Second)).Round(time.Millisecond)
+		}
+		parts = append(parts, fmt.Sprintf("%s=%dx/avg %v", stage, h.count, mean))
+	}
+	if len(parts) == 0 {
+		return "no samples yet"
+	}
+	return strings.Join(parts, " ")
+}
+
+// StageStats returns the sample count and cumulative seconds recorded
+// for one stage; zeros when the stage has no samples yet. The benchmark
+// harness diffs these around a run to report per-stage timings.
+func (r *Registry) StageStats(stage string) (count uint64, totalSeconds float64) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	h, ok := r.stages[stage]
+	if !ok {
+		return 0, 0
+	}
+	return h.count, h.sum
+}
+
+func sortedKeys(m map[string]*histogram) []string {
+	keys := make([]string, 0, len(m))
+	for k := range m {
+		keys = append(keys, k)
+	}
+	sort.Strings(keys)
+	return keys
+}
+
+func sortedCounterKeys(m map[string]uint64) []string {
+	keys := make([]string, 0, len(m))
+	for k := range m {
+		keys = append(keys, k)
+	}
+	sort.Strings(keys)
+	return keys
+}
+
+// formatBound renders a bucket bound the way Prometheus expects (no
+// exponent notation for these magnitudes).
+func formatBound(bound float64) string {
+	return strings.TrimRight(strings.TrimRight(fmt.Sprintf("%.3f", bound), "0"), ".")
+}
+
+// defaultRegistry is the process-wide registry the engine records into.
+var defaultRegistry = NewRegistry()
+
+// Default returns the process-wide registry.
+func Default() *Registry {
+	return defaultRegistry
+}
+
+// ObserveStage records a duration sample on the default registry.
+func ObserveStage(stage string, d time.Duration) {
+	defaultRegistry.ObserveStage(stage, d)
+}
+
+// IncCounter increments a counter on the default registry.
+func IncCounter(name string) {
+	defaultRegistry.IncCounter(name)
+}
+
+// StageStats reads one stage's stats from the default registry.
+func StageStats(stage string) (count uint64, totalSeconds float64) {
+	return defaultRegistry.StageStats(stage)
+}
+
+// StartSummaryLogger emits the one-line summary through logf every
+// interval until the returned stop function is called.
+func StartSummaryLogger(interval time.Duration, logf func(format string, args ...interface{})) (stop func()) {
+	done := make(chan struct{})
+	go func() {
+		ticker := time.NewTicker(interval)
+		defer ticker.Stop()
+		for {
+			select {
+			case <-ticker.C:
+				logf("[METRICS] %s", defaultRegistry.Summary())
+			case <-done:
+				return
+			}
+		}
+	}()
+	var once sync.Once
+	return func() { once.Do(func() { close(done) }) }
+}
@@ -0,0 +1,84 @@
+package metrics
+
+import (
+	"strings"
+	"testing"
+	"time"
+)
+
+func TestRegistry_WriteText(t *testing.T) {
+	r := NewRegistry()
+	r.ObserveStage(StageCompile, 3*time.Millisecond)
+	r.ObserveStage(StageCompile, 2*time.Second)
+	r.ObserveStage(StageLLM, 8*time.Second)
+	r.IncCounter(CounterIterations)
+	r.IncCounter(CounterIterations)
+	r.IncCounter(CounterTargetHits)
+
+	var sb strings.Builder
+	if err := r.WriteText(&sb); err != nil {
+		t.Fatalf("WriteText() error = %v", err)
+	}
+	out := sb.String()
+
+	for _, want := range []string{
+		"# TYPE defuzz_stage_duration_seconds histogram",
+		`defuzz_stage_duration_seconds_bucket{stage="compile",le="0.005"} 1`,
+		`defuzz_stage_duration_seconds_bucket{stage="compile",le="5"} 2`,
+		`defuzz_stage_duration_seconds_bucket{stage="compile",le="+Inf"} 2`,
+		`defuzz_stage_duration_seconds_count{stage="compile"} 2`,
+		`defuzz_stage_duration_seconds_count{stage="llm"} 1`,
+		"# TYPE defuzz_events_total counter",
+		`defuzz_events_total{event="iterations"} 2`,
+		`defuzz_events_total{event="target_hits"} 1`,
+	} {
+		if !strings.Contains(out, want) {
+			t.Errorf("exposition missing %q:\n%s", want, out)
+		}
+	}
+}
+
+func TestRegistry_BucketsAreCumulative(t *testing.T) {
+	r := NewRegistry()
+	// One sample per bucket bound keeps the expected counts simple.
+	r.ObserveStage(StageOracle, 500*time.Microsecond) // <= 0.001
+	r.ObserveStage(StageOracle, 50*time.Millisecond)  // <= 0.1
+	r.ObserveStage(StageOracle, time.Hour)            // +Inf only
+
+	var sb strings.Builder
+	if err := r.WriteText(&sb); err != nil {
+		t.Fatalf("WriteText() error = %v", err)
+	}
+	out := sb.String()
+
+	for _, want := range []string{
+		`defuzz_stage_duration_seconds_bucket{stage="oracle",le="0.001"} 1`,
+		`defuzz_stage_duration_seconds_bucket{stage="oracle",le="0.025"} 1`,
+		`defuzz_stage_duration_seconds_bucket{stage="oracle",le="0.1"} 2`,
+		`defuzz_stage_duration_seconds_bucket{stage="oracle",le="600"} 2`,
+		`defuzz_stage_duration_seconds_bucket{stage="oracle",le="+Inf"} 3`,
+	} {
+		if !strings.Contains(out, want) {
+			t.Errorf("exposition missing %q:\n%s", want, out)
+		}
+	}
+}
+
+func TestRegistry_Summary(t *testing.T) {
+	r := NewRegistry()
+	if got := r.Summary(); got != "no samples yet" {
+		t.Errorf("empty Summary() = %q", got)
+	}
+
+	r.IncCounter(CounterIterations)
+	r.ObserveStage(StageCompile, 2*time.Second)
+	r.ObserveStage(StageCompile, 4*time.Second)
+
+	got := r.Summary()
+	if !strings.Contains(got, "iterations=1") {
+		t.Errorf("Summary() missing counter: %q", got)
+	}
+	if !strings.Contains(got, "compile=2x/avg 3s") {
+		t.Errorf("Summary() missing stage mean: %q", got)
+	}
+}
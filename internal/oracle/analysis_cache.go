@@ -0,0 +1,142 @@
+package oracle
+
+import (
+	"crypto/sha256"
+	"debug/elf"
+	"fmt"
+	"os"
+	"sync"
+)
+
+// analysis_cache.go holds the campaign-wide binary analysis cache.
+//
+// Each MechanismOracle.Analyze used to build a fresh BinaryInspector, so
+// every oracle re-run of the same binary re-parsed the ELF, and every
+// checker family re-ran its disassembly sweep (CheckContext.Cache only
+// memoizes within one Analyze). For fortify campaigns the disassembly
+// alone is a large share of oracle wall-clock. The cache here is keyed by
+// binary *content* hash, so:
+//   - re-running several mechanism oracles on one compiled binary shares
+//     one inspector (symbols, sections, GNU property, ...) and one decode
+//     of indirect branches / chk call sites;
+//   - a rebuilt binary at the same path gets a fresh entry, never stale
+//     analysis.
+
+// maxCachedAnalyses bounds the number of distinct binaries whose analysis
+// is retained. The working set in one fuzzing iteration is small (one
+// binary per flag profile); when the bound is hit the whole map is reset,
+// matching the trace-cache policy in internal/coverage.
+const maxCachedAnalyses = 16
+
+// binaryAnalysis memoizes the expensive derived views of one binary
+// content. The inspector itself caches each raw ELF facet on first
+// access; the fields below cache the disassembly passes layered on top.
+// All methods are safe for concurrent use.
+type binaryAnalysis struct {
+	inspector BinaryInspector
+
+	mu           sync.Mutex
+	branches     []IndirectBranch
+	branchesDone bool
+	chkSites     []FortifyChkCallSite
+	chkSitesErr  error
+	chkSitesDone bool
+}
+
+var (
+	analysisCacheMu sync.Mutex
+	analysisCache   map[string]*binaryAnalysis
+)
+
+// sharedBinaryAnalysis returns the cached analysis entry for the binary at
+// path, creating it on first sight of the content. When the file cannot be
+// read (mock paths in tests, races with cleanup) the returned analysis is
+// simply not shared — callers get the pre-cache behaviour.
+func sharedBinaryAnalysis(path string) *binaryAnalysis {
+	key, err := binaryAnalysisKey(path)
+	if err != nil {
+		return &binaryAnalysis{inspector: NewBinaryInspector(path)}
+	}
+
+	analysisCacheMu.Lock()
+	defer analysisCacheMu.Unlock()
+	if a, ok := analysisCache[key]; ok {
+		return a
+	}
+	if analysisCache == nil || len(analysisCache) >= maxCachedAnalyses {
+		analysisCache = make(map[string]*binaryAnalysis)
+	}
+	a := &binaryAnalysis{inspector: NewBinaryInspector(path)}
+	analysisCache[key] = a
+	return a
+}
+
+// binaryAnalysisKey hashes the binary content so a recompiled binary at
+// the same path never reuses stale analysis.
+func binaryAnalysisKey(path string) (string, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return "", err
+	}
+	sum := sha256.Sum256(data)
+	return fmt.Sprintf("%x", sum), nil
+}
+
+// indirectBranches memoizes EnumerateIndirectBranches for this binary
+// across checkers and across oracle re-runs. Callers must treat the
+// returned slice as read-only.
+func (a *binaryAnalysis) indirectBranches(machine elf.Machine, execs []ExecSection) []IndirectBranch {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	if !a.branchesDone {
+		a.branches = EnumerateIndirectBranches(machine, execs)
+		a.branchesDone = true
+	}
+	return a.branches
+}
+
+// fortifyChkCallSites memoizes FindFortifyChkCallSites the same way,
+// including its error (a binary that fails to scan once will fail the
+// same way on every re-run).
+func (a *binaryAnalysis) fortifyChkCallSites() ([]FortifyChkCallSite, error) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	if !a.chkSitesDone {
+		a.chkSites, a.chkSitesErr = FindFortifyChkCallSites(a.inspector)
+		a.chkSitesDone = true
+	}
+	return a.chkSites, a.chkSitesErr
+}
+
+// FortifyChkSitesCacheKey is the per-Analyze CheckContext.Cache slot used
+// as a fallback when no campaign-wide analysis entry is attached (unit
+// tests that build a CheckContext by hand).
+const FortifyChkSitesCacheKey = "oracle.fortify_disasm.chk_call_sites"
+
+// fortifyChkSitesCacheEntry pairs the scan result with its error for the
+// per-Analyze fallback cache.
+type fortifyChkSitesCacheEntry struct {
+	sites []FortifyChkCallSite
+	err   error
+}
+
+// CachedFortifyChkCallSites is the caching front for
+// FindFortifyChkCallSites. It prefers the campaign-wide per-binary cache,
+// falls back to the per-Analyze CheckContext cache, and degrades to a
+// direct scan when neither is available.
+func CachedFortifyChkCallSites(ctx *CheckContext) ([]FortifyChkCallSite, error) {
+	if ctx == nil {
+		return nil, fmt.Errorf("nil check context")
+	}
+	if ctx.analysis != nil {
+		return ctx.analysis.fortifyChkCallSites()
+	}
+	if v, ok := ctx.CacheGet(FortifyChkSitesCacheKey); ok {
+		if cached, ok := v.(fortifyChkSitesCacheEntry); ok {
+			return cached.sites, cached.err
+		}
+	}
+	sites, err := FindFortifyChkCallSites(ctx.Inspector)
+	ctx.CacheSet(FortifyChkSitesCacheKey, fortifyChkSitesCacheEntry{sites: sites, err: err})
+	return sites, err
+}
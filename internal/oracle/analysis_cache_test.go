@@ -0,0 +1,135 @@
+package oracle
+
+import (
+	"debug/elf"
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+// resetAnalysisCache empties the package-level cache so tests don't see
+// entries from earlier tests (or earlier sub-tests).
+func resetAnalysisCache() {
+	analysisCacheMu.Lock()
+	analysisCache = nil
+	analysisCacheMu.Unlock()
+}
+
+// TestSharedBinaryAnalysis_KeyedByContent asserts the cache identifies
+// binaries by content, not path: same bytes share an entry, a rewritten
+// binary gets a fresh one.
+func TestSharedBinaryAnalysis_KeyedByContent(t *testing.T) {
+	resetAnalysisCache()
+	dir := t.TempDir()
+
+	pathA := filepath.Join(dir, "a.bin")
+	pathB := filepath.Join(dir, "b.bin")
+	if err := os.WriteFile(pathA, []byte("same content"), 0755); err != nil {
+		t.Fatalf("setup: %v", err)
+	}
+	if err := os.WriteFile(pathB, []byte("same content"), 0755); err != nil {
+		t.Fatalf("setup: %v", err)
+	}
+
+	first := sharedBinaryAnalysis(pathA)
+	if sharedBinaryAnalysis(pathA) != first {
+		t.Error("re-analyzing the same binary should reuse the cache entry")
+	}
+	if sharedBinaryAnalysis(pathB) != first {
+		t.Error("identical content at a different path should share the entry")
+	}
+
+	// Recompile: same path, new content → new entry, no stale analysis.
+	if err := os.WriteFile(pathA, []byte("rebuilt content"), 0755); err != nil {
+		t.Fatalf("rewrite: %v", err)
+	}
+	if sharedBinaryAnalysis(pathA) == first {
+		t.Error("rewritten binary must get a fresh analysis entry")
+	}
+}
+
+// TestSharedBinaryAnalysis_UnreadablePathUncached asserts that mock paths
+// (the common case in unit tests) degrade to fresh, unshared analyses
+// instead of poisoning the cache.
+func TestSharedBinaryAnalysis_UnreadablePathUncached(t *testing.T) {
+	resetAnalysisCache()
+	a := sharedBinaryAnalysis("/no/such/binary/path")
+	b := sharedBinaryAnalysis("/no/such/binary/path")
+	if a == b {
+		t.Error("unreadable paths must not share cache entries")
+	}
+}
+
+// countingInspector wraps fakeInspector and counts Machine() calls, which
+// FindFortifyChkCallSites hits exactly once per scan.
+type countingInspector struct {
+	*fakeInspector
+	machineCalls int
+}
+
+func (c *countingInspector) Machine() (elf.Machine, error) {
+	c.machineCalls++
+	return c.fakeInspector.Machine()
+}
+
+// TestBinaryAnalysis_MemoizesChkSites asserts the fortify disasm scan
+// runs once per binary regardless of how many checkers (or re-runs)
+// request it.
+func TestBinaryAnalysis_MemoizesChkSites(t *testing.T) {
+	insp := &countingInspector{fakeInspector: &fakeInspector{
+		exists:  true,
+		isELF:   true,
+		machine: elf.EM_X86_64,
+		class:   elf.ELFCLASS64,
+	}}
+	a := &binaryAnalysis{inspector: insp}
+
+	for i := 0; i < 3; i++ {
+		if _, err := a.fortifyChkCallSites(); err != nil {
+			t.Fatalf("fortifyChkCallSites() failed: %v", err)
+		}
+	}
+	if insp.machineCalls != 1 {
+		t.Errorf("scan should run once, inspector.Machine called %d times", insp.machineCalls)
+	}
+}
+
+// TestBinaryAnalysis_MemoizesIndirectBranches asserts the decode runs
+// once: the second call returns the memoized branches even when handed no
+// sections at all.
+func TestBinaryAnalysis_MemoizesIndirectBranches(t *testing.T) {
+	// endbr64; call rax — one indirect call.
+	text := []byte{0xF3, 0x0F, 0x1E, 0xFA, 0xFF, 0xD0}
+	execs := []ExecSection{{Name: ".text", Addr: 0x1000, Data: text}}
+
+	a := &binaryAnalysis{inspector: &fakeInspector{exists: true, isELF: true}}
+	first := a.indirectBranches(elf.EM_X86_64, execs)
+	if len(first) != 1 || !first[0].IsCall {
+		t.Fatalf("expected one indirect call, got %+v", first)
+	}
+	second := a.indirectBranches(elf.EM_X86_64, nil)
+	if len(second) != 1 {
+		t.Error("second call should serve the memoized decode, not re-scan")
+	}
+}
+
+// TestCachedFortifyChkCallSites_FallsBackToAnalyzeCache covers the
+// hand-built CheckContext path (no campaign-wide entry attached).
+func TestCachedFortifyChkCallSites_FallsBackToAnalyzeCache(t *testing.T) {
+	insp := &countingInspector{fakeInspector: &fakeInspector{
+		exists:  true,
+		isELF:   true,
+		machine: elf.EM_X86_64,
+		class:   elf.ELFCLASS64,
+	}}
+	ctx := &CheckContext{Inspector: insp, Cache: make(map[string]any)}
+
+	for i := 0; i < 3; i++ {
+		if _, err := CachedFortifyChkCallSites(ctx); err != nil {
+			t.Fatalf("CachedFortifyChkCallSites() failed: %v", err)
+		}
+	}
+	if insp.machineCalls != 1 {
+		t.Errorf("per-Analyze fallback should memoize, inspector.Machine called %d times", insp.machineCalls)
+	}
+}
@@ -0,0 +1,173 @@
+package oracle
+
+import (
+	"golang.org/x/arch/arm64/arm64asm"
+)
+
+// arm64dasm.go is the AArch64 counterpart of x86dasm.go / walkSection:
+// native in-process decoding via `arm64asm` feeding the same
+// IndirectBranch / FortifyChkCallSite structures, so aarch64 campaigns
+// get the zero-subprocess analysis path instead of falling back to NA or
+// cross-objdump.
+//
+// AAPCS64 passes the chk dstlen argument (4th) in X3. Fixed-width 4-byte
+// encodings make the sweep trivial compared to x86: there is no prefix
+// handling and a decode failure advances exactly one instruction slot.
+//
+// MOVZ/MOVN/MOVK immediates are recovered from the raw encoding
+// (`Inst.Enc`) rather than the decoded arguments because arm64asm keeps
+// the ImmShift fields unexported.
+
+// arm64InsnLen is the fixed A64 instruction width.
+const arm64InsnLen = 4
+
+// arm64MovFields splits a MOVZ/MOVN/MOVK encoding into its fields:
+// sf[31] opc 100101 hw[22:21] imm16[20:5] Rd[4:0].
+func arm64MovFields(enc uint32) (rd int, imm16 uint64, shift uint, is64 bool) {
+	return int(enc & 0x1f), uint64((enc >> 5) & 0xffff), uint(((enc >> 21) & 3) * 16), enc>>31 == 1
+}
+
+// arm64IsBranch reports whether op changes control flow; any such
+// instruction invalidates the tracked X3 immediate (the def-use chain
+// crossed a basic block, same rule as lookbackRCXImm on x86).
+func arm64IsBranch(op arm64asm.Op) bool {
+	switch op {
+	case arm64asm.B, arm64asm.BL, arm64asm.BR, arm64asm.BLR, arm64asm.RET,
+		arm64asm.CBZ, arm64asm.CBNZ, arm64asm.TBZ, arm64asm.TBNZ:
+		return true
+	}
+	return false
+}
+
+// arm64WritesX3 reports whether a decoded instruction's destination
+// operands include X3/W3, for instructions not modelled by the immediate
+// tracker. Checking the first two args covers the load-pair forms.
+func arm64WritesX3(inst arm64asm.Inst) bool {
+	for i := 0; i < 2; i++ {
+		switch r := inst.Args[i].(type) {
+		case arm64asm.Reg:
+			if r == arm64asm.X3 || r == arm64asm.W3 {
+				return true
+			}
+		case arm64asm.RegSP:
+			if arm64asm.Reg(r) == arm64asm.X3 {
+				return true
+			}
+		}
+	}
+	return false
+}
+
+// walkSectionARM64 mirrors walkSection for AArch64: it sweeps the
+// section, tracks the last statically-known immediate in X3 and emits a
+// FortifyChkCallSite for every `bl` whose target is a chk PLT stub.
+func walkSectionARM64(sec ExecSection, funcs []FunctionSymbol, chkAddrs map[uint64]string, out *[]FortifyChkCallSite) {
+	// Tracked X3 value. MOVK merges into a known value; anything we do
+	// not model that writes X3, and every branch, resets it.
+	var x3val uint64
+	x3known := false
+
+	for off := 0; off+arm64InsnLen <= len(sec.Data); off += arm64InsnLen {
+		addr := sec.Addr + uint64(off)
+		inst, err := arm64asm.Decode(sec.Data[off : off+arm64InsnLen])
+		if err != nil {
+			x3known = false // inter-function padding / data islands
+			continue
+		}
+
+		switch inst.Op {
+		case arm64asm.MOVZ:
+			rd, imm16, shift, is64 := arm64MovFields(inst.Enc)
+			if rd == 3 {
+				x3val = imm16 << shift
+				_ = is64 // MOVZ zero-fills the rest either way
+				x3known = true
+			}
+		case arm64asm.MOVN:
+			rd, imm16, shift, is64 := arm64MovFields(inst.Enc)
+			if rd == 3 {
+				x3val = ^(imm16 << shift)
+				if !is64 {
+					x3val &= 0xffffffff
+				}
+				x3known = true
+			}
+		case arm64asm.MOVK:
+			rd, imm16, shift, _ := arm64MovFields(inst.Enc)
+			if rd == 3 {
+				if x3known {
+					x3val = (x3val &^ (uint64(0xffff) << shift)) | imm16<<shift
+				}
+				// An isolated MOVK over an unknown value stays unknown.
+			}
+		case arm64asm.BL:
+			if rel, ok := inst.Args[0].(arm64asm.PCRel); ok {
+				target := addr + uint64(rel)
+				if name, isChk := chkAddrs[target]; isChk {
+					site := FortifyChkCallSite{
+						SiteAddr:        addr,
+						Family:          chkSymbolFamilyName(name),
+						ChkSymbol:       name,
+						DstlenImmediate: -1,
+					}
+					if fn, ok := findEnclosingFunction(funcs, addr); ok {
+						site.CallerFunc = fn.Name
+					}
+					if x3known {
+						site.DstlenImmediate = int64(x3val)
+						if x3val == ^uint64(0) {
+							site.DstlenIsAllOnes = true
+						}
+					}
+					*out = append(*out, site)
+				}
+			}
+			x3known = false // the callee may clobber X3
+		default:
+			if arm64IsBranch(inst.Op) || arm64WritesX3(inst) {
+				x3known = false
+			}
+		}
+	}
+}
+
+// enumerateIndirectBranchesARM64 is the AArch64 backend for
+// EnumerateIndirectBranches: `blr`/`br` are the indirect forms, `bl`/`b`
+// resolve statically. The x86-specific Inst / NOTRACK fields stay at
+// their zero values.
+func enumerateIndirectBranchesARM64(execs []ExecSection) []IndirectBranch {
+	var out []IndirectBranch
+	for _, sec := range execs {
+		for off := 0; off+arm64InsnLen <= len(sec.Data); off += arm64InsnLen {
+			addr := sec.Addr + uint64(off)
+			inst, err := arm64asm.Decode(sec.Data[off : off+arm64InsnLen])
+			if err != nil {
+				continue
+			}
+			ib := IndirectBranch{
+				Section:    sec.Name,
+				Addr:       addr,
+				PrefixAddr: addr,
+				Length:     arm64InsnLen,
+			}
+			switch inst.Op {
+			case arm64asm.BLR:
+				ib.IsCall = true
+			case arm64asm.BR:
+				// Indirect jump; target unknown statically.
+			case arm64asm.BL, arm64asm.B:
+				rel, ok := inst.Args[0].(arm64asm.PCRel)
+				if !ok {
+					continue // b.cond carries a Cond first arg; skip like x86 Jcc
+				}
+				ib.IsCall = inst.Op == arm64asm.BL
+				ib.TargetKnown = true
+				ib.Target = addr + uint64(rel)
+			default:
+				continue
+			}
+			out = append(out, ib)
+		}
+	}
+	return out
+}
@@ -0,0 +1,96 @@
+package oracle
+
+import (
+	"encoding/binary"
+	"testing"
+)
+
+// a64 packs hand-assembled A64 words into little-endian bytes.
+func a64(words ...uint32) []byte {
+	out := make([]byte, 4*len(words))
+	for i, w := range words {
+		binary.LittleEndian.PutUint32(out[4*i:], w)
+	}
+	return out
+}
+
+func TestArm64MovFields(t *testing.T) {
+	// movz x3, #0x40
+	rd, imm16, shift, is64 := arm64MovFields(0xD2800803)
+	if rd != 3 || imm16 != 0x40 || shift != 0 || !is64 {
+		t.Fatalf("movz x3,#0x40: got rd=%d imm=%#x shift=%d is64=%v", rd, imm16, shift, is64)
+	}
+	// movk x3, #0x1, lsl #16
+	rd, imm16, shift, is64 = arm64MovFields(0xF2A00023)
+	if rd != 3 || imm16 != 0x1 || shift != 16 || !is64 {
+		t.Fatalf("movk x3,#1,lsl#16: got rd=%d imm=%#x shift=%d is64=%v", rd, imm16, shift, is64)
+	}
+}
+
+func TestWalkSectionARM64_RecoversDstlen(t *testing.T) {
+	// movz x3, #0x40 ; bl 0x100
+	sec := ExecSection{
+		Name: ".text",
+		Addr: 0,
+		Data: a64(0xD2800803, 0x94000000|((0x100-0x4)/4)),
+	}
+	funcs := []FunctionSymbol{{Name: "main", Addr: 0, Size: 0x8}}
+	chk := map[uint64]string{0x100: "__memcpy_chk"}
+
+	var sites []FortifyChkCallSite
+	walkSectionARM64(sec, funcs, chk, &sites)
+
+	if len(sites) != 1 {
+		t.Fatalf("expected 1 site, got %d", len(sites))
+	}
+	s := sites[0]
+	if s.Family != "memcpy" || s.CallerFunc != "main" || s.SiteAddr != 0x4 {
+		t.Fatalf("unexpected site: %+v", s)
+	}
+	if s.DstlenImmediate != 0x40 || s.DstlenIsAllOnes {
+		t.Fatalf("expected dstlen 0x40, got %d (allOnes=%v)", s.DstlenImmediate, s.DstlenIsAllOnes)
+	}
+}
+
+func TestWalkSectionARM64_AllOnesSentinel(t *testing.T) {
+	// movn x3, #0x0 ; bl 0x100   — the (size_t)-1 BOS-fallback shape.
+	sec := ExecSection{
+		Name: ".text",
+		Addr: 0,
+		Data: a64(0x92800003, 0x94000000|((0x100-0x4)/4)),
+	}
+	chk := map[uint64]string{0x100: "__snprintf_chk"}
+
+	var sites []FortifyChkCallSite
+	walkSectionARM64(sec, nil, chk, &sites)
+
+	if len(sites) != 1 {
+		t.Fatalf("expected 1 site, got %d", len(sites))
+	}
+	if !sites[0].DstlenIsAllOnes || sites[0].DstlenImmediate != -1 {
+		t.Fatalf("expected all-ones sentinel, got %+v", sites[0])
+	}
+}
+
+func TestEnumerateIndirectBranchesARM64(t *testing.T) {
+	// blr x1 ; br x2 ; ret ; b 0x100
+	sec := ExecSection{
+		Name: ".text",
+		Addr: 0,
+		Data: a64(0xD63F0020, 0xD61F0040, 0xD65F03C0, 0x14000000|((0x100-0xC)/4)),
+	}
+	branches := enumerateIndirectBranchesARM64([]ExecSection{sec})
+
+	if len(branches) != 3 {
+		t.Fatalf("expected 3 branches (blr, br, b), got %d: %+v", len(branches), branches)
+	}
+	if !branches[0].IsCall || branches[0].TargetKnown {
+		t.Errorf("blr should be an indirect call: %+v", branches[0])
+	}
+	if branches[1].IsCall || branches[1].TargetKnown {
+		t.Errorf("br should be an indirect jump: %+v", branches[1])
+	}
+	if branches[2].IsCall || !branches[2].TargetKnown || branches[2].Target != 0x100 {
+		t.Errorf("b should resolve to 0x100: %+v", branches[2])
+	}
+}
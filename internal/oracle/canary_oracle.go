@@ -18,6 +18,12 @@ const (
 	ExitCodeSIGABRT = 128 + 6  // 134 - Abort (canary check failed)
 	ExitCodeSIGBUS  = 128 + 7  // 135 - Bus error (unaligned ret address)
 
+	// DefaultParallelProbes is the default wave width for the dynamic
+	// buffer search. Probes are independent executions of the same binary,
+	// so a wave of 8 turns the ~12-probe sequential binary search into two
+	// rounds — a large win when each probe is a ~100ms QEMU run.
+	DefaultParallelProbes = 8
+
 	// SentinelMarker is printed by the function template after seed() returns.
 	// If this marker is present in stdout when SIGSEGV occurs, it indicates
 	// a true canary bypass (crash on function return). If absent, the crash
@@ -40,6 +46,10 @@ type CanaryOracle struct {
 	// DefaultBufSize is passed as argv[1] to every probe (the buf_size
 	// parameter in the seed template, see `docs/oracles/canary-oracle.md` §"函数模板").
 	DefaultBufSize int
+	// ParallelProbes is the wave width for the dynamic buffer search
+	// (see DynamicBufferSearchChecker.ParallelProbes); <= 1 keeps the
+	// sequential binary search.
+	ParallelProbes int
 }
 
 // NewCanaryOracle creates a new canary-detection oracle from a YAML options
@@ -47,9 +57,11 @@ type CanaryOracle struct {
 //
 //	max_buffer_size:  int  (default DefaultMaxBufferSize)
 //	default_buf_size: int  (default 64)
+//	parallel_probes:  int  (default DefaultParallelProbes; 1 = sequential)
 func NewCanaryOracle(options map[string]interface{}, l llm.LLM, prompter *prompt.Builder, context string) (Oracle, error) {
 	maxSize := DefaultMaxBufferSize
 	bufSize := 64
+	probes := DefaultParallelProbes
 
 	if options != nil {
 		if v, ok := options["max_buffer_size"]; ok {
@@ -68,11 +80,20 @@ func NewCanaryOracle(options map[string]interface{}, l llm.LLM, prompter *prompt
 				bufSize = int(val)
 			}
 		}
+		if v, ok := options["parallel_probes"]; ok {
+			switch val := v.(type) {
+			case int:
+				probes = val
+			case float64:
+				probes = int(val)
+			}
+		}
 	}
 
 	return &CanaryOracle{
 		MaxBufferSize:  maxSize,
 		DefaultBufSize: bufSize,
+		ParallelProbes: probes,
 	}, nil
 }
 
@@ -127,6 +148,7 @@ func (o *CanaryOracle) mechanism() *MechanismOracle {
 				MaxFillSize:    o.MaxBufferSize,
 				DefaultBufSize: o.DefaultBufSize,
 				SentinelMarker: SentinelMarker,
+				ParallelProbes: o.ParallelProbes,
 			},
 			// Dynamic (single scrub probe; cheap relative to binary search).
 			// INV-SP-S02: epilogue must clobber registers that transiently
@@ -185,6 +207,7 @@ func (o *CanaryOracle) binarySearchCrash(ctx *AnalyzeContext) (int, int, bool) {
 		MaxFillSize:    o.MaxBufferSize,
 		DefaultBufSize: o.DefaultBufSize,
 		SentinelMarker: SentinelMarker,
+		ParallelProbes: o.ParallelProbes,
 	}
 	cctx := &CheckContext{
 		BinaryPath: ctx.BinaryPath,
@@ -3,6 +3,7 @@ package oracle
 import (
 	"fmt"
 	"strings"
+	"sync"
 )
 
 // DynamicBufferSearchChecker implements the dynamic-execution invariants
@@ -37,6 +38,14 @@ type DynamicBufferSearchChecker struct {
 	// "seed() crashed internally" (likely false positive due to spill
 	// corruption). See `docs/oracles/canary-oracle.md` §"假阳性修复".
 	SentinelMarker string
+
+	// ParallelProbes enables wave-based searching: each iteration launches
+	// up to this many probes concurrently at evenly spaced fill sizes, then
+	// narrows to the first crashing interval. Values <= 1 keep the
+	// sequential binary search. Probes are independent read-only executions
+	// of the same binary, so concurrency is safe; with QEMU cross-arch
+	// execution this collapses ~12 sequential probes into a couple of waves.
+	ParallelProbes int
 }
 
 // dynamicSearchResult is the cached fact set produced by a single binary
@@ -69,6 +78,11 @@ func (c *DynamicBufferSearchChecker) ID() string {
 // the canonical example of "needs to run the binary".
 func (c *DynamicBufferSearchChecker) Category() InvariantCategory { return CategoryDynamic }
 
+// ProducesSharedResult implements SharedResultProducer: this checker seeds
+// `dynamicSearchCacheKey` for the L02/L03/L04/V02 consumers, so the
+// parallel scheduler must run it before the rest of the dynamic wave.
+func (c *DynamicBufferSearchChecker) ProducesSharedResult() bool { return true }
+
 // Check implements InvariantChecker.
 //
 // Verdict mapping (positive build):
@@ -184,6 +198,10 @@ func (c *DynamicBufferSearchChecker) runOrLoadSearch(ctx *CheckContext) *dynamic
 //
 // Probes count is reported in the result for diagnostics.
 func (c *DynamicBufferSearchChecker) binarySearchCrash(ctx *CheckContext) *dynamicSearchResult {
+	if c.ParallelProbes > 1 {
+		return c.waveSearchCrash(ctx)
+	}
+
 	res := &dynamicSearchResult{MinCrashSize: -1}
 
 	L, R := 0, c.MaxFillSize
@@ -211,18 +229,137 @@ func (c *DynamicBufferSearchChecker) binarySearchCrash(ctx *CheckContext) *dynam
 	}
 
 	// Re-verify at the found boundary.
-	if res.MinCrashSize >= 0 {
-		exitCode, stdout, _, err := ctx.Executor.ExecuteWithArgs(
-			ctx.BinaryPath,
-			fmt.Sprintf("%d", c.DefaultBufSize),
-			fmt.Sprintf("%d", res.MinCrashSize),
-		)
-		res.Probes++
-		if err == nil && exitCode != 0 {
-			res.CrashExitCode = exitCode
-			res.HasSentinel = strings.Contains(stdout, c.SentinelMarker)
+	c.reverifyBoundary(ctx, res)
+
+	return res
+}
+
+// probeOutcome is one fill-size execution observed during a wave.
+type probeOutcome struct {
+	fillSize int
+	exitCode int
+	stdout   string
+	err      error
+}
+
+// crashed reports whether the probe observed a crash. Execution errors are
+// treated as "no crash, try larger", matching the sequential search.
+func (p *probeOutcome) crashed() bool {
+	return p.err == nil && p.exitCode != 0
+}
+
+// waveSearchCrash is the concurrent variant of binarySearchCrash. Each
+// iteration probes up to ParallelProbes evenly spaced fill sizes in parallel
+// and narrows the search window to the interval around the smallest crashing
+// probe. Under the same monotonicity assumption as the binary search it finds
+// the same minimal crash size, but in O(log_k n) waves instead of O(log_2 n)
+// sequential executions.
+func (c *DynamicBufferSearchChecker) waveSearchCrash(ctx *CheckContext) *dynamicSearchResult {
+	res := &dynamicSearchResult{MinCrashSize: -1}
+
+	L, R := 0, c.MaxFillSize
+	for L <= R {
+		points := wavePoints(L, R, c.ParallelProbes)
+		outcomes := c.probeWave(ctx, points)
+		res.Probes += len(points)
+
+		crashIdx := -1
+		for i := range outcomes {
+			if outcomes[i].crashed() {
+				crashIdx = i
+				break
+			}
+		}
+
+		if crashIdx < 0 {
+			// Nothing crashed: everything at or below the last probe point
+			// is clear, continue above it.
+			L = points[len(points)-1] + 1
+			continue
+		}
+
+		hit := &outcomes[crashIdx]
+		res.MinCrashSize = hit.fillSize
+		res.CrashExitCode = hit.exitCode
+		res.HasSentinel = strings.Contains(hit.stdout, c.SentinelMarker)
+
+		// Narrow to the gap between the last clear probe and the crash.
+		if crashIdx > 0 {
+			L = outcomes[crashIdx-1].fillSize + 1
 		}
+		R = hit.fillSize - 1
 	}
 
+	c.reverifyBoundary(ctx, res)
+
 	return res
 }
+
+// wavePoints picks up to k evenly spaced probe points in [lo, hi], always
+// including hi so an all-clear wave can discharge the whole window. When the
+// window has at most k values every point is probed and one wave suffices.
+func wavePoints(lo, hi, k int) []int {
+	n := hi - lo + 1
+	if n <= k {
+		points := make([]int, 0, n)
+		for v := lo; v <= hi; v++ {
+			points = append(points, v)
+		}
+		return points
+	}
+
+	points := make([]int, 0, k)
+	prev := lo - 1
+	for i := 1; i <= k; i++ {
+		p := lo + i*n/(k+1)
+		if i == k {
+			p = hi
+		}
+		if p <= prev {
+			p = prev + 1
+		}
+		points = append(points, p)
+		prev = p
+	}
+	return points
+}
+
+// probeWave executes one probe per point concurrently and returns outcomes
+// in the same (ascending fill-size) order.
+func (c *DynamicBufferSearchChecker) probeWave(ctx *CheckContext, points []int) []probeOutcome {
+	outcomes := make([]probeOutcome, len(points))
+	var wg sync.WaitGroup
+	for i, fillSize := range points {
+		wg.Add(1)
+		go func(i, fillSize int) {
+			defer wg.Done()
+			exitCode, stdout, _, err := ctx.Executor.ExecuteWithArgs(
+				ctx.BinaryPath,
+				fmt.Sprintf("%d", c.DefaultBufSize),
+				fmt.Sprintf("%d", fillSize),
+			)
+			outcomes[i] = probeOutcome{fillSize: fillSize, exitCode: exitCode, stdout: stdout, err: err}
+		}(i, fillSize)
+	}
+	wg.Wait()
+	return outcomes
+}
+
+// reverifyBoundary re-executes at the found minimal crash size to refresh
+// exit code and sentinel presence (the search may have transiently observed
+// a different exit due to flakiness near the boundary).
+func (c *DynamicBufferSearchChecker) reverifyBoundary(ctx *CheckContext, res *dynamicSearchResult) {
+	if res.MinCrashSize < 0 {
+		return
+	}
+	exitCode, stdout, _, err := ctx.Executor.ExecuteWithArgs(
+		ctx.BinaryPath,
+		fmt.Sprintf("%d", c.DefaultBufSize),
+		fmt.Sprintf("%d", res.MinCrashSize),
+	)
+	res.Probes++
+	if err == nil && exitCode != 0 {
+		res.CrashExitCode = exitCode
+		res.HasSentinel = strings.Contains(stdout, c.SentinelMarker)
+	}
+}
@@ -135,6 +135,85 @@ func TestDynamicBufferSearchChecker_MaxFillSizeError(t *testing.T) {
 	}
 }
 
+// TestDynamicBufferSearchChecker_WaveSearchMatchesBinary: the parallel wave
+// search must find the same minimal crash size as the sequential binary
+// search for a monotonic crash boundary.
+func TestDynamicBufferSearchChecker_WaveSearchMatchesBinary(t *testing.T) {
+	for _, threshold := range []int{1, 37, 64, 100, 199, 200} {
+		c := &DynamicBufferSearchChecker{
+			MaxFillSize: 200, DefaultBufSize: 64, SentinelMarker: SentinelMarker,
+			InvariantID: "INV-X", MechanismLabel: "Mech",
+			ParallelProbes: 8,
+		}
+		ctx := &CheckContext{
+			BinaryPath: "/fake/binary",
+			Executor: &MockExecutor{
+				CrashThreshold: threshold, CrashExitCode: ExitCodeSIGSEGV, ReturnSentinel: true,
+			},
+		}
+		dyn := c.binarySearchCrash(ctx)
+		if dyn.MinCrashSize != threshold {
+			t.Errorf("threshold %d: wave search found %d", threshold, dyn.MinCrashSize)
+		}
+		if dyn.CrashExitCode != ExitCodeSIGSEGV {
+			t.Errorf("threshold %d: exit code = %d, want %d", threshold, dyn.CrashExitCode, ExitCodeSIGSEGV)
+		}
+		if !dyn.HasSentinel {
+			t.Errorf("threshold %d: expected sentinel", threshold)
+		}
+	}
+}
+
+// TestDynamicBufferSearchChecker_WaveSearchNoCrash: an all-clear range must
+// report -1 just like the sequential search.
+func TestDynamicBufferSearchChecker_WaveSearchNoCrash(t *testing.T) {
+	c := &DynamicBufferSearchChecker{
+		MaxFillSize: 100, DefaultBufSize: 64, SentinelMarker: SentinelMarker,
+		InvariantID: "INV-X", MechanismLabel: "Mech",
+		ParallelProbes: 4,
+	}
+	ctx := &CheckContext{
+		BinaryPath: "/fake/binary",
+		Executor:   &MockExecutor{CrashThreshold: 0},
+	}
+	dyn := c.binarySearchCrash(ctx)
+	if dyn.MinCrashSize != -1 {
+		t.Errorf("MinCrashSize = %d, want -1", dyn.MinCrashSize)
+	}
+}
+
+// TestWavePoints: probe points must be ascending, within range, include the
+// upper bound, and enumerate every value when the window fits in one wave.
+func TestWavePoints(t *testing.T) {
+	points := wavePoints(0, 4096, 8)
+	if len(points) != 8 {
+		t.Fatalf("len(points) = %d, want 8", len(points))
+	}
+	for i, p := range points {
+		if p < 0 || p > 4096 {
+			t.Errorf("points[%d] = %d out of range", i, p)
+		}
+		if i > 0 && p <= points[i-1] {
+			t.Errorf("points not strictly ascending at %d: %v", i, points)
+		}
+	}
+	if points[len(points)-1] != 4096 {
+		t.Errorf("last point = %d, want upper bound 4096", points[len(points)-1])
+	}
+
+	// Small window: every value probed.
+	points = wavePoints(10, 13, 8)
+	want := []int{10, 11, 12, 13}
+	if len(points) != len(want) {
+		t.Fatalf("small window points = %v, want %v", points, want)
+	}
+	for i := range want {
+		if points[i] != want[i] {
+			t.Fatalf("small window points = %v, want %v", points, want)
+		}
+	}
+}
+
 // countingExecutor wraps another Executor and counts ExecuteWithArgs calls.
 type countingExecutor struct {
 	inner  Executor
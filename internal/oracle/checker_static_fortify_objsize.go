@@ -244,7 +244,7 @@ func loadFortifyCallSites(ctx *CheckContext, r *InvariantResult) ([]FortifyChkCa
 			"FORTIFY disasm backend not implemented for (machine=%s, class=%s); only x86_64 today",
 			machine, class)
 	}
-	sites, err := FindFortifyChkCallSites(ctx.Inspector)
+	sites, err := CachedFortifyChkCallSites(ctx)
 	if err != nil {
 		return nil, naOrError(err), fmt.Sprintf("disasm scan failed: %v", err)
 	}
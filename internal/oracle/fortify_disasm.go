@@ -28,7 +28,7 @@ type FortifyChkCallSite struct {
 	// DstlenImmediate is the BOS / BDOS-supplied destination size that
 	// the wrapper put into the chk-arg register before the call. -1
 	// means the static recovery failed (non-constant load, indirect
-	// register, control-flow merge, or a non-x86 binary).
+	// register, control-flow merge, or an unsupported architecture).
 	DstlenImmediate int64
 	// DstlenIsAllOnes is true when the recovered immediate is the
 	// `(size_t)-1` sentinel value that signals BOS-fallback (the
@@ -37,15 +37,16 @@ type FortifyChkCallSite struct {
 }
 
 // SupportsFortifyDisasm reports whether the (machine, class) pair has a
-// disassembly backend wired up for FORTIFY checkers. Today only x86_64
-// is supported — aarch64 / riscv64 / loongarch64 take the NA path with a
-// reason that mentions the missing backend.
+// disassembly backend wired up for FORTIFY checkers: x86_64
+// (walkSection), aarch64 (walkSectionARM64), riscv64 (walkSectionRISCV64)
+// and loongarch64 (walkSectionLoong64). Everything else takes the NA path
+// with a reason that mentions the missing backend.
 //
 // This is the single switch the static checkers consult before calling
 // `FindFortifyChkCallSites`.
 func SupportsFortifyDisasm(machine elf.Machine, class elf.Class) bool {
 	switch machine {
-	case elf.EM_X86_64:
+	case elf.EM_X86_64, elf.EM_AARCH64, elf.EM_RISCV, elf.EM_LOONGARCH:
 		return class == elf.ELFCLASS64
 	default:
 		return false
@@ -113,7 +114,16 @@ func FindFortifyChkCallSites(inspector BinaryInspector) ([]FortifyChkCallSite, e
 
 	var out []FortifyChkCallSite
 	for _, sec := range execs {
-		walkSection(sec, funcs, chkAddrToName, &out)
+		switch machine {
+		case elf.EM_AARCH64:
+			walkSectionARM64(sec, funcs, chkAddrToName, &out)
+		case elf.EM_RISCV:
+			walkSectionRISCV64(sec, funcs, chkAddrToName, &out)
+		case elf.EM_LOONGARCH:
+			walkSectionLoong64(sec, funcs, chkAddrToName, &out)
+		default:
+			walkSection(sec, funcs, chkAddrToName, &out)
+		}
 	}
 	return out, nil
 }
@@ -103,8 +103,10 @@ func TestErrWarnChkChecker_NAWhenNoBareCall(t *testing.T) {
 	}
 }
 
-// TestObjsizeChecker_NAOnNonX64: O01/O02/O03 short-circuit on non-x86_64.
-func TestObjsizeChecker_NAOnNonX64(t *testing.T) {
+// TestObjsizeChecker_NAOnUnsupportedArch: O01/O02/O03 short-circuit on
+// machines without a disasm backend (x86_64 / aarch64 / riscv64 /
+// loongarch64 all have one now).
+func TestObjsizeChecker_NAOnUnsupportedArch(t *testing.T) {
 	cases := []InvariantChecker{
 		&LastMemberObjectSizeChecker{},
 		&CountedByObjectSizeChecker{},
@@ -113,13 +115,13 @@ func TestObjsizeChecker_NAOnNonX64(t *testing.T) {
 	ctx := &CheckContext{
 		Inspector: &fakeInspector{
 			exists: true, isELF: true,
-			machine: elf.EM_AARCH64, class: elf.ELFCLASS64,
+			machine: elf.EM_MIPS, class: elf.ELFCLASS64,
 		},
 	}
 	for _, c := range cases {
 		r := c.Check(ctx)
 		if r.Verdict != VerdictNotApplicable {
-			t.Errorf("%s expected NA on aarch64, got %s (reason=%s)", c.ID(), r.Verdict, r.Reason)
+			t.Errorf("%s expected NA on mips, got %s (reason=%s)", c.ID(), r.Verdict, r.Reason)
 		}
 	}
 }
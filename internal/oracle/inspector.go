@@ -1,21 +1,29 @@
 package oracle
 
 import (
+	"bytes"
 	"debug/elf"
 	"errors"
 	"fmt"
 	"os"
+	"runtime"
 	"sort"
 	"strings"
 	"sync"
+	"syscall"
 )
 
 // BinaryInspector is the read-only view of a compiled binary used by static
 // invariant checkers. It is intentionally minimal so multiple ELF / Mach-O /
 // PE backends can implement the same surface; today only ELF is supported.
 //
-// All methods are safe for concurrent use; underlying ELF parsing is done
-// once on the first call and cached.
+// All methods are safe for concurrent use. The binary is mapped (not read)
+// on first use and each facet — symbols, sections, relocations, GNU
+// property, EH landing pads — is decoded lazily on its first access, so an
+// oracle that only checks GNUProperty never pays for symbol tables or
+// section snapshots. Returned section byte slices view the mapping and
+// stay valid as long as the inspector is reachable; callers must treat
+// them as read-only and must not retain them past the inspector.
 type BinaryInspector interface {
 	// Path returns the binary file path the inspector was constructed with.
 	Path() string
@@ -184,49 +192,86 @@ func NewBinaryInspector(path string) BinaryInspector {
 //   - cross-host portability is preserved (no GNU binutils required);
 //   - tests can run hermetically with a temp ELF file;
 //   - error semantics are explicit Go errors instead of stderr scraping.
+//
+// The file is mmapped once and every facet is decoded independently on
+// first use. Fortify binaries with static libc run to tens of MB; eagerly
+// materializing symbols, section bytes, relocations and EH tables for an
+// oracle that touches one facet showed up in both latency and RSS when
+// oracles run per seed.
 type elfInspector struct {
 	path string
 
-	once     sync.Once
+	// openOnce stats and maps the file and parses the ELF header; every
+	// facet below gates on it through ready().
+	openOnce sync.Once
 	exists   bool
 	isELF    bool
+	machine  elf.Machine
+	class    elf.Class
+	data     []byte    // raw file bytes (mmap-backed when possible)
+	mapped   bool      // data needs munmap on release
+	f        *elf.File // parsed over data; nil unless isELF
+
+	// Symbol tables: one facet, since .symtab/.dynsym are walked together.
+	symOnce  sync.Once
 	syms     []string
 	imps     []string
 	funcs    []FunctionSymbol
 	extFuncs []ExtendedFunctionSymbol
-	execs    []ExecSection
-	rodata   []DataSection
-	relocs   []Relocation
-	ifuncs   []FunctionSymbol
+	symErr   error
+
+	// Section bytes (executable + read-only allocated), viewing the mapping.
+	secOnce sync.Once
+	execs   []ExecSection
+	rodata  []DataSection
+	secErr  error
+
+	// Relocation tables and derived IFUNC resolvers.
+	relocOnce sync.Once
+	relocs    []Relocation
+	ifuncs    []FunctionSymbol
+
+	// .note.gnu.property feature bits.
+	propOnce sync.Once
 	gnuProp  uint32
-	ehLPs    []uint64
-	machine  elf.Machine
-	class    elf.Class
-	parseErr error
+
+	// EH landing pads from .eh_frame / LSDA.
+	ehOnce sync.Once
+	ehLPs  []uint64
 }
 
 func (e *elfInspector) Path() string { return e.path }
 
 func (e *elfInspector) Exists() bool {
-	e.parseOnce()
+	e.open()
 	return e.exists
 }
 
 func (e *elfInspector) IsELF() bool {
-	e.parseOnce()
+	e.open()
 	return e.isELF
 }
 
-func (e *elfInspector) Symbols() ([]string, error) {
-	e.parseOnce()
+// ready maps and header-parses the binary, translating the missing/non-ELF
+// states into the sentinel errors every facet accessor must surface.
+func (e *elfInspector) ready() error {
+	e.open()
 	if !e.exists {
-		return nil, ErrBinaryMissing
+		return ErrBinaryMissing
 	}
 	if !e.isELF {
-		return nil, ErrNotELF
+		return ErrNotELF
+	}
+	return nil
+}
+
+func (e *elfInspector) Symbols() ([]string, error) {
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	e.loadSymbols()
+	if e.symErr != nil {
+		return nil, e.symErr
 	}
 	// Defensive copy so callers can't mutate the cached slice.
 	out := make([]string, len(e.syms))
@@ -248,15 +293,12 @@ func (e *elfInspector) HasSymbol(name string) (bool, error) {
 }
 
 func (e *elfInspector) ImportedFunctions() ([]string, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
-	if !e.isELF {
-		return nil, ErrNotELF
-	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	e.loadSymbols()
+	if e.symErr != nil {
+		return nil, e.symErr
 	}
 	out := make([]string, len(e.imps))
 	copy(out, e.imps)
@@ -264,15 +306,12 @@ func (e *elfInspector) ImportedFunctions() ([]string, error) {
 }
 
 func (e *elfInspector) FunctionSymbols() ([]FunctionSymbol, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	e.loadSymbols()
+	if e.symErr != nil {
+		return nil, e.symErr
 	}
 	out := make([]FunctionSymbol, len(e.funcs))
 	copy(out, e.funcs)
@@ -280,56 +319,41 @@ func (e *elfInspector) FunctionSymbols() ([]FunctionSymbol, error) {
 }
 
 func (e *elfInspector) ExecutableSections() ([]ExecSection, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	e.loadSections()
+	if e.secErr != nil {
+		return nil, e.secErr
 	}
-	// Defensive copy of the slice header; the underlying byte buffers are
-	// shared (immutable in practice — debug/elf returned freshly-allocated
-	// slices in parseOnce, and callers must treat them as read-only).
+	// Defensive copy of the slice header; the underlying byte buffers view
+	// the file mapping and callers must treat them as read-only.
 	out := make([]ExecSection, len(e.execs))
 	copy(out, e.execs)
 	return out, nil
 }
 
 func (e *elfInspector) Machine() (elf.Machine, error) {
-	e.parseOnce()
-	if !e.exists {
-		return 0, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return 0, ErrNotELF
+	if err := e.ready(); err != nil {
+		return 0, err
 	}
 	return e.machine, nil
 }
 
 func (e *elfInspector) Class() (elf.Class, error) {
-	e.parseOnce()
-	if !e.exists {
-		return 0, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return 0, ErrNotELF
+	if err := e.ready(); err != nil {
+		return 0, err
 	}
 	return e.class, nil
 }
 
 func (e *elfInspector) ExtendedFunctionSymbols() ([]ExtendedFunctionSymbol, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	e.loadSymbols()
+	if e.symErr != nil {
+		return nil, e.symErr
 	}
 	out := make([]ExtendedFunctionSymbol, len(e.extFuncs))
 	copy(out, e.extFuncs)
@@ -337,15 +361,12 @@ func (e *elfInspector) ExtendedFunctionSymbols() ([]ExtendedFunctionSymbol, erro
 }
 
 func (e *elfInspector) ReadOnlySections() ([]DataSection, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	e.loadSections()
+	if e.secErr != nil {
+		return nil, e.secErr
 	}
 	out := make([]DataSection, len(e.rodata))
 	copy(out, e.rodata)
@@ -353,69 +374,52 @@ func (e *elfInspector) ReadOnlySections() ([]DataSection, error) {
 }
 
 func (e *elfInspector) Relocations() ([]Relocation, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
-	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
+	e.loadRelocations()
 	out := make([]Relocation, len(e.relocs))
 	copy(out, e.relocs)
 	return out, nil
 }
 
 func (e *elfInspector) IFUNCResolvers() ([]FunctionSymbol, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
-	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
+	e.loadRelocations()
 	out := make([]FunctionSymbol, len(e.ifuncs))
 	copy(out, e.ifuncs)
 	return out, nil
 }
 
 func (e *elfInspector) GNUProperty() (uint32, error) {
-	e.parseOnce()
-	if !e.exists {
-		return 0, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return 0, ErrNotELF
+	if err := e.ready(); err != nil {
+		return 0, err
 	}
+	e.propOnce.Do(func() {
+		e.gnuProp = decodeGNUProperty(e.f)
+	})
 	return e.gnuProp, nil
 }
 
 func (e *elfInspector) EHLandingPads() ([]uint64, error) {
-	e.parseOnce()
-	if !e.exists {
-		return nil, ErrBinaryMissing
-	}
-	if !e.isELF {
-		return nil, ErrNotELF
-	}
-	if e.parseErr != nil {
-		return nil, e.parseErr
+	if err := e.ready(); err != nil {
+		return nil, err
 	}
+	e.ehOnce.Do(func() {
+		e.ehLPs = decodeEHLandingPads(e.f)
+	})
 	out := make([]uint64, len(e.ehLPs))
 	copy(out, e.ehLPs)
 	return out, nil
 }
 
-// parseOnce loads the ELF symbol tables exactly once per inspector instance.
-// All errors are stored on the receiver and surfaced via the typed methods;
-// this keeps the BinaryInspector interface clean of "init / lazy" knobs.
-func (e *elfInspector) parseOnce() {
-	e.once.Do(func() {
+// open stats, maps and header-parses the binary exactly once per inspector
+// instance. Facet decoding is NOT done here — each facet has its own
+// once-guarded loader so inspecting one facet never pays for the rest.
+func (e *elfInspector) open() {
+	e.openOnce.Do(func() {
 		if e.path == "" {
 			return
 		}
@@ -425,64 +429,71 @@ func (e *elfInspector) parseOnce() {
 		}
 		e.exists = true
 
-		f, err := elf.Open(e.path)
+		data, mapped, err := mapFile(e.path, fi.Size())
+		if err != nil {
+			e.exists = false
+			return
+		}
+		e.data = data
+		e.mapped = mapped
+
+		f, err := elf.NewFile(bytes.NewReader(e.data))
 		if err != nil {
-			// Not ELF (or unreadable as ELF). Distinguish the two by
-			// peeking at the magic; for now, report not-ELF, since
-			// elf.Open returns a similar error for both.
+			// Not ELF (or unreadable as ELF); drop the mapping, nothing
+			// will ever decode from it.
+			e.releaseMapping()
 			return
 		}
-		defer f.Close()
 		e.isELF = true
+		e.f = f
 		e.machine = f.Machine
 		e.class = f.Class
 
-		// Collect SHF_EXECINSTR sections (typically `.text`, `.plt`, `.init`,
-		// `.fini`). We snapshot the raw bytes here so callers don't need to
-		// re-open the ELF; sections are usually small relative to the binary.
-		for i, sec := range f.Sections {
-			if sec.Type != elf.SHT_PROGBITS {
-				continue
-			}
-			if sec.Flags&elf.SHF_EXECINSTR == 0 {
-				// Capture allocated, non-executable PROGBITS as
-				// ReadOnlySections so vtable / .rodata consumers can
-				// scan them without re-opening the ELF. Strictly
-				// allocated only — `.comment`/`.debug_*` are skipped.
-				if sec.Flags&elf.SHF_ALLOC == 0 {
-					continue
-				}
-				if data, derr := sec.Data(); derr == nil {
-					e.rodata = append(e.rodata, DataSection{
-						Name:       sec.Name,
-						Addr:       sec.Addr,
-						Data:       data,
-						SectionIdx: i,
-						Writable:   sec.Flags&elf.SHF_WRITE != 0,
-					})
-				}
-				continue
-			}
-			data, derr := sec.Data()
-			if derr != nil {
-				if e.parseErr == nil {
-					e.parseErr = fmt.Errorf("read section %q: %w", sec.Name, derr)
-				}
-				continue
+		if e.mapped {
+			// The interface has no Close; unmap when the inspector (and
+			// with it every section view) becomes unreachable. The
+			// campaign-wide analysis cache drops inspectors wholesale on
+			// reset, so without this week-long runs would leak mappings.
+			runtime.SetFinalizer(e, (*elfInspector).releaseMapping)
+		}
+	})
+}
+
+// mapFile maps the file read-only, falling back to a plain read when the
+// mapping fails (empty files, exotic filesystems).
+func mapFile(path string, size int64) (data []byte, mapped bool, err error) {
+	if size > 0 {
+		if f, ferr := os.Open(path); ferr == nil {
+			data, merr := syscall.Mmap(int(f.Fd()), 0, int(size), syscall.PROT_READ, syscall.MAP_PRIVATE)
+			f.Close()
+			if merr == nil {
+				return data, true, nil
 			}
-			e.execs = append(e.execs, ExecSection{
-				Name:       sec.Name,
-				Addr:       sec.Addr,
-				Data:       data,
-				SectionIdx: i,
-			})
 		}
+	}
+	data, err = os.ReadFile(path)
+	return data, false, err
+}
 
+// releaseMapping returns the mapping to the OS; safe to call more than once.
+func (e *elfInspector) releaseMapping() {
+	if e.mapped {
+		syscall.Munmap(e.data)
+		e.mapped = false
+	}
+	e.data = nil
+}
+
+// loadSymbols walks .symtab and .dynsym once, populating the plain,
+// imported, function and extended-function symbol views together (they all
+// come out of the same table walk).
+func (e *elfInspector) loadSymbols() {
+	e.symOnce.Do(func() {
 		symSet := make(map[string]struct{})
 		funcSet := make(map[uint64]FunctionSymbol)
 		extFuncSet := make(map[uint64]ExtendedFunctionSymbol)
 		// Static symbols: may be absent in stripped binaries.
-		if syms, err := f.Symbols(); err == nil {
+		if syms, err := e.f.Symbols(); err == nil {
 			for _, s := range syms {
 				if s.Name != "" {
 					symSet[s.Name] = struct{}{}
@@ -491,11 +502,11 @@ func (e *elfInspector) parseOnce() {
 				collectExtendedFunctionSymbol(extFuncSet, s)
 			}
 		} else if !errors.Is(err, elf.ErrNoSymbols) {
-			e.parseErr = fmt.Errorf("read .symtab: %w", err)
+			e.symErr = fmt.Errorf("read .symtab: %w", err)
 		}
 		// Dynamic symbols: present in dynamically linked binaries; this is
 		// where we'll see __stack_chk_fail / __stack_chk_guard imports.
-		if dyn, err := f.DynamicSymbols(); err == nil {
+		if dyn, err := e.f.DynamicSymbols(); err == nil {
 			for _, s := range dyn {
 				if s.Name == "" {
 					continue
@@ -508,8 +519,8 @@ func (e *elfInspector) parseOnce() {
 				collectFunctionSymbol(funcSet, s)
 				collectExtendedFunctionSymbol(extFuncSet, s)
 			}
-		} else if !errors.Is(err, elf.ErrNoSymbols) && e.parseErr == nil {
-			e.parseErr = fmt.Errorf("read .dynsym: %w", err)
+		} else if !errors.Is(err, elf.ErrNoSymbols) && e.symErr == nil {
+			e.symErr = fmt.Errorf("read .dynsym: %w", err)
 		}
 
 		e.syms = make([]string, 0, len(symSet))
@@ -535,13 +546,71 @@ func (e *elfInspector) parseOnce() {
 		sort.Slice(e.extFuncs, func(i, j int) bool {
 			return e.extFuncs[i].Addr < e.extFuncs[j].Addr
 		})
+	})
+}
+
+// loadSections collects SHF_EXECINSTR sections (typically `.text`, `.plt`,
+// `.init`, `.fini`) and allocated non-executable PROGBITS (ReadOnlySections
+// for vtable / .rodata consumers). Section bytes are views into the file
+// mapping, not copies.
+func (e *elfInspector) loadSections() {
+	e.secOnce.Do(func() {
+		for i, sec := range e.f.Sections {
+			if sec.Type != elf.SHT_PROGBITS {
+				continue
+			}
+			if sec.Flags&elf.SHF_EXECINSTR == 0 {
+				// Strictly allocated only — `.comment`/`.debug_*` are skipped.
+				if sec.Flags&elf.SHF_ALLOC == 0 {
+					continue
+				}
+				if data, derr := e.sectionBytes(sec); derr == nil {
+					e.rodata = append(e.rodata, DataSection{
+						Name:       sec.Name,
+						Addr:       sec.Addr,
+						Data:       data,
+						SectionIdx: i,
+						Writable:   sec.Flags&elf.SHF_WRITE != 0,
+					})
+				}
+				continue
+			}
+			data, derr := e.sectionBytes(sec)
+			if derr != nil {
+				if e.secErr == nil {
+					e.secErr = fmt.Errorf("read section %q: %w", sec.Name, derr)
+				}
+				continue
+			}
+			e.execs = append(e.execs, ExecSection{
+				Name:       sec.Name,
+				Addr:       sec.Addr,
+				Data:       data,
+				SectionIdx: i,
+			})
+		}
+	})
+}
+
+// sectionBytes returns a section's contents as a view into the mapping
+// when possible; compressed or out-of-bounds sections fall back to
+// debug/elf's copying reader.
+func (e *elfInspector) sectionBytes(sec *elf.Section) ([]byte, error) {
+	if sec.Flags&elf.SHF_COMPRESSED == 0 {
+		end := sec.Offset + sec.FileSize
+		if end >= sec.Offset && end <= uint64(len(e.data)) {
+			return e.data[sec.Offset:end:end], nil
+		}
+	}
+	return sec.Data()
+}
 
-		// Decode relocations & IFUNC resolvers.
-		e.relocs, e.ifuncs = decodeRelocationsAndIFUNCs(f, e.extFuncs)
-		// Decode .note.gnu.property for IBT/SHSTK feature bits.
-		e.gnuProp = decodeGNUProperty(f)
-		// Decode EH landing pads (may be empty when .eh_frame absent).
-		e.ehLPs = decodeEHLandingPads(f)
+// loadRelocations decodes the `.rela.*` / `.rel.*` tables and the derived
+// IFUNC resolver set. It depends on the symbol facet for extended symbols.
+func (e *elfInspector) loadRelocations() {
+	e.loadSymbols()
+	e.relocOnce.Do(func() {
+		e.relocs, e.ifuncs = decodeRelocationsAndIFUNCs(e.f, e.extFuncs)
 	})
 }
 
@@ -3,6 +3,7 @@ package oracle
 import (
 	"fmt"
 	"strings"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/seed"
 )
@@ -114,15 +115,31 @@ type CheckContext struct {
 	Inspector BinaryInspector
 	// Cache is shared mutable storage for cross-checker memoization. Keys
 	// should be namespaced (e.g., "dynamic_buffer_search.result"). Values
-	// are typed assertions at the consumer's risk.
+	// are typed assertions at the consumer's risk. Access goes through
+	// CacheGet / CacheSet, which serialize concurrent checkers.
 	Cache map[string]any
+
+	// cacheMu guards Cache now that checkers within a phase run
+	// concurrently (see MechanismOracle scheduling).
+	cacheMu sync.Mutex
+
+	// analysis is the campaign-wide per-binary analysis entry; unlike Cache
+	// it survives across Analyze calls on the same binary content. Nil in
+	// unit tests that build a CheckContext by hand — the cached helpers
+	// then fall back to Cache.
+	analysis *binaryAnalysis
 }
 
 // CacheGet retrieves a value from the per-Analyze cache. Returns (nil, false)
 // if absent. Convenience over manual map access so callers needn't nil-check
 // the map.
 func (c *CheckContext) CacheGet(key string) (any, bool) {
-	if c == nil || c.Cache == nil {
+	if c == nil {
+		return nil, false
+	}
+	c.cacheMu.Lock()
+	defer c.cacheMu.Unlock()
+	if c.Cache == nil {
 		return nil, false
 	}
 	v, ok := c.Cache[key]
@@ -135,12 +152,26 @@ func (c *CheckContext) CacheSet(key string, value any) {
 	if c == nil {
 		return
 	}
+	c.cacheMu.Lock()
+	defer c.cacheMu.Unlock()
 	if c.Cache == nil {
 		c.Cache = make(map[string]any)
 	}
 	c.Cache[key] = value
 }
 
+// SharedResultProducer is an optional interface for dynamic checkers whose
+// Check populates CheckContext.Cache entries that sibling checkers consume
+// (e.g., `DynamicBufferSearchChecker` producing the binary-search result
+// read by INV-SP-L02/L03/L04 and INV-SP-V02). The parallel scheduler runs
+// producers to completion before fanning out the remaining dynamic
+// checkers, preserving the declaration-order contract consumers rely on.
+type SharedResultProducer interface {
+	// ProducesSharedResult reports whether this checker's Check seeds the
+	// per-Analyze cache for sibling checkers.
+	ProducesSharedResult() bool
+}
+
 // InvariantChecker is the unit of oracle work corresponding to one row in
 // `docs/invariants/*.md`.
 //
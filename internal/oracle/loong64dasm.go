@@ -0,0 +1,183 @@
+package oracle
+
+import (
+	"golang.org/x/arch/loong64/loong64asm"
+)
+
+// loong64dasm.go is the LoongArch64 counterpart of x86dasm.go /
+// walkSection: native in-process decoding feeding the shared
+// IndirectBranch / FortifyChkCallSite structures.
+//
+// The LP64D ABI passes the chk dstlen argument (4th) in a3 (r7).
+// Constants reach it as `addi.d a3, zero, imm` (the `li.d` expansion for
+// 12-bit values, including the -1 sentinel) or `lu12i.w` + `ori` pairs;
+// chk PLT calls are `bl %plt(...)` under the default code model and
+// resolve statically.
+//
+// As with the RV64 backend, operand fields are extracted from the raw
+// encoding (`Inst.Enc`); LoongArch field positions are fixed per format,
+// keeping the x/arch surface down to `Decode` plus the Op constants.
+
+// LoongArch ABI register numbers used below.
+const (
+	loongRegZero = 0
+	loongRegRA   = 1
+	loongRegA3   = 7
+)
+
+// loongInsnLen is the fixed LoongArch instruction width.
+const loongInsnLen = 4
+
+// Field accessors (positions are uniform across the 2R/3R/2RI formats).
+func loongRd(enc uint32) int { return int(enc & 0x1f) }
+func loongRj(enc uint32) int { return int((enc >> 5) & 0x1f) }
+
+// loongSi12 extracts the sign-extended 12-bit immediate of the 2RI12
+// formats (addi.d et al.).
+func loongSi12(enc uint32) int64 { return int64(int32(enc<<10) >> 20) }
+
+// loongUi12 extracts the zero-extended 12-bit immediate of ori.
+func loongUi12(enc uint32) int64 { return int64((enc >> 10) & 0xfff) }
+
+// loongSi20 extracts the sign-extended 20-bit immediate of lu12i.w.
+func loongSi20(enc uint32) int64 { return int64(int32(enc<<7) >> 12) }
+
+// loongOffs16 reassembles the 16-bit branch offset of the 2RI16 formats
+// (jirl and the conditional branches), already shifted to bytes.
+func loongOffs16(enc uint32) int64 { return int64(int32(enc<<6)>>16) << 2 }
+
+// loongOffs26 reassembles the scrambled 26-bit offset of b/bl:
+// offs[15:0] lives in enc[25:10] and offs[25:16] in enc[9:0].
+func loongOffs26(enc uint32) int64 {
+	raw := (enc&0x3ff)<<16 | (enc>>10)&0xffff
+	return int64(int32(raw<<6)>>6) << 2
+}
+
+// loongIsBranch reports whether a decoded op changes control flow; any
+// such instruction invalidates the tracked a3 immediate.
+func loongIsBranch(op loong64asm.Op) bool {
+	switch op {
+	case loong64asm.B, loong64asm.BL, loong64asm.JIRL,
+		loong64asm.BEQ, loong64asm.BNE, loong64asm.BLT, loong64asm.BGE,
+		loong64asm.BLTU, loong64asm.BGEU, loong64asm.BEQZ, loong64asm.BNEZ:
+		return true
+	}
+	return false
+}
+
+// walkSectionLoong64 mirrors walkSection for LoongArch64: it sweeps the
+// section, tracks the last statically-known immediate in a3 and emits a
+// FortifyChkCallSite for every `bl` whose target is a chk PLT stub.
+func walkSectionLoong64(sec ExecSection, funcs []FunctionSymbol, chkAddrs map[uint64]string, out *[]FortifyChkCallSite) {
+	var a3val int64
+	a3known := false
+
+	for off := 0; off+loongInsnLen <= len(sec.Data); off += loongInsnLen {
+		addr := sec.Addr + uint64(off)
+		inst, err := loong64asm.Decode(sec.Data[off : off+loongInsnLen])
+		if err != nil {
+			a3known = false // inter-function padding / data islands
+			continue
+		}
+
+		enc := inst.Enc
+		switch inst.Op {
+		case loong64asm.ADDI_D, loong64asm.ADDI_W:
+			if loongRd(enc) == loongRegA3 {
+				switch {
+				case loongRj(enc) == loongRegZero: // li.d a3, imm
+					a3val, a3known = loongSi12(enc), true
+				case loongRj(enc) == loongRegA3 && a3known:
+					a3val += loongSi12(enc)
+				default:
+					a3known = false
+				}
+			}
+		case loong64asm.ORI:
+			if loongRd(enc) == loongRegA3 {
+				switch {
+				case loongRj(enc) == loongRegZero:
+					a3val, a3known = loongUi12(enc), true
+				case loongRj(enc) == loongRegA3 && a3known:
+					a3val |= loongUi12(enc)
+				default:
+					a3known = false
+				}
+			}
+		case loong64asm.LU12I_W:
+			if loongRd(enc) == loongRegA3 {
+				a3val, a3known = loongSi20(enc)<<12, true
+			}
+		case loong64asm.BL:
+			target := addr + uint64(loongOffs26(enc))
+			if name, isChk := chkAddrs[target]; isChk {
+				site := FortifyChkCallSite{
+					SiteAddr:        addr,
+					Family:          chkSymbolFamilyName(name),
+					ChkSymbol:       name,
+					DstlenImmediate: -1,
+				}
+				if fn, ok := findEnclosingFunction(funcs, addr); ok {
+					site.CallerFunc = fn.Name
+				}
+				if a3known {
+					site.DstlenImmediate = a3val
+					if a3val == -1 {
+						site.DstlenIsAllOnes = true
+					}
+				}
+				*out = append(*out, site)
+			}
+			a3known = false // the callee may clobber a3
+		default:
+			if loongIsBranch(inst.Op) {
+				a3known = false
+			} else if loongRd(enc) == loongRegA3 {
+				// Unmodelled write to a3 (rd is at a fixed position in
+				// every register-writing format).
+				a3known = false
+			}
+		}
+	}
+}
+
+// enumerateIndirectBranchesLoong64 is the LoongArch64 backend for
+// EnumerateIndirectBranches. `jirl` is the indirect form; the plain
+// return (`jirl zero, ra, 0`) is excluded just as x86 `ret` is. The
+// x86-specific Inst / NOTRACK fields stay at their zero values.
+func enumerateIndirectBranchesLoong64(execs []ExecSection) []IndirectBranch {
+	var out []IndirectBranch
+	for _, sec := range execs {
+		for off := 0; off+loongInsnLen <= len(sec.Data); off += loongInsnLen {
+			addr := sec.Addr + uint64(off)
+			inst, err := loong64asm.Decode(sec.Data[off : off+loongInsnLen])
+			if err != nil {
+				continue
+			}
+			enc := inst.Enc
+			ib := IndirectBranch{
+				Section:    sec.Name,
+				Addr:       addr,
+				PrefixAddr: addr,
+				Length:     loongInsnLen,
+			}
+			switch inst.Op {
+			case loong64asm.JIRL:
+				rd, rj := loongRd(enc), loongRj(enc)
+				if rd == loongRegZero && rj == loongRegRA && loongOffs16(enc) == 0 {
+					continue // plain return
+				}
+				ib.IsCall = rd == loongRegRA
+				out = append(out, ib)
+			case loong64asm.BL, loong64asm.B:
+				ib.IsCall = inst.Op == loong64asm.BL
+				ib.TargetKnown = true
+				ib.Target = addr + uint64(loongOffs26(enc))
+				out = append(out, ib)
+			default:
+				continue
+			}
+		}
+	}
+	return out
+}
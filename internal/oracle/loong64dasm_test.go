@@ -0,0 +1,75 @@
+package oracle
+
+import (
+	"encoding/binary"
+	"testing"
+)
+
+// la64 packs hand-assembled LoongArch words into little-endian bytes.
+func la64(words ...uint32) []byte {
+	out := make([]byte, 4*len(words))
+	for i, w := range words {
+		binary.LittleEndian.PutUint32(out[4*i:], w)
+	}
+	return out
+}
+
+func TestLoongFieldAccessors(t *testing.T) {
+	// addi.d a3, zero, -1
+	enc := uint32(0x02FFFC07)
+	if loongRd(enc) != loongRegA3 || loongRj(enc) != loongRegZero {
+		t.Fatalf("addi.d fields: rd=%d rj=%d", loongRd(enc), loongRj(enc))
+	}
+	if got := loongSi12(enc); got != -1 {
+		t.Fatalf("expected si12 -1, got %d", got)
+	}
+	// bl .+0xfc
+	if got := loongOffs26(0x5400FC00); got != 0xFC {
+		t.Fatalf("expected offs26 0xfc, got %#x", got)
+	}
+	// backward branch: bl .-4
+	if got := loongOffs26(0x57FFFFFF); got != -4 {
+		t.Fatalf("expected offs26 -4, got %d", got)
+	}
+}
+
+func TestWalkSectionLoong64_AllOnesSentinel(t *testing.T) {
+	// addi.d a3, zero, -1 ; bl 0x100
+	sec := ExecSection{
+		Name: ".text",
+		Addr: 0,
+		Data: la64(0x02FFFC07, 0x54000000|uint32((0x100-0x4)>>2)<<10),
+	}
+	funcs := []FunctionSymbol{{Name: "main", Addr: 0, Size: 0x8}}
+	chk := map[uint64]string{0x100: "__memcpy_chk"}
+
+	var sites []FortifyChkCallSite
+	walkSectionLoong64(sec, funcs, chk, &sites)
+
+	if len(sites) != 1 {
+		t.Fatalf("expected 1 site, got %d", len(sites))
+	}
+	s := sites[0]
+	if s.Family != "memcpy" || s.CallerFunc != "main" || s.SiteAddr != 0x4 {
+		t.Fatalf("unexpected site: %+v", s)
+	}
+	if !s.DstlenIsAllOnes || s.DstlenImmediate != -1 {
+		t.Fatalf("expected all-ones sentinel, got %+v", s)
+	}
+}
+
+func TestEnumerateIndirectBranchesLoong64(t *testing.T) {
+	// jirl ra, t0, 0 ; jirl zero, ra, 0 (ret)
+	jirlCall := uint32(0x4C000000 | 12<<5 | 1)
+	ret := uint32(0x4C000000 | 1<<5)
+	sec := ExecSection{Name: ".text", Addr: 0, Data: la64(jirlCall, ret)}
+
+	branches := enumerateIndirectBranchesLoong64([]ExecSection{sec})
+
+	if len(branches) != 1 {
+		t.Fatalf("expected 1 branch (ret excluded), got %d: %+v", len(branches), branches)
+	}
+	if !branches[0].IsCall || branches[0].TargetKnown {
+		t.Errorf("jirl ra should be an indirect call: %+v", branches[0])
+	}
+}
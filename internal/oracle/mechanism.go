@@ -4,6 +4,7 @@ import (
 	"fmt"
 	"sort"
 	"strings"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/seed"
 )
@@ -16,13 +17,20 @@ import (
 // cfi, scs, ...). It is what mechanism oracles (e.g., `CanaryOracle`)
 // delegate to internally.
 //
-// Scheduling is `Static → Dynamic`, sequentially. Static checkers can be
-// parallelized later (see ADR-003 §3.2); we keep them sequential here
-// because:
-//   - a single Analyze rarely runs more than ~5 static checkers;
-//   - the dynamic checker (binary search via QEMU) dominates wall-clock time;
-//   - parallel inspection would require synchronizing the BinaryInspector,
-//     which is currently single-reader by design.
+// Scheduling is `Static → Dynamic`. Within each phase checkers fan out
+// over a bounded goroutine pool (ADR-003 §3.2), so a seed that passes pays
+// roughly the max of the checker latencies instead of their sum:
+//   - static checkers are pure functions of the inspected binary (the
+//     inspector and the shared analysis cache are concurrency-safe) and
+//     run under `maxParallelStaticCheckers`;
+//   - dynamic checkers run under the separate, smaller
+//     `maxParallelDynamicCheckers` bound because each one may launch QEMU
+//     executions; checkers implementing `SharedResultProducer` (the
+//     binary-search producer) run to completion first so cache consumers
+//     keep their declaration-order contract.
+//
+// Result order in the aggregate is declaration order regardless of
+// completion order, so bug descriptions stay deterministic.
 //
 // The aggregation policy is plain OR over verdicts:
 //   - any Static / Dynamic Fail → bug;
@@ -59,7 +67,12 @@ func (m *MechanismOracle) Analyze(s *seed.Seed, ctx *AnalyzeContext, results []R
 		Cache:      make(map[string]any),
 	}
 	if ctx.BinaryPath != "" {
-		cctx.Inspector = NewBinaryInspector(ctx.BinaryPath)
+		// Shared per-binary analysis: every mechanism oracle run on the
+		// same binary content reuses one parsed inspector and one set of
+		// disassembly results instead of recomputing them per Analyze.
+		analysis := sharedBinaryAnalysis(ctx.BinaryPath)
+		cctx.Inspector = analysis.inspector
+		cctx.analysis = analysis
 	}
 
 	// Phase 1: Static.
@@ -85,28 +98,91 @@ func (m *MechanismOracle) Analyze(s *seed.Seed, ctx *AnalyzeContext, results []R
 	}, nil
 }
 
-// runPhase executes every checker whose Category matches `category`, in
-// declaration order.
+// Checker-pool bounds. Static inspection is cheap and CPU-bound; dynamic
+// checkers launch executor (QEMU) processes and get a deliberately smaller
+// bound so oracle parallelism composes with the engine's own workers
+// without oversubscribing the host.
+const (
+	maxParallelStaticCheckers  = 4
+	maxParallelDynamicCheckers = 2
+)
+
+// runPhase executes every checker whose Category matches `category` over a
+// bounded goroutine pool. Results come back in declaration order. The
+// dynamic phase runs in two waves: SharedResultProducer checkers first,
+// then everyone else, so cache consumers never observe a missing producer
+// result.
 func (m *MechanismOracle) runPhase(ctx *CheckContext, category InvariantCategory) []InvariantResult {
-	var out []InvariantResult
+	var selected []InvariantChecker
 	for _, c := range m.Checkers {
-		if c.Category() != category {
-			continue
-		}
-		r := c.Check(ctx)
-		// Defensive: ensure ID/Category survive even if a checker forgot to
-		// populate them.
-		if r.ID == "" {
-			r.ID = c.ID()
+		if c.Category() == category {
+			selected = append(selected, c)
 		}
-		if r.Category == "" {
-			r.Category = category
+	}
+	if len(selected) == 0 {
+		return nil
+	}
+
+	limit := maxParallelStaticCheckers
+	if category == CategoryDynamic {
+		limit = maxParallelDynamicCheckers
+	}
+
+	var producers, rest []int
+	for i, c := range selected {
+		if p, ok := c.(SharedResultProducer); ok && p.ProducesSharedResult() {
+			producers = append(producers, i)
+		} else {
+			rest = append(rest, i)
 		}
-		out = append(out, r)
 	}
+
+	out := make([]InvariantResult, len(selected))
+	m.runWave(ctx, selected, out, producers, category, limit)
+	m.runWave(ctx, selected, out, rest, category, limit)
 	return out
 }
 
+// runWave runs the checkers at `idxs` concurrently (at most `limit` at a
+// time) and stores each result at its declaration index in `out`.
+func (m *MechanismOracle) runWave(ctx *CheckContext, checkers []InvariantChecker, out []InvariantResult, idxs []int, category InvariantCategory, limit int) {
+	if len(idxs) == 0 {
+		return
+	}
+	if limit <= 1 || len(idxs) == 1 {
+		for _, i := range idxs {
+			out[i] = m.runChecker(ctx, checkers[i], category)
+		}
+		return
+	}
+
+	sem := make(chan struct{}, limit)
+	var wg sync.WaitGroup
+	for _, i := range idxs {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			sem <- struct{}{}
+			defer func() { <-sem }()
+			out[i] = m.runChecker(ctx, checkers[i], category)
+		}(i)
+	}
+	wg.Wait()
+}
+
+// runChecker invokes one checker and backfills ID/Category defensively,
+// so they survive even if a checker forgot to populate them.
+func (m *MechanismOracle) runChecker(ctx *CheckContext, c InvariantChecker, category InvariantCategory) InvariantResult {
+	r := c.Check(ctx)
+	if r.ID == "" {
+		r.ID = c.ID()
+	}
+	if r.Category == "" {
+		r.Category = category
+	}
+	return r
+}
+
 // filterByVerdict returns only those results whose Verdict matches.
 func filterByVerdict(rs []InvariantResult, want InvariantVerdict) []InvariantResult {
 	var out []InvariantResult
@@ -2,7 +2,9 @@ package oracle
 
 import (
 	"strings"
+	"sync/atomic"
 	"testing"
+	"time"
 
 	"github.com/zjy-dev/de-fuzz/internal/seed"
 )
@@ -144,3 +146,122 @@ func TestMechanism_NotApplicableNoBug(t *testing.T) {
 		t.Fatalf("NA-only run must produce nil bug, got: %s", bug.Description)
 	}
 }
+
+// gaugeChecker records peak in-flight concurrency across its instances,
+// for asserting the phase scheduler actually fans out.
+type gaugeChecker struct {
+	id       string
+	category InvariantCategory
+	inflight *int32
+	peak     *int32
+}
+
+func (g *gaugeChecker) ID() string                  { return g.id }
+func (g *gaugeChecker) Category() InvariantCategory { return g.category }
+func (g *gaugeChecker) Check(ctx *CheckContext) InvariantResult {
+	cur := atomic.AddInt32(g.inflight, 1)
+	for {
+		p := atomic.LoadInt32(g.peak)
+		if cur <= p || atomic.CompareAndSwapInt32(g.peak, p, cur) {
+			break
+		}
+	}
+	time.Sleep(20 * time.Millisecond)
+	atomic.AddInt32(g.inflight, -1)
+	return InvariantResult{ID: g.id, Category: g.category, Verdict: VerdictPass}
+}
+
+// TestMechanism_StaticCheckersRunConcurrently asserts the static phase
+// overlaps checker execution instead of paying the sum of latencies.
+func TestMechanism_StaticCheckersRunConcurrently(t *testing.T) {
+	var inflight, peak int32
+	m := &MechanismOracle{
+		Name: "test",
+		Checkers: []InvariantChecker{
+			&gaugeChecker{id: "INV-A", category: CategoryStatic, inflight: &inflight, peak: &peak},
+			&gaugeChecker{id: "INV-B", category: CategoryStatic, inflight: &inflight, peak: &peak},
+			&gaugeChecker{id: "INV-C", category: CategoryStatic, inflight: &inflight, peak: &peak},
+		},
+	}
+	if _, err := m.Analyze(&seed.Seed{}, &AnalyzeContext{}, nil); err != nil {
+		t.Fatalf("unexpected error: %v", err)
+	}
+	if atomic.LoadInt32(&peak) < 2 {
+		t.Errorf("static checkers should overlap, peak in-flight = %d", peak)
+	}
+}
+
+// producerChecker seeds a cache key; it implements SharedResultProducer so
+// the scheduler must complete it before the rest of the dynamic wave.
+type producerChecker struct {
+	id string
+}
+
+func (p *producerChecker) ID() string                  { return p.id }
+func (p *producerChecker) Category() InvariantCategory { return CategoryDynamic }
+func (p *producerChecker) ProducesSharedResult() bool  { return true }
+func (p *producerChecker) Check(ctx *CheckContext) InvariantResult {
+	time.Sleep(10 * time.Millisecond) // lose any naive race with consumers
+	ctx.CacheSet("test.producer.value", "ready")
+	return InvariantResult{ID: p.id, Category: CategoryDynamic, Verdict: VerdictPass}
+}
+
+// consumerChecker fails unless the producer's cache entry is visible.
+type consumerChecker struct {
+	id string
+}
+
+func (c *consumerChecker) ID() string                  { return c.id }
+func (c *consumerChecker) Category() InvariantCategory { return CategoryDynamic }
+func (c *consumerChecker) Check(ctx *CheckContext) InvariantResult {
+	r := InvariantResult{ID: c.id, Category: CategoryDynamic, Verdict: VerdictPass}
+	if _, ok := ctx.CacheGet("test.producer.value"); !ok {
+		r.Verdict = VerdictFail
+		r.Evidence = "producer result missing"
+	}
+	return r
+}
+
+// TestMechanism_DynamicProducerRunsBeforeConsumers asserts the two-wave
+// dynamic schedule: consumers always observe the producer's cache entry,
+// even when declared ahead of the producer.
+func TestMechanism_DynamicProducerRunsBeforeConsumers(t *testing.T) {
+	m := &MechanismOracle{
+		Name: "test",
+		Checkers: []InvariantChecker{
+			&consumerChecker{id: "INV-C1"},
+			&consumerChecker{id: "INV-C2"},
+			&producerChecker{id: "INV-P"},
+		},
+	}
+	bug, err := m.Analyze(&seed.Seed{}, &AnalyzeContext{}, nil)
+	if err != nil {
+		t.Fatalf("unexpected error: %v", err)
+	}
+	if bug != nil {
+		t.Fatalf("consumers missed the producer result: %s", bug.Description)
+	}
+}
+
+// TestMechanism_ResultOrderIsDeclarationOrder asserts completion order
+// does not leak into the aggregated result order.
+func TestMechanism_ResultOrderIsDeclarationOrder(t *testing.T) {
+	var inflight, peak int32
+	m := &MechanismOracle{
+		Name: "test",
+		Checkers: []InvariantChecker{
+			&gaugeChecker{id: "INV-1", category: CategoryStatic, inflight: &inflight, peak: &peak},
+			&stubChecker{id: "INV-2", category: CategoryStatic, verdict: VerdictPass},
+			&gaugeChecker{id: "INV-3", category: CategoryStatic, inflight: &inflight, peak: &peak},
+		},
+	}
+	out := m.runPhase(&CheckContext{}, CategoryStatic)
+	if len(out) != 3 {
+		t.Fatalf("expected 3 results, got %d", len(out))
+	}
+	for i, want := range []string{"INV-1", "INV-2", "INV-3"} {
+		if out[i].ID != want {
+			t.Errorf("result[%d] = %s, want %s", i, out[i].ID, want)
+		}
+	}
+}
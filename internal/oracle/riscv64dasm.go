@@ -0,0 +1,284 @@
+package oracle
+
+import (
+	"encoding/binary"
+
+	"golang.org/x/arch/riscv64/riscv64asm"
+)
+
+// riscv64dasm.go is the RV64 counterpart of x86dasm.go / walkSection:
+// native in-process decoding feeding the shared IndirectBranch /
+// FortifyChkCallSite structures.
+//
+// The RV64 psABI passes the chk dstlen argument (4th) in a3 (x13).
+// Constants reach it as `addi a3, zero, imm` (the `li` expansion, or its
+// compressed `c.li` form) and as `lui` + `addiw` pairs for wider values;
+// chk PLT calls appear either as a relaxed `jal ra, ...` or as the
+// two-instruction `auipc` + `jalr ra` call expansion, both of which we
+// resolve statically.
+//
+// Operand fields are extracted from the raw encoding (`Inst.Enc` /
+// the instruction bytes) — RISC-V field positions are fixed per format,
+// and this keeps the x/arch surface we depend on down to `Decode` plus
+// the base-ISA Op constants.
+
+// RV64 ABI register numbers used below.
+const (
+	riscvRegZero = 0
+	riscvRegRA   = 1
+	riscvRegA3   = 13
+)
+
+// riscvInsnLen derives the instruction length from the low bits of the
+// first halfword: non-compressed encodings have both low bits set.
+func riscvInsnLen(data []byte) int {
+	if len(data) < 2 {
+		return 0
+	}
+	if binary.LittleEndian.Uint16(data)&0x3 == 0x3 {
+		return 4
+	}
+	return 2
+}
+
+// Uncompressed field accessors (positions are uniform across formats).
+func riscvRd(enc uint32) int     { return int((enc >> 7) & 0x1f) }
+func riscvRs1(enc uint32) int    { return int((enc >> 15) & 0x1f) }
+func riscvImmI(enc uint32) int64 { return int64(int32(enc) >> 20) }
+func riscvImmU(enc uint32) int64 { return int64(int32(enc & 0xfffff000)) }
+
+// riscvImmJ reassembles the scrambled J-type immediate of `jal`:
+// imm[20|10:1|11|19:12] lives in enc[31|30:21|20|19:12].
+func riscvImmJ(enc uint32) int64 {
+	imm := (int32(enc)>>31)<<20 |
+		int32((enc>>12)&0xff)<<12 |
+		int32((enc>>20)&0x1)<<11 |
+		int32((enc>>21)&0x3ff)<<1
+	return int64(imm)
+}
+
+// riscvCompressedLI recognises `c.li rd, imm` (quadrant 01, funct3 010)
+// from the raw halfword, returning (rd, imm, true) on a match. Handled
+// outside riscv64asm so that a toolchain without a decodable C extension
+// does not cost us the `li a3, -1` sentinel shape.
+func riscvCompressedLI(data []byte) (rd int, imm int64, ok bool) {
+	if len(data) < 2 {
+		return 0, 0, false
+	}
+	hw := binary.LittleEndian.Uint16(data)
+	if hw&0x3 != 0x1 || (hw>>13)&0x7 != 0x2 {
+		return 0, 0, false
+	}
+	rd = int((hw >> 7) & 0x1f)
+	raw := int64((hw>>12)&0x1)<<5 | int64((hw>>2)&0x1f)
+	imm = raw << 58 >> 58 // sign-extend 6 bits
+	return rd, imm, rd != riscvRegZero
+}
+
+// riscvCompressedBranchOrJump reports whether the raw halfword is a
+// compressed control-transfer (c.j / c.jal / c.jr / c.jalr / c.beqz /
+// c.bnez), which must reset the tracked a3 immediate.
+func riscvCompressedBranchOrJump(data []byte) bool {
+	if len(data) < 2 {
+		return false
+	}
+	hw := binary.LittleEndian.Uint16(data)
+	switch hw & 0x3 {
+	case 0x1: // quadrant 01: c.j (101), c.beqz (110), c.bnez (111)
+		f3 := (hw >> 13) & 0x7
+		return f3 == 0x5 || f3 == 0x6 || f3 == 0x7
+	case 0x2: // quadrant 10: c.jr / c.jalr have funct4 100x, rs2 == 0
+		return (hw>>13)&0x7 == 0x4 && (hw>>2)&0x1f == 0
+	}
+	return false
+}
+
+// riscvIsBranch reports whether a decoded base-ISA op changes control
+// flow.
+func riscvIsBranch(op riscv64asm.Op) bool {
+	switch op {
+	case riscv64asm.JAL, riscv64asm.JALR, riscv64asm.BEQ, riscv64asm.BNE,
+		riscv64asm.BLT, riscv64asm.BGE, riscv64asm.BLTU, riscv64asm.BGEU:
+		return true
+	}
+	return false
+}
+
+// walkSectionRISCV64 mirrors walkSection for RV64: it sweeps the
+// section, tracks the last statically-known immediate in a3 and emits a
+// FortifyChkCallSite for every resolved call into a chk PLT stub.
+func walkSectionRISCV64(sec ExecSection, funcs []FunctionSymbol, chkAddrs map[uint64]string, out *[]FortifyChkCallSite) {
+	var a3val int64
+	a3known := false
+
+	// Pending `auipc` results per rd, for resolving the auipc+jalr call
+	// expansion. Cleared whenever control flow changes.
+	auipc := make(map[int]uint64)
+
+	emit := func(addr, target uint64) {
+		name, isChk := chkAddrs[target]
+		if !isChk {
+			return
+		}
+		site := FortifyChkCallSite{
+			SiteAddr:        addr,
+			Family:          chkSymbolFamilyName(name),
+			ChkSymbol:       name,
+			DstlenImmediate: -1,
+		}
+		if fn, ok := findEnclosingFunction(funcs, addr); ok {
+			site.CallerFunc = fn.Name
+		}
+		if a3known {
+			site.DstlenImmediate = a3val
+			if a3val == -1 {
+				site.DstlenIsAllOnes = true
+			}
+		}
+		*out = append(*out, site)
+	}
+
+	reset := func() {
+		a3known = false
+		for k := range auipc {
+			delete(auipc, k)
+		}
+	}
+
+	for off := 0; off+2 <= len(sec.Data); {
+		step := riscvInsnLen(sec.Data[off:])
+		if step == 0 || off+step > len(sec.Data) {
+			break
+		}
+		addr := sec.Addr + uint64(off)
+
+		inst, err := riscv64asm.Decode(sec.Data[off : off+step])
+		if err != nil {
+			// Compressed or unknown encoding; keep the `c.li a3` shape.
+			if rd, imm, ok := riscvCompressedLI(sec.Data[off:]); ok && rd == riscvRegA3 {
+				a3val, a3known = imm, true
+			} else if riscvCompressedBranchOrJump(sec.Data[off:]) {
+				reset()
+			}
+			off += step
+			continue
+		}
+
+		enc := inst.Enc
+		switch inst.Op {
+		case riscv64asm.ADDI:
+			if riscvRd(enc) == riscvRegA3 {
+				switch {
+				case riscvRs1(enc) == riscvRegZero: // li a3, imm
+					a3val, a3known = riscvImmI(enc), true
+				case riscvRs1(enc) == riscvRegA3 && a3known:
+					a3val += riscvImmI(enc)
+				default:
+					a3known = false
+				}
+			}
+		case riscv64asm.ADDIW:
+			if riscvRd(enc) == riscvRegA3 {
+				if riscvRs1(enc) == riscvRegA3 && a3known {
+					a3val = int64(int32(a3val + riscvImmI(enc)))
+				} else if riscvRs1(enc) == riscvRegZero {
+					a3val, a3known = int64(int32(riscvImmI(enc))), true
+				} else {
+					a3known = false
+				}
+			}
+		case riscv64asm.LUI:
+			if riscvRd(enc) == riscvRegA3 {
+				a3val, a3known = riscvImmU(enc), true
+			}
+		case riscv64asm.AUIPC:
+			auipc[riscvRd(enc)] = addr + uint64(riscvImmU(enc))
+			if riscvRd(enc) == riscvRegA3 {
+				a3known = false
+			}
+		case riscv64asm.JAL:
+			if riscvRd(enc) == riscvRegRA {
+				emit(addr, addr+uint64(riscvImmJ(enc)))
+			}
+			reset()
+		case riscv64asm.JALR:
+			if riscvRd(enc) == riscvRegRA {
+				if base, ok := auipc[riscvRs1(enc)]; ok {
+					emit(addr, base+uint64(riscvImmI(enc)))
+				}
+			}
+			reset()
+		default:
+			if riscvIsBranch(inst.Op) {
+				reset()
+			} else if step == 4 && riscvRd(enc) == riscvRegA3 {
+				// Unmodelled uncompressed write to a3 (rd is at a fixed
+				// position in every register-writing format).
+				a3known = false
+			}
+		}
+
+		off += step
+	}
+}
+
+// enumerateIndirectBranchesRISCV64 is the RV64 backend for
+// EnumerateIndirectBranches. `jalr` (and its compressed forms) are the
+// indirect branches; plain returns (`jalr zero, 0(ra)` / `c.jr ra`) are
+// excluded just as x86 `ret` is. The x86-specific Inst / NOTRACK fields
+// stay at their zero values.
+func enumerateIndirectBranchesRISCV64(execs []ExecSection) []IndirectBranch {
+	var out []IndirectBranch
+	for _, sec := range execs {
+		for off := 0; off+2 <= len(sec.Data); {
+			step := riscvInsnLen(sec.Data[off:])
+			if step == 0 || off+step > len(sec.Data) {
+				break
+			}
+			addr := sec.Addr + uint64(off)
+			ib := IndirectBranch{
+				Section:    sec.Name,
+				Addr:       addr,
+				PrefixAddr: addr,
+				Length:     step,
+			}
+
+			if step == 2 {
+				hw := binary.LittleEndian.Uint16(sec.Data[off:])
+				if hw&0x3 == 0x2 && (hw>>13)&0x7 == 0x4 && (hw>>2)&0x1f == 0 {
+					rs1 := int((hw >> 7) & 0x1f)
+					isCall := (hw>>12)&0x1 == 1 // c.jalr vs c.jr
+					if rs1 != 0 && !(rs1 == riscvRegRA && !isCall) {
+						ib.IsCall = isCall
+						out = append(out, ib)
+					}
+				}
+				off += step
+				continue
+			}
+
+			inst, err := riscv64asm.Decode(sec.Data[off : off+step])
+			if err != nil {
+				off += step
+				continue
+			}
+			enc := inst.Enc
+			switch inst.Op {
+			case riscv64asm.JALR:
+				rd, rs1 := riscvRd(enc), riscvRs1(enc)
+				if rd == riscvRegZero && rs1 == riscvRegRA && riscvImmI(enc) == 0 {
+					break // plain return
+				}
+				ib.IsCall = rd == riscvRegRA
+				out = append(out, ib)
+			case riscv64asm.JAL:
+				ib.IsCall = riscvRd(enc) == riscvRegRA
+				ib.TargetKnown = true
+				ib.Target = addr + uint64(riscvImmJ(enc))
+				out = append(out, ib)
+			}
+			off += step
+		}
+	}
+	return out
+}
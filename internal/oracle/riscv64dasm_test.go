@@ -0,0 +1,79 @@
+package oracle
+
+import (
+	"encoding/binary"
+	"testing"
+)
+
+// rv32w packs hand-assembled 4-byte RV encodings little-endian.
+func rv32w(words ...uint32) []byte {
+	out := make([]byte, 4*len(words))
+	for i, w := range words {
+		binary.LittleEndian.PutUint32(out[4*i:], w)
+	}
+	return out
+}
+
+func TestRiscvImmJ(t *testing.T) {
+	// jal ra, .+0xfc  →  enc[30:21] = 0xfc>>1
+	enc := uint32(0x0FC000EF)
+	if got := riscvImmJ(enc); got != 0xFC {
+		t.Fatalf("expected 0xfc, got %#x", got)
+	}
+}
+
+func TestRiscvCompressedLI(t *testing.T) {
+	// c.li a3, -1: quadrant 01, funct3 010, rd=13, imm6=0b111111
+	hw := make([]byte, 2)
+	binary.LittleEndian.PutUint16(hw, 0x56FD)
+	rd, imm, ok := riscvCompressedLI(hw)
+	if !ok || rd != riscvRegA3 || imm != -1 {
+		t.Fatalf("c.li a3,-1: got rd=%d imm=%d ok=%v", rd, imm, ok)
+	}
+	// A load/store halfword must not match.
+	binary.LittleEndian.PutUint16(hw, 0x4398) // c.lw
+	if _, _, ok := riscvCompressedLI(hw); ok {
+		t.Fatal("c.lw should not parse as c.li")
+	}
+}
+
+func TestWalkSectionRISCV64_AllOnesSentinel(t *testing.T) {
+	// li a3, -1 (addi a3, zero, -1) ; jal ra, 0x100
+	sec := ExecSection{
+		Name: ".text",
+		Addr: 0,
+		Data: rv32w(0xFFF00693, 0x0EF|uint32((0x100-0x4)>>1)<<21|1<<7),
+	}
+	funcs := []FunctionSymbol{{Name: "main", Addr: 0, Size: 0x8}}
+	chk := map[uint64]string{0x100: "__memcpy_chk"}
+
+	var sites []FortifyChkCallSite
+	walkSectionRISCV64(sec, funcs, chk, &sites)
+
+	if len(sites) != 1 {
+		t.Fatalf("expected 1 site, got %d", len(sites))
+	}
+	s := sites[0]
+	if s.Family != "memcpy" || s.CallerFunc != "main" || s.SiteAddr != 0x4 {
+		t.Fatalf("unexpected site: %+v", s)
+	}
+	if !s.DstlenIsAllOnes || s.DstlenImmediate != -1 {
+		t.Fatalf("expected all-ones sentinel, got %+v", s)
+	}
+}
+
+func TestEnumerateIndirectBranchesRISCV64(t *testing.T) {
+	// jalr ra, 0(a5) ; jalr zero, 0(ra)  — the second is a plain return.
+	jalrA5 := uint32(0x000780E7) // rd=ra rs1=a5
+	ret := uint32(0x00008067)    // rd=zero rs1=ra imm=0
+	sec := ExecSection{Name: ".text", Addr: 0, Data: rv32w(jalrA5, ret)}
+
+	branches := enumerateIndirectBranchesRISCV64([]ExecSection{sec})
+
+	if len(branches) != 1 {
+		t.Fatalf("expected 1 branch (ret excluded), got %d: %+v", len(branches), branches)
+	}
+	if !branches[0].IsCall || branches[0].TargetKnown {
+		t.Errorf("jalr ra should be an indirect call: %+v", branches[0])
+	}
+}
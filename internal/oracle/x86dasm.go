@@ -57,7 +57,9 @@ type IndirectBranch struct {
 	// that need jump-table targets must do their own data-flow.
 	Target uint64
 	// Inst is the decoded x86asm.Inst (kept for callers that need fine
-	// detail like operand kinds).
+	// detail like operand kinds). Only populated by the x86 backend; the
+	// aarch64 / riscv64 / loongarch64 backends leave it zero, so callers
+	// reaching into Inst must gate on machine first.
 	Inst x86asm.Inst
 }
 
@@ -105,6 +107,17 @@ const IndirectBranchCacheKey = "oracle.x86dasm.indirect_branches"
 // follow-up "is this target an ENDBR" check that each consuming checker
 // performs.
 func EnumerateIndirectBranches(machine elf.Machine, execs []ExecSection) []IndirectBranch {
+	// Non-x86 machines get their own native sweeps (arm64dasm.go,
+	// riscv64dasm.go, loong64dasm.go) feeding the same struct.
+	switch machine {
+	case elf.EM_AARCH64:
+		return enumerateIndirectBranchesARM64(execs)
+	case elf.EM_RISCV:
+		return enumerateIndirectBranchesRISCV64(execs)
+	case elf.EM_LOONGARCH:
+		return enumerateIndirectBranchesLoong64(execs)
+	}
+
 	// NOTE: one of three independent x86 linear-sweep decoders in the
 	// oracle (see also decodeX86 in disasm/disasm.go and walkSection in
 	// fortify_disasm.go). Candidate for future consolidation.
@@ -191,13 +204,18 @@ func classifyBranch(sec ExecSection, addr uint64, inst x86asm.Inst) (IndirectBra
 	}
 }
 
-// CachedIndirectBranches returns the per-Analyze cached decode result if
-// present, otherwise computes & stores it. When ctx.Cache is nil the
-// helper still works but does not memoize.
+// CachedIndirectBranches returns the cached decode result if present,
+// otherwise computes & stores it. The campaign-wide per-binary cache is
+// preferred (survives oracle re-runs of the same binary); CheckContexts
+// without one fall back to the per-Analyze Cache. When ctx.Cache is nil
+// the helper still works but does not memoize.
 func CachedIndirectBranches(ctx *CheckContext, machine elf.Machine, execs []ExecSection) []IndirectBranch {
 	if ctx == nil {
 		return EnumerateIndirectBranches(machine, execs)
 	}
+	if ctx.analysis != nil {
+		return ctx.analysis.indirectBranches(machine, execs)
+	}
 	if v, ok := ctx.CacheGet(IndirectBranchCacheKey); ok {
 		if cached, ok := v.([]IndirectBranch); ok {
 			return cached
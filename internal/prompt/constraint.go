@@ -111,7 +111,7 @@ This is your starting point. This seed covers line %d, which is close to your ta
 %s
 %s
 
-`, ctx.BaseSeedLine, ctx.TargetLines, "```c", ctx.BaseSeedCode, "```")
+`, ctx.BaseSeedLine, ctx.TargetLines, "```c", b.trimCodeBlock(ctx.BaseSeedCode), "```")
 	}
 
 	compilerProfileSection := buildCompilerProfileSection(ctx)
@@ -175,8 +175,18 @@ This is your starting point. This seed covers line %d, which is close to your ta
 `
 	}
 
+	// The stable blocks (rules, output format, output example) lead the
+	// prompt so successive requests share the longest possible prefix and
+	// benefit from provider-side prompt caching; the volatile per-target
+	// context follows.
 	prompt := fmt.Sprintf(`You are an expert at generating test cases for compiler fuzzing. Your task is to MODIFY an existing C program to trigger specific code paths in the compiler.
 
+%s
+
+%s
+
+%s
+
 %s
 %s
 %s
@@ -187,28 +197,22 @@ This is your starting point. This seed covers line %d, which is close to your ta
 2. Study the base seed that reaches nearby code.
 3. **MODIFY the base seed** to cause the compiler to execute the target lines (%v).
 
-%s
-
 **Key Insights:**
 - The target is in function %s at BB%d with %d possible branches.
 - Focus on the conditions that lead to the target branch.
 - Small, focused changes often work better than major rewrites.
-
-%s
-
-%s
 `,
+		criticalRules,
+		outputFormat,
+		outputExample,
 		targetDesc,
 		functionCodeSection,
 		baseSeedSection,
 		compilerProfileSection,
 		ctx.TargetLines,
-		criticalRules,
 		ctx.TargetFunction,
 		ctx.TargetBBID,
 		ctx.SuccessorCount,
-		outputFormat,
-		outputExample,
 	)
 
 	return prompt, nil
@@ -263,7 +267,7 @@ The compiler took a different code path at function: **%s**
 %s
 %s
 
-`, "```cpp", div.DivergentFunctionCode, "```")
+`, "```cpp", b.trimCodeBlock(div.DivergentFunctionCode), "```")
 		}
 
 		divergenceSection += `**Analysis:** Your seed caused the compiler to branch differently than expected in this function.
@@ -283,7 +287,7 @@ This seed was tried but took the WRONG compiler path:
 %s
 %s
 
-`, "```c", div.MutatedSeedCode, "```")
+`, "```c", b.trimCodeBlock(div.MutatedSeedCode), "```")
 	}
 
 	// Section 4: Base seed (what works as starting point)
@@ -297,7 +301,7 @@ This seed successfully reaches nearby code (line %d). Start from this and make t
 %s
 %s
 
-`, ctx.BaseSeedLine, "```c", div.BaseSeedCode, "```")
+`, ctx.BaseSeedLine, "```c", b.trimCodeBlock(div.BaseSeedCode), "```")
 	} else if ctx.BaseSeedCode != "" {
 		baseSeedSection = fmt.Sprintf(`## 4. Working Base Seed (USE THIS AS STARTING POINT)
 
@@ -307,7 +311,7 @@ This seed successfully reaches nearby code (line %d). Start from this and make t
 %s
 %s
 
-`, ctx.BaseSeedLine, "```c", ctx.BaseSeedCode, "```")
+`, ctx.BaseSeedLine, "```c", b.trimCodeBlock(ctx.BaseSeedCode), "```")
 	}
 
 	// Section 5: Task and strategy
@@ -349,21 +353,23 @@ Create a NEW seed that:
 - Use only C99/C11 standard C code (no C++ features)`
 	}
 
-	prompt := fmt.Sprintf(`%s%s%s%s%s%s
-%s
+	// Stable rules and output format lead the prompt (shared prefix for
+	// provider-side caching); the per-retry sections follow.
+	prompt := fmt.Sprintf(`%s
 
 %s
 
 **OUTPUT: Only the code in a markdown code block. No explanations.**
-`,
+
+%s%s%s%s%s%s`,
+		criticalRules,
+		outputFormat,
 		targetFunctionSection,
 		divergenceSection,
 		failedSection,
 		baseSeedSection,
 		compilerProfileSection,
 		taskSection,
-		criticalRules,
-		outputFormat,
 	)
 
 	return prompt, nil
@@ -424,7 +430,7 @@ Your previous attempt failed to compile. **You MUST fix the compilation error.**
 
 `, errInfo.RetryAttempt, errInfo.MaxRetries, errInfo.ExitCode,
 		"```", errInfo.CompilerOutput, "```",
-		"```c", errInfo.FailedSeedCode, "```")
+		"```c", b.trimCodeBlock(errInfo.FailedSeedCode), "```")
 
 	// Section 3: Working Base Seed
 	baseSeedSection := ""
@@ -437,7 +443,7 @@ This seed compiles and runs successfully. Use it as your starting point:
 %s
 %s
 
-`, "```c", ctx.BaseSeedCode, "```")
+`, "```c", b.trimCodeBlock(ctx.BaseSeedCode), "```")
 	}
 
 	// Section 4: Task
@@ -478,28 +484,84 @@ This seed compiles and runs successfully. Use it as your starting point:
 
 	outputFormat := b.getOutputFormat()
 
-	prompt := fmt.Sprintf(`%s%s%s%s%s
-%s
+	// Stable rules and output format lead the prompt (shared prefix for
+	// provider-side caching); the per-retry sections follow.
+	prompt := fmt.Sprintf(`%s
 
 %s
 
 **OUTPUT: Only the fixed code in a markdown code block. No explanations.**
-`,
+
+%s%s%s%s%s`,
+		criticalRules,
+		outputFormat,
 		targetSection,
 		compileErrorSection,
 		baseSeedSection,
 		compilerProfileSection,
 		taskSection,
-		criticalRules,
-		outputFormat,
 	)
 
 	return prompt, nil
 }
 
+// approxTokenLen estimates the token count of a text using the common
+// ~4 bytes/token heuristic for code. Good enough for budget enforcement.
+func approxTokenLen(s string) int {
+	return len(s) / 4
+}
+
+// trimCodeBlock enforces the builder's TokenBudget on one embedded code
+// block. Oversized code keeps its head (declarations, structure) and tail
+// (most recent logic) with an explicit omission marker in between, which
+// preserves far more useful context than a hard cut.
+func (b *Builder) trimCodeBlock(code string) string {
+	if b.TokenBudget <= 0 || approxTokenLen(code) <= b.TokenBudget {
+		return code
+	}
+
+	lines := strings.Split(code, "\n")
+	budgetBytes := b.TokenBudget * 4
+	headBytes := budgetBytes * 2 / 3
+	tailBytes := budgetBytes - headBytes
+
+	headEnd := 0
+	used := 0
+	for headEnd < len(lines) && used+len(lines[headEnd])+1 <= headBytes {
+		used += len(lines[headEnd]) + 1
+		headEnd++
+	}
+
+	tailStart := len(lines)
+	used = 0
+	for tailStart > headEnd && used+len(lines[tailStart-1])+1 <= tailBytes {
+		used += len(lines[tailStart-1]) + 1
+		tailStart--
+	}
+
+	omitted := tailStart - headEnd
+	if omitted <= 0 {
+		return code
+	}
+
+	var sb strings.Builder
+	sb.WriteString(strings.Join(lines[:headEnd], "\n"))
+	sb.WriteString(fmt.Sprintf("\n/* ... %d lines omitted to fit the prompt token budget ... */\n", omitted))
+	sb.WriteString(strings.Join(lines[tailStart:], "\n"))
+	return sb.String()
+}
+
 // getOutputFormat returns the appropriate output format instruction.
 // This is a generic format that works for all defense strategies.
+// The block depends only on builder configuration, so it is memoized.
 func (b *Builder) getOutputFormat() string {
+	b.outputFormatOnce.Do(func() {
+		b.outputFormat = b.assembleOutputFormat()
+	})
+	return b.outputFormat
+}
+
+func (b *Builder) assembleOutputFormat() string {
 	cflagsNote := `
 
 ## Optional: Compiler Flags
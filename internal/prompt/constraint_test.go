@@ -259,3 +259,77 @@ func TestBuilder_GetOutputFormat(t *testing.T) {
 		})
 	}
 }
+
+func TestBuilder_TrimCodeBlock(t *testing.T) {
+	var longCode strings.Builder
+	for i := 0; i < 500; i++ {
+		longCode.WriteString("int line_padding_variable_0000;\n")
+	}
+	long := longCode.String()
+
+	t.Run("zero budget disables trimming", func(t *testing.T) {
+		builder := NewBuilder(3, "", nil)
+		if got := builder.trimCodeBlock(long); got != long {
+			t.Error("trimCodeBlock() with TokenBudget=0 should return code unchanged")
+		}
+	})
+
+	t.Run("code under budget unchanged", func(t *testing.T) {
+		builder := NewBuilder(3, "", nil)
+		builder.TokenBudget = 1 << 20
+		if got := builder.trimCodeBlock(long); got != long {
+			t.Error("trimCodeBlock() should not touch code under the budget")
+		}
+	})
+
+	t.Run("over budget keeps head and tail", func(t *testing.T) {
+		builder := NewBuilder(3, "", nil)
+		builder.TokenBudget = 256
+
+		got := builder.trimCodeBlock(long)
+		if len(got) >= len(long) {
+			t.Fatalf("trimCodeBlock() should shrink the block: got %d bytes, want < %d", len(got), len(long))
+		}
+		if !strings.Contains(got, "lines omitted to fit the prompt token budget") {
+			t.Error("trimmed block should carry the omission marker")
+		}
+		if !strings.HasPrefix(got, "int line_padding_variable_0000;") {
+			t.Error("trimmed block should keep the head of the code")
+		}
+		if !strings.HasSuffix(strings.TrimRight(got, "\n"), "int line_padding_variable_0000;") {
+			t.Error("trimmed block should keep the tail of the code")
+		}
+	})
+}
+
+func TestPromptService_SystemPromptCache(t *testing.T) {
+	baseDir := t.TempDir()
+	basePath := filepath.Join(baseDir, string(PhaseConstraint)+".md")
+	if err := os.WriteFile(basePath, []byte("original system prompt"), 0644); err != nil {
+		t.Fatalf("failed to write base prompt: %v", err)
+	}
+
+	service, err := NewPromptService(baseDir, "", NewBuilder(3, "", nil))
+	if err != nil {
+		t.Fatalf("NewPromptService() failed: %v", err)
+	}
+
+	first, err := service.GetSystemPrompt(PhaseConstraint)
+	if err != nil {
+		t.Fatalf("GetSystemPrompt() failed: %v", err)
+	}
+
+	// Rewrite the file on disk: the cached prompt must stay byte-identical
+	// so the provider sees a stable prefix across the whole run.
+	if err := os.WriteFile(basePath, []byte("changed on disk"), 0644); err != nil {
+		t.Fatalf("failed to rewrite base prompt: %v", err)
+	}
+
+	second, err := service.GetSystemPrompt(PhaseConstraint)
+	if err != nil {
+		t.Fatalf("GetSystemPrompt() failed on cached read: %v", err)
+	}
+	if second != first {
+		t.Errorf("GetSystemPrompt() should serve the cached prompt, got %q", second)
+	}
+}
@@ -5,6 +5,7 @@ import (
 	"os"
 	"path/filepath"
 	"strings"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/prompt/mechanism"
 	"github.com/zjy-dev/de-fuzz/internal/seed"
@@ -41,6 +42,18 @@ type Builder struct {
 	// Mechanism is the defense-mechanism contract that drives template validation
 	// and prompt injection. May be nil when not in function-template mode.
 	Mechanism mechanism.Contract
+
+	// TokenBudget caps the approximate token count of each volatile code
+	// block embedded in a prompt (base seed, divergent function, failed
+	// seed). Oversized blocks are trimmed head-and-tail with an omission
+	// marker instead of being shipped whole. 0 disables trimming.
+	TokenBudget int
+
+	// outputFormat memoizes getOutputFormat: the block depends only on the
+	// builder configuration, so it is assembled once and, together with the
+	// rules, forms the stable reusable part of every user prompt.
+	outputFormatOnce sync.Once
+	outputFormat     string
 }
 
 // NewBuilder creates a new prompt builder.
@@ -4,6 +4,7 @@ import (
 	"fmt"
 	"os"
 	"path/filepath"
+	"sync"
 
 	"github.com/zjy-dev/de-fuzz/internal/seed"
 )
@@ -23,6 +24,13 @@ type PromptService struct {
 	baseDir       string // Directory containing base prompts (e.g., "prompts/base")
 	understanding string // Content of understanding.md (background context)
 	builder       *Builder
+
+	// systemCache holds the assembled system prompt per phase. The system
+	// prompt is byte-for-byte identical across every request of a phase, so
+	// it is read from disk once; being a stable prefix also lets providers
+	// apply prompt caching to it.
+	systemMu    sync.RWMutex
+	systemCache map[Phase]string
 }
 
 // NewPromptService creates a new PromptService
@@ -40,8 +48,9 @@ func NewPromptService(baseDir, understandingPath string, builder *Builder) (*Pro
 	}
 
 	s := &PromptService{
-		baseDir: baseDir,
-		builder: builder,
+		baseDir:     baseDir,
+		builder:     builder,
+		systemCache: make(map[Phase]string),
 	}
 
 	// Load understanding if path provided
@@ -62,7 +71,15 @@ func NewPromptService(baseDir, understandingPath string, builder *Builder) (*Pro
 
 // GetSystemPrompt returns the assembled system prompt for a given phase
 // Assembly order: basePrompt + "\n\n" + understanding
+// The result is cached: it is the stable prefix of every request in a phase.
 func (s *PromptService) GetSystemPrompt(phase Phase) (string, error) {
+	s.systemMu.RLock()
+	cached, ok := s.systemCache[phase]
+	s.systemMu.RUnlock()
+	if ok {
+		return cached, nil
+	}
+
 	// Load base prompt for this phase
 	basePath := filepath.Join(s.baseDir, string(phase)+".md")
 	baseContent, err := os.ReadFile(basePath)
@@ -77,6 +94,10 @@ func (s *PromptService) GetSystemPrompt(phase Phase) (string, error) {
 		result += "\n\n" + s.understanding
 	}
 
+	s.systemMu.Lock()
+	s.systemCache[phase] = result
+	s.systemMu.Unlock()
+
 	return result, nil
 }
 
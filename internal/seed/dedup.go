@@ -0,0 +1,99 @@
+package seed
+
+import (
+	"crypto/sha256"
+	"fmt"
+	"strings"
+)
+
+// NormalizeForDedup canonicalizes C source for duplicate detection:
+// comments are stripped and every whitespace run collapses to a single
+// space, so a reformatted or re-commented regeneration of the same code
+// hashes identically. String and character literals are preserved
+// verbatim.
+func NormalizeForDedup(content string) string {
+	const (
+		stCode = iota
+		stLineComment
+		stBlockComment
+		stString
+		stChar
+	)
+
+	var b strings.Builder
+	b.Grow(len(content))
+
+	state := stCode
+	pendingSpace := false
+	escaped := false
+
+	writeByte := func(c byte) {
+		if pendingSpace && b.Len() > 0 {
+			b.WriteByte(' ')
+		}
+		pendingSpace = false
+		b.WriteByte(c)
+	}
+
+	for i := 0; i < len(content); i++ {
+		c := content[i]
+		switch state {
+		case stCode:
+			switch {
+			case c == '/' && i+1 < len(content) && content[i+1] == '/':
+				state = stLineComment
+				i++
+			case c == '/' && i+1 < len(content) && content[i+1] == '*':
+				state = stBlockComment
+				i++
+			case c == '"':
+				state = stString
+				writeByte(c)
+			case c == '\'':
+				state = stChar
+				writeByte(c)
+			case c == ' ' || c == '\t' || c == '\n' || c == '\r':
+				pendingSpace = true
+			default:
+				writeByte(c)
+			}
+		case stLineComment:
+			if c == '\n' {
+				state = stCode
+				pendingSpace = true
+			}
+		case stBlockComment:
+			if c == '*' && i+1 < len(content) && content[i+1] == '/' {
+				state = stCode
+				pendingSpace = true
+				i++
+			}
+		case stString, stChar:
+			writeByte(c)
+			switch {
+			case escaped:
+				escaped = false
+			case c == '\\':
+				escaped = true
+			case (state == stString && c == '"') || (state == stChar && c == '\''):
+				state = stCode
+			}
+		}
+	}
+
+	return b.String()
+}
+
+// DedupKey returns the campaign-wide duplicate-index key for a seed:
+// SHA-256 over the normalized source plus any extras that change the
+// produced binary (compile flags, flag profile), since the same source
+// under different flags can earn a different verdict.
+func DedupKey(content string, extras ...string) string {
+	h := sha256.New()
+	h.Write([]byte(NormalizeForDedup(content)))
+	for _, extra := range extras {
+		h.Write([]byte{0})
+		h.Write([]byte(extra))
+	}
+	return fmt.Sprintf("%x", h.Sum(nil))
+}
@@ -0,0 +1,52 @@
+package seed
+
+import "testing"
+
+func TestNormalizeForDedup(t *testing.T) {
+	original := `// generated attempt 3
+int main(void) {
+	char buf[8]; /* destination */
+	return 0;
+}
+`
+	reformatted := `int main(void)   {
+		char buf[8];
+		return 0; // done
+}`
+
+	if NormalizeForDedup(original) != NormalizeForDedup(reformatted) {
+		t.Errorf("comment/whitespace variants should normalize identically:\n%q\nvs\n%q",
+			NormalizeForDedup(original), NormalizeForDedup(reformatted))
+	}
+
+	// Different code must stay different.
+	if NormalizeForDedup(original) == NormalizeForDedup("int main(void) { return 1; }") {
+		t.Error("distinct programs should not normalize to the same form")
+	}
+
+	// Comment-like sequences inside string literals are content.
+	withString := `char *s = "// not a comment";`
+	if got := NormalizeForDedup(withString); got != withString {
+		t.Errorf("string literal mangled: %q", got)
+	}
+
+	// Escaped quotes do not terminate the literal early.
+	escaped := `char *s = "a\"b /* x */ c";`
+	if got := NormalizeForDedup(escaped); got != escaped {
+		t.Errorf("escaped quote mishandled: %q", got)
+	}
+}
+
+func TestDedupKey(t *testing.T) {
+	key1 := DedupKey("int main(void) { return 0; }")
+	key2 := DedupKey("int   main(void)   { return 0; } // trailing")
+	if key1 != key2 {
+		t.Error("whitespace/comment variants should share a dedup key")
+	}
+
+	// Flags change the produced binary, so they change the key.
+	withFlags := DedupKey("int main(void) { return 0; }", "-O2")
+	if key1 == withFlags {
+		t.Error("compile flags should be part of the dedup key")
+	}
+}
@@ -0,0 +1,36 @@
+package seed
+
+import (
+	"strings"
+	"testing"
+)
+
+func TestCheckSyntax(t *testing.T) {
+	if hostCompiler() == "" {
+		t.Skip("no host C compiler available")
+	}
+
+	t.Run("valid code passes", func(t *testing.T) {
+		ok, diag := CheckSyntax("int main(void) { return 0; }\n")
+		if !ok {
+			t.Errorf("valid code rejected: %s", diag)
+		}
+	})
+
+	t.Run("syntax error is rejected with diagnostics", func(t *testing.T) {
+		ok, diag := CheckSyntax("int main(void) { return 0 \n")
+		if ok {
+			t.Fatal("broken code should be rejected")
+		}
+		if !strings.Contains(diag, "error") {
+			t.Errorf("diagnostics should carry the compiler error, got: %s", diag)
+		}
+	})
+
+	t.Run("missing header passes through to the real toolchain", func(t *testing.T) {
+		ok, _ := CheckSyntax("#include <definitely_not_a_host_header.h>\nint main(void) { return 0; }\n")
+		if !ok {
+			t.Error("host-unresolvable headers must not reject the seed")
+		}
+	})
+}
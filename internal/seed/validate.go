@@ -1,10 +1,14 @@
 package seed
 
 import (
+	"context"
 	"encoding/json"
 	"fmt"
+	"os/exec"
 	"regexp"
 	"strings"
+	"sync"
+	"time"
 )
 
 // ValidationError represents an error during seed validation.
@@ -226,6 +230,78 @@ func ValidateSeed(s *Seed) error {
 	return nil
 }
 
+// Host-side syntax pre-validation.
+//
+// A fair share of LLM outputs die on trivial syntax errors, and the
+// instrumented cross-compiler is an expensive way to find that out. The
+// gate below runs the plain host compiler in -fsyntax-only mode (tens of
+// milliseconds, no codegen, no coverage instrumentation) so obviously
+// broken candidates go straight back into the compile-error feedback
+// loop without touching the measured toolchain.
+
+// syntaxCheckTimeout bounds one host-compiler invocation; a gate that
+// hangs would defeat its purpose.
+const syntaxCheckTimeout = 5 * time.Second
+
+var (
+	hostCompilerOnce sync.Once
+	hostCompilerPath string
+)
+
+// hostCompiler locates a host C compiler once per process. An empty
+// result disables the gate.
+func hostCompiler() string {
+	hostCompilerOnce.Do(func() {
+		for _, name := range []string{"gcc", "cc", "clang"} {
+			if path, err := exec.LookPath(name); err == nil {
+				hostCompilerPath = path
+				return
+			}
+		}
+	})
+	return hostCompilerPath
+}
+
+// CheckSyntax runs `cc -fsyntax-only` on the content with the host
+// compiler, feeding it via stdin. It returns ok=false with the compiler
+// diagnostics only for definite syntax errors; when no host compiler is
+// available, the check times out, or the failure is a host-environment
+// artifact (e.g. a target-only header the host cannot resolve), the
+// content passes and the real toolchain decides.
+//
+// Seed CFlags are deliberately not forwarded: they target the cross
+// toolchain and would produce spurious host-side rejections.
+func CheckSyntax(content string) (bool, string) {
+	compiler := hostCompiler()
+	if compiler == "" {
+		return true, ""
+	}
+
+	ctx, cancel := context.WithTimeout(context.Background(), syntaxCheckTimeout)
+	defer cancel()
+
+	cmd := exec.CommandContext(ctx, compiler, "-fsyntax-only", "-x", "c", "-")
+	cmd.Stdin = strings.NewReader(content)
+	output, err := cmd.CombinedOutput()
+	if err == nil {
+		return true, ""
+	}
+	if ctx.Err() != nil {
+		return true, "" // timed out; not the content's fault
+	}
+
+	diag := string(output)
+	// Missing headers are a host-environment gap (cross-only headers do
+	// not exist here), not a syntax error in the seed.
+	if strings.Contains(diag, "No such file or directory") {
+		return true, ""
+	}
+	if !strings.Contains(diag, "error:") {
+		return true, ""
+	}
+	return false, diag
+}
+
 // CFlags parsing constants
 const (
 	CFlagsStartMarker = "// ||||| CFLAGS_START |||||"
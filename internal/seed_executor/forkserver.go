@@ -0,0 +1,380 @@
+package executor
+
+import (
+	"bufio"
+	"fmt"
+	"io"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strings"
+	"sync"
+	"time"
+)
+
+// forkserverAgentSource is a small guest-side execution server. It is
+// cross-compiled once per campaign with the campaign's target GCC, launched a
+// single time under qemu-user, and then receives (binary, args, stdin) jobs
+// over its stdin, forking per job. This amortizes the emulator startup and
+// dynamic-loader cost (~80ms per qemu-riscv64 spawn) that otherwise dominates
+// short oracle probes such as CanaryOracle's binary search.
+//
+// Protocol (all lengths in bytes, decimal ASCII):
+//
+//	request:  "EXEC <argc> <stdin_len>\n" + argc newline-terminated args + stdin bytes
+//	response: "DONE <exit_code> <stdout_len> <stderr_len>\n" + stdout bytes + stderr bytes
+//
+// Signal terminations are reported as 128+signal, matching getExitCode.
+const forkserverAgentSource = `#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/wait.h>
+#include <sys/select.h>
+
+#define MAX_ARGS 64
+
+struct buf { char *data; size_t len; size_t cap; };
+
+static void buf_append(struct buf *b, const char *p, size_t n) {
+    if (b->len + n > b->cap) {
+        b->cap = (b->cap ? b->cap * 2 : 4096);
+        while (b->cap < b->len + n) b->cap *= 2;
+        b->data = realloc(b->data, b->cap);
+        if (!b->data) _exit(99);
+    }
+    memcpy(b->data + b->len, p, n);
+    b->len += n;
+}
+
+static int read_line(char *out, size_t cap) {
+    size_t i = 0;
+    while (i + 1 < cap) {
+        char c;
+        ssize_t n = read(0, &c, 1);
+        if (n == 0) return -1; /* EOF: host closed the pipe, shut down */
+        if (n < 0) { if (errno == EINTR) continue; return -1; }
+        if (c == '\n') { out[i] = 0; return 0; }
+        out[i++] = c;
+    }
+    return -1;
+}
+
+static int read_full(char *out, size_t n) {
+    size_t off = 0;
+    while (off < n) {
+        ssize_t r = read(0, out + off, n - off);
+        if (r <= 0) { if (r < 0 && errno == EINTR) continue; return -1; }
+        off += r;
+    }
+    return 0;
+}
+
+static void write_full(int fd, const char *p, size_t n) {
+    size_t off = 0;
+    while (off < n) {
+        ssize_t w = write(fd, p + off, n - off);
+        if (w <= 0) { if (w < 0 && errno == EINTR) continue; _exit(98); }
+        off += w;
+    }
+}
+
+int main(void) {
+    char line[4096];
+    for (;;) {
+        if (read_line(line, sizeof(line)) != 0) return 0;
+        int argc;
+        size_t stdin_len;
+        if (sscanf(line, "EXEC %d %zu", &argc, &stdin_len) != 2 ||
+            argc < 1 || argc > MAX_ARGS)
+            return 1;
+
+        char *argv[MAX_ARGS + 1];
+        for (int i = 0; i < argc; i++) {
+            if (read_line(line, sizeof(line)) != 0) return 1;
+            argv[i] = strdup(line);
+        }
+        argv[argc] = NULL;
+
+        char *stdin_buf = malloc(stdin_len ? stdin_len : 1);
+        if (!stdin_buf || read_full(stdin_buf, stdin_len) != 0) return 1;
+
+        int in_pipe[2], out_pipe[2], err_pipe[2];
+        if (pipe(in_pipe) || pipe(out_pipe) || pipe(err_pipe)) return 1;
+
+        pid_t pid = fork();
+        if (pid < 0) return 1;
+        if (pid == 0) {
+            dup2(in_pipe[0], 0);
+            dup2(out_pipe[1], 1);
+            dup2(err_pipe[1], 2);
+            close(in_pipe[0]); close(in_pipe[1]);
+            close(out_pipe[0]); close(out_pipe[1]);
+            close(err_pipe[0]); close(err_pipe[1]);
+            execv(argv[0], argv);
+            fprintf(stderr, "forkserver: execv %s: %s\n", argv[0], strerror(errno));
+            _exit(127);
+        }
+
+        close(in_pipe[0]);
+        close(out_pipe[1]);
+        close(err_pipe[1]);
+        fcntl(in_pipe[1], F_SETFL, O_NONBLOCK);
+
+        struct buf out = {0}, errb = {0};
+        size_t stdin_off = 0;
+        int out_fd = out_pipe[0], err_fd = err_pipe[0], in_fd = in_pipe[1];
+        if (stdin_len == 0) { close(in_fd); in_fd = -1; }
+
+        while (out_fd >= 0 || err_fd >= 0 || in_fd >= 0) {
+            fd_set rfds, wfds;
+            FD_ZERO(&rfds); FD_ZERO(&wfds);
+            int maxfd = -1;
+            if (out_fd >= 0) { FD_SET(out_fd, &rfds); if (out_fd > maxfd) maxfd = out_fd; }
+            if (err_fd >= 0) { FD_SET(err_fd, &rfds); if (err_fd > maxfd) maxfd = err_fd; }
+            if (in_fd >= 0) { FD_SET(in_fd, &wfds); if (in_fd > maxfd) maxfd = in_fd; }
+            if (select(maxfd + 1, &rfds, &wfds, NULL, NULL) < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            char chunk[4096];
+            if (out_fd >= 0 && FD_ISSET(out_fd, &rfds)) {
+                ssize_t n = read(out_fd, chunk, sizeof(chunk));
+                if (n > 0) buf_append(&out, chunk, n);
+                else { close(out_fd); out_fd = -1; }
+            }
+            if (err_fd >= 0 && FD_ISSET(err_fd, &rfds)) {
+                ssize_t n = read(err_fd, chunk, sizeof(chunk));
+                if (n > 0) buf_append(&errb, chunk, n);
+                else { close(err_fd); err_fd = -1; }
+            }
+            if (in_fd >= 0 && FD_ISSET(in_fd, &wfds)) {
+                ssize_t n = write(in_fd, stdin_buf + stdin_off, stdin_len - stdin_off);
+                if (n > 0) stdin_off += n;
+                if (n < 0 && errno != EAGAIN && errno != EINTR) { close(in_fd); in_fd = -1; }
+                if (stdin_off == stdin_len) { close(in_fd); in_fd = -1; }
+            }
+        }
+
+        int status, exit_code = -1;
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+        if (WIFEXITED(status)) exit_code = WEXITSTATUS(status);
+        else if (WIFSIGNALED(status)) exit_code = 128 + WTERMSIG(status);
+
+        char hdr[128];
+        int hn = snprintf(hdr, sizeof(hdr), "DONE %d %zu %zu\n",
+                          exit_code, out.len, errb.len);
+        write_full(1, hdr, hn);
+        write_full(1, out.data ? out.data : "", out.len);
+        write_full(1, errb.data ? errb.data : "", errb.len);
+
+        for (int i = 0; i < argc; i++) free(argv[i]);
+        free(stdin_buf);
+        free(out.data);
+        free(errb.data);
+    }
+}
+`
+
+// BuildForkserverAgent cross-compiles the guest-side forkserver with the
+// given GCC and returns the path of the resulting binary. The agent is built
+// statically so it starts without the guest dynamic loader.
+func BuildForkserverAgent(gccPath, workDir string) (string, error) {
+	if err := os.MkdirAll(workDir, 0755); err != nil {
+		return "", fmt.Errorf("failed to create forkserver work dir: %w", err)
+	}
+
+	srcPath := filepath.Join(workDir, "forkserver_agent.c")
+	if err := os.WriteFile(srcPath, []byte(forkserverAgentSource), 0644); err != nil {
+		return "", fmt.Errorf("failed to write forkserver source: %w", err)
+	}
+
+	agentPath := filepath.Join(workDir, "forkserver_agent")
+	cmd := exec.Command(gccPath, "-O2", "-static", "-o", agentPath, srcPath)
+	output, err := cmd.CombinedOutput()
+	if err != nil {
+		return "", fmt.Errorf("failed to build forkserver agent: %w\n%s", err, output)
+	}
+
+	return agentPath, nil
+}
+
+// QEMUForkserverExecutor implements oracle.Executor on top of a long-lived
+// guest-side forkserver running under qemu-user. The emulator is started once
+// per campaign; each ExecuteWithInput/ExecuteWithArgs call is a single job on
+// the shared server. On timeout or protocol error the server is killed and
+// restarted lazily on the next job, so a wedged guest cannot stall the
+// campaign.
+type QEMUForkserverExecutor struct {
+	qemuPath   string
+	sysroot    string
+	agentPath  string
+	timeoutSec int
+
+	mu     sync.Mutex
+	cmd    *exec.Cmd
+	stdin  io.WriteCloser
+	stdout *bufio.Reader
+}
+
+// NewQEMUForkserverExecutor creates an executor backed by the given
+// pre-built guest agent (see BuildForkserverAgent). The server is started
+// lazily on the first job.
+func NewQEMUForkserverExecutor(qemuPath, sysroot, agentPath string, timeoutSec int) *QEMUForkserverExecutor {
+	return &QEMUForkserverExecutor{
+		qemuPath:   qemuPath,
+		sysroot:    sysroot,
+		agentPath:  agentPath,
+		timeoutSec: timeoutSec,
+	}
+}
+
+// ExecuteWithInput runs the binary on the forkserver with the given stdin.
+func (e *QEMUForkserverExecutor) ExecuteWithInput(binaryPath string, stdin string) (exitCode int, stdout string, stderr string, err error) {
+	return e.runJob([]string{binaryPath}, stdin)
+}
+
+// ExecuteWithArgs runs the binary on the forkserver with the given arguments.
+func (e *QEMUForkserverExecutor) ExecuteWithArgs(binaryPath string, args ...string) (exitCode int, stdout string, stderr string, err error) {
+	return e.runJob(append([]string{binaryPath}, args...), "")
+}
+
+// Close shuts down the server process if it is running.
+func (e *QEMUForkserverExecutor) Close() {
+	e.mu.Lock()
+	defer e.mu.Unlock()
+	e.stop()
+}
+
+// start launches qemu with the agent and wires up the job pipes.
+// Must be called with e.mu held.
+func (e *QEMUForkserverExecutor) start() error {
+	args := []string{}
+	if e.sysroot != "" {
+		args = append(args, "-L", e.sysroot)
+	}
+	args = append(args, e.agentPath)
+
+	cmd := exec.Command(e.qemuPath, args...)
+	// The agent multiplexes job results onto its stdout; qemu's own
+	// diagnostics go to stderr and are only interesting on failure.
+	cmd.Stderr = os.Stderr
+
+	stdinPipe, err := cmd.StdinPipe()
+	if err != nil {
+		return fmt.Errorf("failed to open forkserver stdin: %w", err)
+	}
+	stdoutPipe, err := cmd.StdoutPipe()
+	if err != nil {
+		return fmt.Errorf("failed to open forkserver stdout: %w", err)
+	}
+
+	if err := cmd.Start(); err != nil {
+		return fmt.Errorf("failed to start forkserver: %w", err)
+	}
+
+	e.cmd = cmd
+	e.stdin = stdinPipe
+	e.stdout = bufio.NewReader(stdoutPipe)
+	return nil
+}
+
+// stop kills the server process and clears the connection state.
+// Must be called with e.mu held.
+func (e *QEMUForkserverExecutor) stop() {
+	if e.cmd == nil {
+		return
+	}
+	e.stdin.Close()
+	e.cmd.Process.Kill()
+	e.cmd.Wait()
+	e.cmd = nil
+	e.stdin = nil
+	e.stdout = nil
+}
+
+// jobResult carries one protocol exchange result across the timeout boundary.
+type jobResult struct {
+	exitCode int
+	stdout   string
+	stderr   string
+	err      error
+}
+
+// runJob sends one job to the server and reads its response. Jobs are
+// serialized on the single server connection; a timed-out or failed exchange
+// tears the server down so the next job starts fresh.
+func (e *QEMUForkserverExecutor) runJob(argv []string, stdin string) (int, string, string, error) {
+	e.mu.Lock()
+	defer e.mu.Unlock()
+
+	if e.cmd == nil {
+		if err := e.start(); err != nil {
+			return -1, "", "", err
+		}
+	}
+
+	done := make(chan jobResult, 1)
+	go func() {
+		done <- e.exchange(argv, stdin)
+	}()
+
+	var timeout <-chan time.Time
+	if e.timeoutSec > 0 {
+		timer := time.NewTimer(time.Duration(e.timeoutSec) * time.Second)
+		defer timer.Stop()
+		timeout = timer.C
+	}
+
+	select {
+	case res := <-done:
+		if res.err != nil {
+			e.stop()
+			return -1, res.stdout, res.stderr, res.err
+		}
+		return res.exitCode, res.stdout, res.stderr, nil
+	case <-timeout:
+		// Killing qemu also kills the forked child; the exchange goroutine
+		// then fails on the closed pipe and exits.
+		e.stop()
+		return 124, "", "", nil // Timeout exit code
+	}
+}
+
+// exchange performs the blocking request/response cycle for one job.
+func (e *QEMUForkserverExecutor) exchange(argv []string, stdin string) jobResult {
+	var req strings.Builder
+	fmt.Fprintf(&req, "EXEC %d %d\n", len(argv), len(stdin))
+	for _, arg := range argv {
+		req.WriteString(arg)
+		req.WriteByte('\n')
+	}
+	req.WriteString(stdin)
+
+	if _, err := io.WriteString(e.stdin, req.String()); err != nil {
+		return jobResult{err: fmt.Errorf("failed to send forkserver job: %w", err)}
+	}
+
+	header, err := e.stdout.ReadString('\n')
+	if err != nil {
+		return jobResult{err: fmt.Errorf("failed to read forkserver response: %w", err)}
+	}
+
+	var exitCode, stdoutLen, stderrLen int
+	if _, err := fmt.Sscanf(header, "DONE %d %d %d", &exitCode, &stdoutLen, &stderrLen); err != nil {
+		return jobResult{err: fmt.Errorf("malformed forkserver response %q: %w", strings.TrimSpace(header), err)}
+	}
+
+	stdoutBuf := make([]byte, stdoutLen)
+	if _, err := io.ReadFull(e.stdout, stdoutBuf); err != nil {
+		return jobResult{err: fmt.Errorf("failed to read forkserver stdout payload: %w", err)}
+	}
+	stderrBuf := make([]byte, stderrLen)
+	if _, err := io.ReadFull(e.stdout, stderrBuf); err != nil {
+		return jobResult{err: fmt.Errorf("failed to read forkserver stderr payload: %w", err)}
+	}
+
+	return jobResult{exitCode: exitCode, stdout: string(stdoutBuf), stderr: string(stderrBuf)}
+}
@@ -0,0 +1,104 @@
+//go:build integration
+
+package executor
+
+import (
+	"os/exec"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// buildHostAgent compiles the forkserver agent with the host compiler so the
+// protocol can be exercised without QEMU: the executor is pointed directly at
+// the agent binary instead of an emulator.
+func buildHostAgent(t *testing.T) string {
+	t.Helper()
+
+	gcc, err := exec.LookPath("gcc")
+	if err != nil {
+		t.Skip("gcc not available on host")
+	}
+
+	agentPath, err := BuildForkserverAgent(gcc, t.TempDir())
+	require.NoError(t, err)
+	return agentPath
+}
+
+func newHostForkserver(t *testing.T, timeoutSec int) *QEMUForkserverExecutor {
+	agentPath := buildHostAgent(t)
+	// Run the agent natively: the agent ignores its own argv, so passing it
+	// as both "qemu" and guest binary starts it without emulation.
+	fs := NewQEMUForkserverExecutor(agentPath, "", agentPath, timeoutSec)
+	t.Cleanup(fs.Close)
+	return fs
+}
+
+func TestForkserver_Integration_ExecuteWithArgs(t *testing.T) {
+	fs := newHostForkserver(t, 10)
+
+	echoPath, err := exec.LookPath("echo")
+	require.NoError(t, err)
+
+	exitCode, stdout, stderr, err := fs.ExecuteWithArgs(echoPath, "hello", "world")
+	require.NoError(t, err)
+	assert.Equal(t, 0, exitCode)
+	assert.Equal(t, "hello world\n", stdout)
+	assert.Empty(t, stderr)
+}
+
+func TestForkserver_Integration_ExecuteWithInput(t *testing.T) {
+	fs := newHostForkserver(t, 10)
+
+	catPath, err := exec.LookPath("cat")
+	require.NoError(t, err)
+
+	exitCode, stdout, _, err := fs.ExecuteWithInput(catPath, "stdin payload")
+	require.NoError(t, err)
+	assert.Equal(t, 0, exitCode)
+	assert.Equal(t, "stdin payload", stdout)
+}
+
+func TestForkserver_Integration_ReusesServer(t *testing.T) {
+	fs := newHostForkserver(t, 10)
+
+	truePath, err := exec.LookPath("true")
+	require.NoError(t, err)
+
+	for i := 0; i < 5; i++ {
+		exitCode, _, _, err := fs.ExecuteWithArgs(truePath)
+		require.NoError(t, err)
+		assert.Equal(t, 0, exitCode)
+	}
+}
+
+func TestForkserver_Integration_SignalExitCode(t *testing.T) {
+	fs := newHostForkserver(t, 10)
+
+	shPath, err := exec.LookPath("sh")
+	require.NoError(t, err)
+
+	// SIGABRT (6) must be reported as 128+6, matching getExitCode.
+	exitCode, _, _, err := fs.ExecuteWithArgs(shPath, "-c", "kill -ABRT $$")
+	require.NoError(t, err)
+	assert.Equal(t, 134, exitCode)
+}
+
+func TestForkserver_Integration_TimeoutRestartsServer(t *testing.T) {
+	fs := newHostForkserver(t, 1)
+
+	shPath, err := exec.LookPath("sh")
+	require.NoError(t, err)
+
+	exitCode, _, _, err := fs.ExecuteWithArgs(shPath, "-c", "sleep 10")
+	require.NoError(t, err)
+	assert.Equal(t, 124, exitCode)
+
+	// The next job must transparently start a fresh server.
+	exitCode, stdout, _, err := fs.ExecuteWithInput(filepath.Join("/bin", "cat"), "alive")
+	require.NoError(t, err)
+	assert.Equal(t, 0, exitCode)
+	assert.Equal(t, "alive", stdout)
+}
@@ -0,0 +1,225 @@
+package state
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"time"
+
+	"github.com/zjy-dev/de-fuzz/internal/logger"
+)
+
+const (
+	// JournalFileName is the write-ahead journal stored next to the
+	// state snapshot.
+	JournalFileName = "global_state.journal"
+
+	// journalSyncBatch and journalSyncInterval bound how long appended
+	// records may sit unsynced: one fsync per batch of records or per
+	// interval, whichever comes first.
+	journalSyncBatch    = 64
+	journalSyncInterval = 100 * time.Millisecond
+
+	// journalCompactRecords triggers an automatic snapshot + truncate once
+	// the journal accumulates this many records.
+	journalCompactRecords = 4096
+)
+
+// Journal op codes. Every record carries the absolute post-mutation value,
+// so replay is idempotent and last-wins per field.
+const (
+	opNextID    = "next_id"
+	opCurrentID = "current_id"
+	opCoverage  = "coverage"
+	opProcessed = "processed"
+	opPoolSize  = "pool_size"
+)
+
+// journalRecord is one JSON line in the journal.
+type journalRecord struct {
+	Op    string `json:"op"`
+	Value uint64 `json:"value"`
+}
+
+// journal is the append-only mutation log behind a journaled FileManager.
+// It is guarded by the owning FileManager's mutex.
+type journal struct {
+	path     string
+	file     *os.File
+	w        *bufio.Writer
+	pending  int // records buffered since the last fsync
+	records  int // records since the last compaction
+	lastSync time.Time
+	broken   bool // append failed; disabled until the next compaction
+}
+
+// NewJournaledFileManager creates a FileManager that appends every state
+// mutation to a write-ahead journal (dir/global_state.journal) instead of
+// relying on callers to Save after each change. Load replays the journal
+// on top of the snapshot, so a crash between Saves loses at most the
+// records of the current fsync batch; Save compacts the journal back into
+// the JSON snapshot.
+func NewJournaledFileManager(dir string) *FileManager {
+	m := NewFileManager(dir)
+	m.journal = &journal{path: filepath.Join(dir, JournalFileName)}
+	return m
+}
+
+// logMutation appends one record to the journal (a no-op for plain
+// FileManagers) and compacts once the journal grows past the threshold.
+// Callers hold m.mu.
+func (m *FileManager) logMutation(op string, value uint64) {
+	j := m.journal
+	if j == nil || j.broken {
+		return
+	}
+	if err := j.append(journalRecord{Op: op, Value: value}); err != nil {
+		logger.Warn("State journal append failed, falling back to snapshot-only persistence: %v", err)
+		j.broken = true
+		return
+	}
+	if j.records >= journalCompactRecords {
+		if err := m.saveLocked(); err != nil {
+			logger.Warn("State journal compaction failed: %v", err)
+		}
+	}
+}
+
+// append writes one record, opening the journal lazily on first use and
+// batching fsyncs per journalSyncBatch / journalSyncInterval.
+func (j *journal) append(rec journalRecord) error {
+	if j.file == nil {
+		if err := os.MkdirAll(filepath.Dir(j.path), 0755); err != nil {
+			return err
+		}
+		f, err := os.OpenFile(j.path, os.O_WRONLY|os.O_CREATE|os.O_APPEND, 0644)
+		if err != nil {
+			return err
+		}
+		j.file = f
+		j.w = bufio.NewWriter(f)
+		j.lastSync = time.Now()
+	}
+
+	data, err := json.Marshal(rec)
+	if err != nil {
+		return err
+	}
+	data = append(data, '\n')
+	if _, err := j.w.Write(data); err != nil {
+		return err
+	}
+	j.pending++
+	j.records++
+
+	if j.pending >= journalSyncBatch || time.Since(j.lastSync) >= journalSyncInterval {
+		return j.sync()
+	}
+	return nil
+}
+
+// sync flushes buffered records and fsyncs the journal file.
+func (j *journal) sync() error {
+	if err := j.w.Flush(); err != nil {
+		return err
+	}
+	if err := j.file.Sync(); err != nil {
+		return err
+	}
+	j.pending = 0
+	j.lastSync = time.Now()
+	return nil
+}
+
+// truncate discards all records after a successful snapshot. Records still
+// sitting in the write buffer are dropped too: the snapshot already
+// contains their effects.
+func (j *journal) truncate() error {
+	if j.file == nil {
+		// Never opened this session; drop any stale journal left by a
+		// previous run.
+		if err := os.Remove(j.path); err != nil && !os.IsNotExist(err) {
+			return err
+		}
+	} else {
+		j.w.Reset(j.file)
+		if err := j.file.Truncate(0); err != nil {
+			return err
+		}
+	}
+	j.pending = 0
+	j.records = 0
+	j.broken = false
+	j.lastSync = time.Now()
+	return nil
+}
+
+// compactJournalLocked truncates the journal after a snapshot write. A
+// failed truncation only costs replay time on the next Load, so it is
+// logged rather than propagated. Callers hold m.mu.
+func (m *FileManager) compactJournalLocked() {
+	if m.journal == nil {
+		return
+	}
+	if err := m.journal.truncate(); err != nil {
+		logger.Warn("Failed to truncate state journal after snapshot: %v", err)
+	}
+}
+
+// replayJournalLocked applies journal records on top of the freshly loaded
+// snapshot. A torn trailing record (crash mid-append) is skipped with a
+// warning, like the packed corpus index. Callers hold m.mu.
+func (m *FileManager) replayJournalLocked() error {
+	if m.journal == nil {
+		return nil
+	}
+	data, err := os.ReadFile(m.journal.path)
+	if err != nil {
+		if os.IsNotExist(err) {
+			return nil
+		}
+		return fmt.Errorf("failed to read state journal %s: %w", m.journal.path, err)
+	}
+
+	replayed := 0
+	for _, line := range bytes.Split(data, []byte("\n")) {
+		if len(bytes.TrimSpace(line)) == 0 {
+			continue
+		}
+		var rec journalRecord
+		if err := json.Unmarshal(line, &rec); err != nil {
+			logger.Warn("Skipping torn state journal record: %v", err)
+			continue
+		}
+		m.applyRecordLocked(rec)
+		replayed++
+	}
+	m.journal.records = replayed
+	if replayed > 0 {
+		logger.Info("Replayed %d state journal record(s) on top of %s", replayed, filepath.Base(m.filePath))
+	}
+	return nil
+}
+
+// applyRecordLocked applies a single replayed mutation. Callers hold m.mu.
+func (m *FileManager) applyRecordLocked(rec journalRecord) {
+	switch rec.Op {
+	case opNextID:
+		if rec.Value > m.state.LastAllocatedID {
+			m.state.LastAllocatedID = rec.Value
+		}
+	case opCurrentID:
+		m.state.CurrentFuzzingID = rec.Value
+	case opCoverage:
+		m.state.TotalCoverage = rec.Value
+	case opProcessed:
+		m.state.Stats.ProcessedCount = int(rec.Value)
+	case opPoolSize:
+		m.state.Stats.PoolSize = int(rec.Value)
+	default:
+		logger.Warn("Ignoring unknown state journal op %q", rec.Op)
+	}
+}
@@ -0,0 +1,133 @@
+package state
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func TestJournaledFileManager(t *testing.T) {
+	t.Run("should replay mutations without an explicit save", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		manager := NewJournaledFileManager(tmpDir)
+		_ = manager.Load()
+
+		manager.NextID()
+		manager.NextID()
+		manager.NextID()
+		manager.UpdateCurrentID(3)
+		manager.UpdateCoverage(4200)
+		manager.IncrementProcessed()
+		manager.UpdatePoolSize(7)
+
+		// Crash simulation: no Save. The journal must be enough.
+		if err := manager.journal.sync(); err != nil {
+			t.Fatalf("failed to sync journal: %v", err)
+		}
+
+		manager2 := NewJournaledFileManager(tmpDir)
+		if err := manager2.Load(); err != nil {
+			t.Fatalf("failed to load: %v", err)
+		}
+
+		state := manager2.GetState()
+		if state.LastAllocatedID != 3 {
+			t.Errorf("expected LastAllocatedID 3, got %d", state.LastAllocatedID)
+		}
+		if state.CurrentFuzzingID != 3 {
+			t.Errorf("expected CurrentFuzzingID 3, got %d", state.CurrentFuzzingID)
+		}
+		if state.TotalCoverage != 4200 {
+			t.Errorf("expected TotalCoverage 4200, got %d", state.TotalCoverage)
+		}
+		if state.Stats.ProcessedCount != 1 {
+			t.Errorf("expected ProcessedCount 1, got %d", state.Stats.ProcessedCount)
+		}
+		if state.Stats.PoolSize != 7 {
+			t.Errorf("expected PoolSize 7, got %d", state.Stats.PoolSize)
+		}
+
+		// IDs keep advancing past the replayed allocation.
+		if id := manager2.NextID(); id != 4 {
+			t.Errorf("expected next ID 4 after replay, got %d", id)
+		}
+	})
+
+	t.Run("should compact journal into snapshot on save", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		manager := NewJournaledFileManager(tmpDir)
+		_ = manager.Load()
+
+		manager.NextID()
+		manager.UpdateCoverage(1500)
+
+		if err := manager.Save(); err != nil {
+			t.Fatalf("failed to save: %v", err)
+		}
+
+		// Journal must be empty after compaction.
+		info, err := os.Stat(filepath.Join(tmpDir, JournalFileName))
+		if err != nil {
+			t.Fatalf("failed to stat journal: %v", err)
+		}
+		if info.Size() != 0 {
+			t.Errorf("expected empty journal after save, got %d bytes", info.Size())
+		}
+
+		// The snapshot alone must carry the state.
+		manager2 := NewJournaledFileManager(tmpDir)
+		if err := manager2.Load(); err != nil {
+			t.Fatalf("failed to load: %v", err)
+		}
+		state := manager2.GetState()
+		if state.LastAllocatedID != 1 || state.TotalCoverage != 1500 {
+			t.Errorf("unexpected state after compaction: %+v", state)
+		}
+	})
+
+	t.Run("should skip torn trailing record", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		manager := NewJournaledFileManager(tmpDir)
+		_ = manager.Load()
+
+		manager.NextID()
+		manager.NextID()
+		if err := manager.journal.sync(); err != nil {
+			t.Fatalf("failed to sync journal: %v", err)
+		}
+
+		// Simulate a crash mid-append: a half-written final line.
+		journalPath := filepath.Join(tmpDir, JournalFileName)
+		f, err := os.OpenFile(journalPath, os.O_WRONLY|os.O_APPEND, 0644)
+		if err != nil {
+			t.Fatalf("failed to open journal: %v", err)
+		}
+		if _, err := f.WriteString(`{"op":"next_id","val`); err != nil {
+			t.Fatalf("failed to write torn record: %v", err)
+		}
+		f.Close()
+
+		manager2 := NewJournaledFileManager(tmpDir)
+		if err := manager2.Load(); err != nil {
+			t.Fatalf("failed to load with torn journal: %v", err)
+		}
+		if got := manager2.GetState().LastAllocatedID; got != 2 {
+			t.Errorf("expected LastAllocatedID 2 after torn record, got %d", got)
+		}
+	})
+
+	t.Run("plain manager should stay journal-free", func(t *testing.T) {
+		tmpDir := t.TempDir()
+		manager := NewFileManager(tmpDir)
+		_ = manager.Load()
+
+		manager.NextID()
+		if err := manager.Save(); err != nil {
+			t.Fatalf("failed to save: %v", err)
+		}
+
+		if _, err := os.Stat(filepath.Join(tmpDir, JournalFileName)); !os.IsNotExist(err) {
+			t.Errorf("plain FileManager should not create a journal, stat err: %v", err)
+		}
+	})
+}
@@ -60,6 +60,10 @@ type FileManager struct {
 	mu       sync.Mutex
 	filePath string
 	state    GlobalState
+
+	// journal, when non-nil, logs every mutation to a write-ahead journal
+	// so state survives crashes between Saves. See NewJournaledFileManager.
+	journal *journal
 }
 
 // NewFileManager creates a new FileManager for the given directory.
@@ -73,6 +77,7 @@ func NewFileManager(dir string) *FileManager {
 
 // Load reads the state from disk.
 // If the file doesn't exist, it initializes with default values.
+// Journaled managers then replay the write-ahead journal on top.
 func (m *FileManager) Load() error {
 	m.mu.Lock()
 	defer m.mu.Unlock()
@@ -90,7 +95,7 @@ func (m *FileManager) Load() error {
 					ProcessedCount: 0,
 				},
 			}
-			return nil
+			return m.replayJournalLocked()
 		}
 		return fmt.Errorf("failed to read state file %s: %w", m.filePath, err)
 	}
@@ -99,14 +104,19 @@ func (m *FileManager) Load() error {
 		return fmt.Errorf("failed to parse state file %s: %w", m.filePath, err)
 	}
 
-	return nil
+	return m.replayJournalLocked()
 }
 
-// Save writes the state to disk.
+// Save writes the state to disk and compacts the journal, if any.
 func (m *FileManager) Save() error {
 	m.mu.Lock()
 	defer m.mu.Unlock()
 
+	return m.saveLocked()
+}
+
+// saveLocked writes the snapshot. Callers hold m.mu.
+func (m *FileManager) saveLocked() error {
 	// Ensure directory exists
 	dir := filepath.Dir(m.filePath)
 	if err := os.MkdirAll(dir, 0755); err != nil {
@@ -122,6 +132,7 @@ func (m *FileManager) Save() error {
 		return fmt.Errorf("failed to write state file %s: %w", m.filePath, err)
 	}
 
+	m.compactJournalLocked()
 	return nil
 }
 
@@ -132,6 +143,7 @@ func (m *FileManager) NextID() uint64 {
 	defer m.mu.Unlock()
 
 	m.state.LastAllocatedID++
+	m.logMutation(opNextID, m.state.LastAllocatedID)
 	return m.state.LastAllocatedID
 }
 
@@ -141,6 +153,7 @@ func (m *FileManager) UpdateCurrentID(id uint64) {
 	defer m.mu.Unlock()
 
 	m.state.CurrentFuzzingID = id
+	m.logMutation(opCurrentID, id)
 }
 
 // UpdateCoverage updates the global coverage metric.
@@ -149,6 +162,7 @@ func (m *FileManager) UpdateCoverage(newCov uint64) {
 	defer m.mu.Unlock()
 
 	m.state.TotalCoverage = newCov
+	m.logMutation(opCoverage, newCov)
 }
 
 // IncrementProcessed increments the processed count.
@@ -157,6 +171,7 @@ func (m *FileManager) IncrementProcessed() {
 	defer m.mu.Unlock()
 
 	m.state.Stats.ProcessedCount++
+	m.logMutation(opProcessed, uint64(m.state.Stats.ProcessedCount))
 }
 
 // UpdatePoolSize sets the current pool size.
@@ -165,6 +180,7 @@ func (m *FileManager) UpdatePoolSize(size int) {
 	defer m.mu.Unlock()
 
 	m.state.Stats.PoolSize = size
+	m.logMutation(opPoolSize, uint64(size))
 }
 
 // GetState returns a copy of the current state.
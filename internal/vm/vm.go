@@ -41,7 +41,7 @@ type QEMUConfig struct {
 // NewQEMUVM creates a new QEMU VM instance.
 func NewQEMUVM(cfg QEMUConfig) *QEMUVM {
 	return &QEMUVM{
-		executor:  exec.NewCommandExecutor(),
+		executor:  exec.NewBoundedCommandExecutor(exec.DefaultMaxOutputBytes),
 		qemuPath:  cfg.QEMUPath,
 		sysroot:   cfg.Sysroot,
 		extraArgs: cfg.ExtraArgs,
@@ -150,7 +150,7 @@ type LocalVM struct {
 // NewLocalVM creates a new LocalVM for running native binaries.
 func NewLocalVM() *LocalVM {
 	return &LocalVM{
-		executor: exec.NewCommandExecutor(),
+		executor: exec.NewBoundedCommandExecutor(exec.DefaultMaxOutputBytes),
 	}
 }
 